@@ -0,0 +1,175 @@
+#!/usr/bin/env python3
+# scripts/ble_provision.py
+# Provisions a device over BLE: WiFi credentials sent encrypted, then the connection
+# test is followed until the device reports connected or failed.
+#
+# Usage:
+#   pip install bleak cryptography
+#   python3 scripts/ble_provision.py --pop K7QX3M9A --ssid HomeNet --password secret [--name heater-2]
+#     [--device Heater-1A2B]   (default: first device advertising the provisioning service)
+#
+# The PoP code is shown on the device's display (and by the console "ble" command).
+# Protocol: src/provisioningProtocol.h. Session is the transport-independent part and
+# is what a phone app has to implement.
+
+import argparse
+import asyncio
+import hashlib
+import hmac
+import struct
+import sys
+import time
+
+from cryptography.hazmat.primitives.asymmetric.x25519 import X25519PrivateKey, X25519PublicKey
+from cryptography.hazmat.primitives.ciphers.aead import AESGCM
+from cryptography.hazmat.primitives.serialization import Encoding, PublicFormat
+
+SERVICE_UUID = "6e7d0001-3c4a-4b8e-9d2f-5a1c0b7e4f10"
+RX_UUID = "6e7d0002-3c4a-4b8e-9d2f-5a1c0b7e4f10"  # client writes frames here
+TX_UUID = "6e7d0003-3c4a-4b8e-9d2f-5a1c0b7e4f10"  # device's reply to the last frame
+
+FRAME_HELLO, FRAME_SECURE, FRAME_HELLO_ACK, FRAME_ERROR = 0x01, 0x02, 0x81, 0xFF
+CMD_SET_CREDENTIALS, CMD_GET_STATUS = 0x10, 0x11
+TAG_SSID, TAG_PASSWORD, TAG_DEVICE_NAME = 1, 2, 3
+RESULTS = {0: "accepted", 1: "busy", 2: "invalid"}
+ERRORS = {1: "malformed", 2: "no session", 3: "locked out", 4: "wrong PoP", 5: "replay", 6: "internal"}
+PHASES = {0: "idle", 1: "testing", 2: "connected", 3: "failed"}
+
+
+class ProtocolError(Exception):
+    pass
+
+
+class Session:
+    """Client side of the provisioning protocol; frames in, frames out."""
+
+    def __init__(self, pop):
+        self.pop = pop.encode()
+        self.private = X25519PrivateKey.generate()
+        self.public = self.private.public_key().public_bytes(Encoding.Raw, PublicFormat.Raw)
+        self.aead = None
+        self.tx = 0
+        self.rx = 0
+
+    def hello(self):
+        return bytes([FRAME_HELLO]) + self.public
+
+    def on_hello_ack(self, frame):
+        check_error(frame)
+        if len(frame) != 33 or frame[0] != FRAME_HELLO_ACK:
+            raise ProtocolError("unexpected handshake reply")
+        device = frame[1:]
+        shared = self.private.exchange(X25519PublicKey.from_public_bytes(device))
+        prk = hmac.new(hashlib.sha256(self.pop).digest(), shared, hashlib.sha256).digest()
+        key = hmac.new(prk, b"dhc-prov v1" + self.public + device + b"\x01", hashlib.sha256).digest()
+        self.aead = AESGCM(key)
+
+    def seal(self, plaintext):
+        self.tx += 1
+        header = struct.pack("!BI", FRAME_SECURE, self.tx)
+        iv = b"C" + bytes(7) + struct.pack("!I", self.tx)
+        return header + self.aead.encrypt(iv, plaintext, header)
+
+    def open(self, frame):
+        check_error(frame)
+        if len(frame) < 21 or frame[0] != FRAME_SECURE:
+            raise ProtocolError("unexpected frame")
+        counter = struct.unpack("!I", frame[1:5])[0]
+        if counter <= self.rx:
+            raise ProtocolError("replayed reply")
+        iv = b"D" + bytes(7) + frame[1:5]
+        plain = self.aead.decrypt(iv, frame[5:], frame[:5])
+        self.rx = counter
+        return plain
+
+    def set_credentials(self, ssid, password, name=""):
+        body = bytes([CMD_SET_CREDENTIALS])
+        for tag, value in ((TAG_SSID, ssid), (TAG_PASSWORD, password), (TAG_DEVICE_NAME, name)):
+            raw = value.encode()
+            if raw:
+                body += bytes([tag, len(raw)]) + raw
+        return self.seal(body)
+
+    def get_status(self):
+        return self.seal(bytes([CMD_GET_STATUS]))
+
+    @staticmethod
+    def parse_result(plain):
+        if plain[0] != CMD_SET_CREDENTIALS | 0x80:
+            raise ProtocolError("unexpected reply")
+        return RESULTS.get(plain[1], str(plain[1]))
+
+    @staticmethod
+    def parse_status(plain):
+        if plain[0] != CMD_GET_STATUS | 0x80 or len(plain) < 7:
+            raise ProtocolError("unexpected reply")
+        return {"phase": PHASES.get(plain[1], str(plain[1])), "reason": plain[2],
+                "ip": ".".join(str(b) for b in plain[3:7])}
+
+
+def check_error(frame):
+    if frame and frame[0] == FRAME_ERROR:
+        code = frame[1] if len(frame) > 1 else 0
+        raise ProtocolError("device error: " + ERRORS.get(code, str(code)))
+
+
+async def provision(args):
+    from bleak import BleakClient, BleakScanner
+
+    start = time.time()
+    if args.device:
+        device = await BleakScanner.find_device_by_name(args.device, timeout=args.timeout)
+    else:
+        device = await BleakScanner.find_device_by_filter(
+            lambda d, adv: SERVICE_UUID in [u.lower() for u in adv.service_uuids], timeout=args.timeout)
+    if device is None:
+        raise ProtocolError("no provisioning device found")
+    print("Found %s (%s) after %.1f s" % (device.name, device.address, time.time() - start))
+
+    async with BleakClient(device) as client:
+        async def exchange(frame):
+            await client.write_gatt_char(RX_UUID, frame, response=True)
+            return bytes(await client.read_gatt_char(TX_UUID))
+
+        session = Session(args.pop)
+        session.on_hello_ack(await exchange(session.hello()))
+        result = Session.parse_result(session.open(await exchange(
+            session.set_credentials(args.ssid, args.password, args.name))))
+        print("Credentials %s" % result)
+        if result != "accepted":
+            return False
+
+        deadline = time.time() + args.timeout
+        while time.time() < deadline:
+            await asyncio.sleep(1.0)
+            status = Session.parse_status(session.open(await exchange(session.get_status())))
+            if status["phase"] == "connected":
+                print("Connected, device at http://%s/ (%.1f s in total)" % (status["ip"], time.time() - start))
+                return True
+            if status["phase"] == "failed":
+                print("Connection failed (reason %d); check the password" % status["reason"])
+                return False
+            print("  %s..." % status["phase"])
+        print("No result within %.0f s" % args.timeout)
+        return False
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Provision a device over BLE")
+    ap.add_argument("--pop", required=True, help="code shown on the device display")
+    ap.add_argument("--ssid", required=True)
+    ap.add_argument("--password", default="")
+    ap.add_argument("--name", default="", help="device name")
+    ap.add_argument("--device", help="BLE name, e.g. Heater-1A2B")
+    ap.add_argument("--timeout", type=float, default=30.0)
+    args = ap.parse_args()
+    try:
+        ok = asyncio.run(provision(args))
+    except ProtocolError as e:
+        print(str(e))
+        ok = False
+    sys.exit(0 if ok else 1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,217 @@
+#!/usr/bin/env python3
+# scripts/build_web.py
+# Builds the provisioning page into the firmware: web/provisioning/index.html with its
+# local style sheet and script minified and inlined, gzipped, and written as a byte array
+# to src/provisioningPage.h (served from flash by Provisioning, see Ws::serveEmbedded).
+#
+# Usage:
+#   python3 scripts/build_web.py                  (regenerate the header, print page weight)
+#   python3 scripts/build_web.py --check          (exit 1 if the header is out of date)
+#   python3 scripts/build_web.py --measure http://192.168.4.1/
+#                                                 (first load of a live device: requests, bytes)
+#
+# Also runs as a PlatformIO pre-script; the header is only rewritten when it changes, so
+# an unchanged page does not trigger a rebuild. The minifiers are deliberately simple and
+# only need to handle the sources in web/provisioning (no regex literals in the JS).
+
+import gzip
+import hashlib
+import re
+import sys
+import urllib.error
+import urllib.request
+from pathlib import Path
+
+SRC_DIR = Path("web/provisioning")
+OUT = Path("src/provisioningPage.h")
+
+
+def minify_css(css):
+    css = re.sub(r"/\*.*?\*/", "", css, flags=re.S)
+    css = re.sub(r"\s+", " ", css)
+    css = re.sub(r"\s*([{}:;,>])\s*", r"\1", css)
+    return css.replace(";}", "}").strip()
+
+
+def _word(c):
+    return c.isalnum() or c in "_$\\" or ord(c) > 127
+
+
+# A newline after one of these (or before one of the next set) can never end a statement
+_NO_ASI_BEFORE = set("{[(,;:=+-*/&|?!<>%")
+_NO_ASI_AFTER = set("}]),;.:?&|+*/=<>%")
+
+
+def minify_js(js):
+    out = []
+    i, n = 0, len(js)
+    pending = None  # whitespace seen since the last token: None, " " or "\n"
+
+    def last():
+        return out[-1][-1] if out else ""
+
+    while i < n:
+        c = js[i]
+        if c in "'\"`":
+            j = i + 1
+            while j < n and js[j] != c:
+                j += 2 if js[j] == "\\" else 1
+            tok = js[i:j + 1]
+            i = j + 1
+        elif js.startswith("//", i):
+            i = js.find("\n", i)
+            i = n if i < 0 else i
+            continue
+        elif js.startswith("/*", i):
+            i = js.index("*/", i) + 2
+            pending = pending or " "
+            continue
+        elif c.isspace():
+            if c == "\n":
+                pending = "\n"
+            elif pending is None:
+                pending = " "
+            i += 1
+            continue
+        else:
+            tok = c
+            i += 1
+
+        if pending and out:
+            prev, nxt = last(), tok[0]
+            if pending == "\n" and prev not in _NO_ASI_BEFORE and nxt not in _NO_ASI_AFTER:
+                out.append("\n")
+            elif (_word(prev) and _word(nxt)) or (prev in "+-" and nxt == prev):
+                out.append(" ")
+        pending = None
+        out.append(tok)
+    return "".join(out).replace("</script", "<\\/script")
+
+
+def minify_html(html):
+    html = re.sub(r"<!--.*?-->", "", html, flags=re.S)
+    html = re.sub(r">\s+<", "><", html)
+    return re.sub(r"\s+", " ", html).strip()
+
+
+def inline(html, src_dir):
+    """Replace local <link rel=stylesheet> and <script src> with their minified content."""
+    def css(m):
+        return "<style>" + minify_css((src_dir / m.group(1).lstrip("/")).read_text(encoding="utf-8")) + "</style>"
+
+    def script(m):
+        return "<script>" + minify_js((src_dir / m.group(1).lstrip("/")).read_text(encoding="utf-8")) + "</script>"
+
+    html = re.sub(r'<link rel="stylesheet" href="(/[^":]+)">', css, html)
+    return re.sub(r'<script src="(/[^":]+)"></script>', script, html)
+
+
+def build(src_dir):
+    # Minify the markup before inlining: the script keeps newlines where ASI needs them
+    html = inline(minify_html((src_dir / "index.html").read_text(encoding="utf-8")), src_dir)
+    raw = html.encode("utf-8")
+    gz = gzip.compress(raw, compresslevel=9, mtime=0)  # mtime 0: reproducible output
+    return raw, gz
+
+
+def header(raw, gz, sources):
+    etag = hashlib.sha256(gz).hexdigest()[:16]
+    rows = []
+    for k in range(0, len(gz), 16):
+        rows.append("    " + ", ".join("0x%02x" % b for b in gz[k:k + 16]) + ",")
+    return "\n".join([
+        "#pragma once",
+        "",
+        "/**",
+        " * @file provisioningPage.h",
+        " * @brief Provisioning page, gzipped. GENERATED by scripts/build_web.py from",
+        " *        %s; do not edit." % ", ".join(sources),
+        " */",
+        "",
+        "#include <Arduino.h>",
+        "",
+        "namespace ProvisioningPage",
+        "{",
+        "    constexpr size_t RAW_SIZE = %d;" % len(raw),
+        "    constexpr size_t GZ_SIZE = %d;" % len(gz),
+        '    constexpr const char *ETAG = "\\"%s\\"";' % etag,
+        "",
+        "    alignas(4) static const uint8_t GZ[GZ_SIZE] PROGMEM = {",
+        *rows,
+        "    };",
+        "}",
+        "",
+    ])
+
+
+def report(src_dir, raw, gz):
+    files = [p for p in sorted(src_dir.iterdir()) if p.is_file()]
+    separate = sum(p.stat().st_size for p in files)
+    # Separate files: the page, each asset and the favicon probe every browser sends
+    print("[build_web] before: %d requests, %d bytes (%s, uncompressed)" %
+          (len(files) + 1, separate, ", ".join(p.name for p in files)))
+    print("[build_web] after:  1 request, %d bytes gzipped (%d minified, %d%% of the separate files)" %
+          (len(gz), len(raw), round(100 * len(gz) / separate)))
+
+
+def generate(check=False):
+    if not (SRC_DIR / "index.html").exists():
+        print("[build_web] warning: %s not found, skipping" % SRC_DIR)
+        return True
+    raw, gz = build(SRC_DIR)
+    sources = sorted(p.name for p in SRC_DIR.iterdir() if p.is_file())
+    text = header(raw, gz, ["%s/%s" % (SRC_DIR.as_posix(), s) for s in sources])
+    current = OUT.read_text(encoding="utf-8") if OUT.exists() else ""
+    if current == text:
+        return True
+    if check:
+        print("[build_web] %s is out of date; run scripts/build_web.py" % OUT)
+        return False
+    OUT.write_text(text, encoding="utf-8")
+    print("[build_web] wrote %s" % OUT)
+    report(SRC_DIR, raw, gz)
+    return True
+
+
+def measure(url):
+    """Load a page like a browser's first visit: the page, local subresources, favicon."""
+    base = url.rstrip("/")
+    total = requests = 0
+
+    def get(path):
+        nonlocal total, requests
+        req = urllib.request.Request(base + path, headers={"Accept-Encoding": "gzip"})
+        try:
+            with urllib.request.urlopen(req, timeout=10) as resp:
+                body, status, hdrs = resp.read(), resp.status, resp.headers
+        except urllib.error.HTTPError as e:
+            body, status, hdrs = e.read(), e.code, e.headers
+        wire = len(body) + len(str(hdrs))
+        requests += 1
+        total += wire
+        print("  %-24s %3d %6d bytes  %s" % (path, status, wire, hdrs.get("Content-Encoding", "")))
+        if hdrs.get("Content-Encoding") == "gzip":
+            body = gzip.decompress(body)
+        return body.decode("utf-8", "replace")
+
+    html = get("/")
+    subresources = re.findall(r'(?:href|src)="(/[^"]*)"', html)
+    for path in subresources:
+        get(path)
+    if 'rel="icon"' not in html:
+        get("/favicon.ico")
+    print("First load: %d request(s), %d bytes (bodies + response headers)" % (requests, total))
+
+
+if __name__ == "__main__":
+    args = sys.argv[1:]
+    if args[:1] == ["--measure"] and len(args) == 2:
+        measure(args[1])
+    elif args in ([], ["--check"]):
+        sys.exit(0 if generate(check=bool(args)) else 1)
+    else:
+        print(__doc__ or "usage: build_web.py [--check | --measure URL]")
+        sys.exit(2)
+else:
+    # PlatformIO extra_script: regenerate before the build (no sys.exit inside SCons)
+    generate()
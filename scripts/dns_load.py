@@ -0,0 +1,200 @@
+#!/usr/bin/env python3
+# scripts/dns_load.py
+# Measures the captive-portal DNS responder: sustained queries/second and latency, or
+# how fast a phone-style burst of probes is answered.
+#
+# Usage (laptop joined to the provisioning AP, device at 192.168.4.1):
+#   python3 scripts/dns_load.py --host 192.168.4.1 [--seconds 10] [--concurrency 16]
+#   python3 scripts/dns_load.py --host 192.168.4.1 --burst 24
+# then on the device console:
+#   ap                 (captive DNS counters: queries, no-data answers, max batch per wake)
+#   ap dnsreset        (before the next run)
+#
+# Queries cycle through the usual probe names and the A / AAAA / HTTPS record types
+# (--types). Every reply is checked: A must carry one IPv4 answer, other types must be
+# NOERROR with no answer. Timeouts are counted, not fatal.
+
+import argparse
+import random
+import select
+import socket
+import struct
+import sys
+import time
+
+PROBE_NAMES = [
+    "connectivitycheck.gstatic.com",
+    "clients3.google.com",
+    "captive.apple.com",
+    "www.apple.com",
+    "www.msftconnecttest.com",
+    "detectportal.firefox.com",
+    "heater.local",
+]
+TYPES = {"a": 1, "aaaa": 28, "https": 65, "svcb": 64, "txt": 16}
+
+
+def build_query(qid, name, qtype):
+    header = struct.pack("!HHHHHH", qid, 0x0100, 1, 0, 0, 0)  # RD set
+    qname = b"".join(bytes([len(p)]) + p.encode() for p in name.split(".")) + b"\0"
+    return header + qname + struct.pack("!HH", qtype, 1)
+
+
+def check_reply(data, qtype):
+    """Returns (id, ok, ip) for a reply."""
+    if len(data) < 12:
+        return None, False, None
+    qid, flags, qd, an, ns, ar = struct.unpack("!HHHHHH", data[:12])
+    rcode = flags & 0x0F
+    if not flags & 0x8000 or rcode != 0:
+        return qid, False, None
+    if qtype == 1:
+        if an != 1 or len(data) < 16:
+            return qid, False, None
+        rdata = data[-4:]
+        return qid, True, socket.inet_ntoa(rdata)
+    return qid, an == 0, None
+
+
+def percentile(values, pct):
+    if not values:
+        return 0.0
+    values = sorted(values)
+    k = min(len(values) - 1, int(round(pct / 100.0 * (len(values) - 1))))
+    return values[k]
+
+
+def make_socket():
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.setsockopt(socket.SOL_SOCKET, socket.SO_RCVBUF, 1 << 20)
+    sock.setblocking(False)
+    return sock
+
+
+def next_query(state, qtypes):
+    state["seq"] += 1
+    qid = (state["base"] + state["seq"]) & 0xFFFF
+    name = PROBE_NAMES[state["seq"] % len(PROBE_NAMES)]
+    qtype = qtypes[state["seq"] % len(qtypes)]
+    return qid, build_query(qid, name, qtype), qtype
+
+
+def run_sustained(args, qtypes):
+    sock = make_socket()
+    addr = (args.host, args.port)
+    state = {"seq": 0, "base": random.randrange(0x10000)}
+    pending = {}  # id -> (sent time, qtype)
+    latencies = []
+    stats = {"sent": 0, "ok": 0, "bad": 0, "timeouts": 0}
+    ips = set()
+
+    start = time.perf_counter()
+    deadline = start + args.seconds
+    while True:
+        now = time.perf_counter()
+        if now >= deadline and not pending:
+            break
+        # Keep `concurrency` queries in flight until the deadline
+        while now < deadline and len(pending) < args.concurrency:
+            qid, pkt, qtype = next_query(state, qtypes)
+            if qid in pending:
+                break
+            sock.sendto(pkt, addr)
+            pending[qid] = (time.perf_counter(), qtype)
+            stats["sent"] += 1
+
+        readable, _, _ = select.select([sock], [], [], 0.01)
+        if readable:
+            while True:
+                try:
+                    data = sock.recv(2048)
+                except BlockingIOError:
+                    break
+                got = time.perf_counter()
+                qid = struct.unpack("!H", data[:2])[0] if len(data) >= 2 else None
+                if qid not in pending:
+                    continue  # late reply to a query already timed out
+                sent, qtype = pending.pop(qid)
+                _, ok, ip = check_reply(data, qtype)
+                stats["ok" if ok else "bad"] += 1
+                if ip:
+                    ips.add(ip)
+                latencies.append((got - sent) * 1000.0)
+
+        now = time.perf_counter()
+        for qid in [q for q, (sent, _) in pending.items() if now - sent > args.timeout]:
+            del pending[qid]
+            stats["timeouts"] += 1
+
+    elapsed = time.perf_counter() - start
+    print("Sent %d queries in %.1f s (%d in flight): %.0f answered/s" %
+          (stats["sent"], elapsed, args.concurrency, (stats["ok"] + stats["bad"]) / elapsed))
+    print("Replies: %d ok, %d wrong, %d timeouts" % (stats["ok"], stats["bad"], stats["timeouts"]))
+    print_latency(latencies)
+    if ips:
+        print("A answers point at: %s" % ", ".join(sorted(ips)))
+    return stats["bad"] == 0 and stats["timeouts"] == 0
+
+
+def run_burst(args, qtypes):
+    sock = make_socket()
+    addr = (args.host, args.port)
+    state = {"seq": 0, "base": random.randrange(0x10000)}
+    pending = {}
+    latencies = []
+    bad = 0
+
+    start = time.perf_counter()
+    for _ in range(args.burst):
+        qid, pkt, qtype = next_query(state, qtypes)
+        sock.sendto(pkt, addr)
+        pending[qid] = (time.perf_counter(), qtype)
+    last = start
+    while pending and time.perf_counter() - start < args.timeout:
+        readable, _, _ = select.select([sock], [], [], 0.01)
+        if not readable:
+            continue
+        while True:
+            try:
+                data = sock.recv(2048)
+            except BlockingIOError:
+                break
+            last = time.perf_counter()
+            qid = struct.unpack("!H", data[:2])[0] if len(data) >= 2 else None
+            if qid not in pending:
+                continue
+            sent, qtype = pending.pop(qid)
+            ok = check_reply(data, qtype)[1]
+            bad += 0 if ok else 1
+            latencies.append((last - sent) * 1000.0)
+
+    print("Burst of %d: %d answered (%d wrong), %d unanswered, all done after %.1f ms" %
+          (args.burst, len(latencies), bad, len(pending), (last - start) * 1000.0))
+    print_latency(latencies)
+    return bad == 0 and not pending
+
+
+def print_latency(latencies):
+    if latencies:
+        print("Latency ms: p50 %.2f, p95 %.2f, p99 %.2f, max %.2f" %
+              (percentile(latencies, 50), percentile(latencies, 95), percentile(latencies, 99), max(latencies)))
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Load generator for the captive-portal DNS responder")
+    ap.add_argument("--host", default="192.168.4.1", help="device address on the provisioning AP")
+    ap.add_argument("--port", type=int, default=53)
+    ap.add_argument("--seconds", type=float, default=10.0)
+    ap.add_argument("--concurrency", type=int, default=16, help="queries kept in flight")
+    ap.add_argument("--timeout", type=float, default=1.0, help="per-query timeout in seconds")
+    ap.add_argument("--types", default="a,aaaa,https", help="comma separated: " + ",".join(TYPES))
+    ap.add_argument("--burst", type=int, default=0, help="send N queries at once and time the answers instead")
+    args = ap.parse_args()
+
+    qtypes = [TYPES[t.strip().lower()] for t in args.types.split(",") if t.strip()]
+    ok = run_burst(args, qtypes) if args.burst else run_sustained(args, qtypes)
+    sys.exit(0 if ok else 1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+# scripts/http_load.py
+# Keeps the device's web server busy so control loop jitter can be compared under load.
+#
+# Usage:
+#   python3 scripts/http_load.py --host 192.168.1.50 [--threads 4] [--seconds 60] [--path /api/wifi ...]
+# then on the device console:
+#   tasks reset        (before starting the load)
+#   tasks              (while / after it runs; compare with a run on an idle network)
+#
+# Each thread requests the paths round-robin as fast as the device answers. Errors and
+# timeouts are counted, not fatal: a slow or dropped response is what load looks like.
+
+import argparse
+import threading
+import time
+import urllib.error
+import urllib.request
+
+DEFAULT_PATHS = ["/api/wifi", "/api/crashlog", "/api/display.pbm"]
+
+
+def worker(base, paths, deadline, timeout, stats, lock):
+    ok = errors = nbytes = 0
+    i = 0
+    while time.time() < deadline:
+        url = base + paths[i % len(paths)]
+        i += 1
+        try:
+            with urllib.request.urlopen(url, timeout=timeout) as resp:
+                nbytes += len(resp.read())
+                ok += 1
+        except (urllib.error.URLError, OSError):
+            errors += 1
+    with lock:
+        stats["ok"] += ok
+        stats["errors"] += errors
+        stats["bytes"] += nbytes
+
+
+def main():
+    ap = argparse.ArgumentParser(description="HTTP load generator for jitter tests")
+    ap.add_argument("--host", required=True, help="device address")
+    ap.add_argument("--port", type=int, default=80)
+    ap.add_argument("--threads", type=int, default=4)
+    ap.add_argument("--seconds", type=float, default=60.0)
+    ap.add_argument("--timeout", type=float, default=5.0, help="per-request timeout in seconds")
+    ap.add_argument("--path", action="append", help="path to request (repeatable)")
+    args = ap.parse_args()
+
+    base = "http://%s:%d" % (args.host, args.port)
+    paths = args.path or DEFAULT_PATHS
+    stats = {"ok": 0, "errors": 0, "bytes": 0}
+    lock = threading.Lock()
+
+    start = time.time()
+    deadline = start + args.seconds
+    threads = [
+        threading.Thread(target=worker, args=(base, paths, deadline, args.timeout, stats, lock), daemon=True)
+        for _ in range(args.threads)
+    ]
+    print("Loading %s with %d threads for %.0f s: %s" % (base, args.threads, args.seconds, ", ".join(paths)))
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+
+    elapsed = time.time() - start
+    print("%d requests (%.1f/s), %d errors, %.1f KiB received"
+          % (stats["ok"], stats["ok"] / elapsed, stats["errors"], stats["bytes"] / 1024.0))
+
+
+if __name__ == "__main__":
+    main()
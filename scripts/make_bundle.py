@@ -0,0 +1,248 @@
+#!/usr/bin/env python3
+# scripts/make_bundle.py
+# Signed provisioning bundles for many units at once (format: src/provisioningBundle.h).
+#
+# Usage:
+#   pip install cryptography [pyserial]
+#   # once: fleet key pair; the public half is compiled into the firmware
+#   python3 scripts/make_bundle.py keygen --key fleet-key.pem --header src/bundleKey.h
+#
+#   # one bundle per unit listed in devices.csv (columns: mac[,name]) ...
+#   python3 scripts/make_bundle.py make --key fleet-key.pem --seq 1 \
+#       --network HomeNet secret123 --network Workshop pass4567 --name "heater-{mac4}" \
+#       --devices devices.csv --out bundles/
+#   # ... or one for every unit (copy it to LittleFS as /bundle.json)
+#   python3 scripts/make_bundle.py make --key fleet-key.pem --seq 1 --network HomeNet secret123 \
+#       --fleet --out data/bundle.json
+#
+#   # deliver: USB serial console or HTTP
+#   python3 scripts/make_bundle.py send bundles/A1B2C3D4E5F6.json --port /dev/ttyACM0
+#   python3 scripts/make_bundle.py upload bundles/A1B2C3D4E5F6.json --host 192.168.4.1
+#   python3 scripts/make_bundle.py show bundles/A1B2C3D4E5F6.json [--key fleet-key.pem]
+#
+# The device refuses a bundle whose seq is not above the last one it applied, so bump
+# --seq for every new round.
+
+import argparse
+import base64
+import csv
+import json
+import os
+import re
+import sys
+import time
+import urllib.error
+import urllib.request
+from pathlib import Path
+
+from cryptography.exceptions import InvalidSignature
+from cryptography.hazmat.primitives import hashes, serialization
+from cryptography.hazmat.primitives.asymmetric import ec
+
+MAX_PAYLOAD = 1536  # ProvisioningBundle::MAX_PAYLOAD
+MAX_NETWORKS = 5    # primary + Config::MAX_EXTRA_NETWORKS
+MAC_RE = re.compile(r"^[0-9A-F]{12}$")
+
+
+def load_key(path):
+    return serialization.load_pem_private_key(Path(path).read_bytes(), password=None)
+
+
+def keygen(args):
+    key_path = Path(args.key)
+    if key_path.exists():
+        sys.exit("%s exists; refusing to overwrite a fleet key" % key_path)
+    key = ec.generate_private_key(ec.SECP256R1())
+    pem = key.private_bytes(serialization.Encoding.PEM, serialization.PrivateFormat.PKCS8,
+                            serialization.NoEncryption())
+    fd = os.open(key_path, os.O_WRONLY | os.O_CREAT | os.O_EXCL, 0o600)
+    with os.fdopen(fd, "wb") as f:
+        f.write(pem)
+    print("Private key: %s (keep it out of the repository)" % key_path)
+    if args.header:
+        write_header(key.public_key(), Path(args.header))
+
+
+def write_header(public_key, path):
+    pem = public_key.public_bytes(serialization.Encoding.PEM,
+                                  serialization.PublicFormat.SubjectPublicKeyInfo).decode()
+    text = path.read_text(encoding="utf-8") if path.exists() else ""
+    literal = "\n".join('    "%s\\n"' % line for line in pem.strip().splitlines())
+    decl = "static const char BUNDLE_PUBLIC_KEY_PEM[] =\n%s;" % literal
+    if "BUNDLE_PUBLIC_KEY_PEM" in text:
+        text = re.sub(r"static const char BUNDLE_PUBLIC_KEY_PEM\[\] =[^;]*;", lambda m: decl, text, flags=re.S)
+    else:
+        text = "#pragma once\n\n" + decl + "\n"
+    path.write_text(text, encoding="utf-8")
+    print("Public key written to %s; rebuild the firmware" % path)
+
+
+def payload_for(args, device, name):
+    payload = {"v": 1, "seq": args.seq, "device": device,
+               "networks": [{"ssid": s, "password": p} for s, p in args.network]}
+    if name:
+        payload["deviceName"] = name
+    settings = {}
+    if args.ntp:
+        settings["ntpServer"] = args.ntp
+    if args.displays:
+        settings["displays"] = json.loads(Path(args.displays).read_text(encoding="utf-8"))
+    if settings:
+        payload["settings"] = settings
+    return json.dumps(payload, separators=(",", ":")).encode()
+
+
+def sign(key, payload):
+    if len(payload) > MAX_PAYLOAD:
+        sys.exit("payload is %d bytes; the device takes at most %d" % (len(payload), MAX_PAYLOAD))
+    sig = key.sign(payload, ec.ECDSA(hashes.SHA256()))  # DER, as mbedtls_pk_verify expects
+    return {"payload": base64.b64encode(payload).decode(), "sig": base64.b64encode(sig).decode()}
+
+
+def devices_from_csv(path):
+    units = []
+    with open(path, newline="", encoding="utf-8") as f:
+        for row in csv.reader(f):
+            if not row or row[0].strip().startswith("#") or row[0].strip().lower() == "mac":
+                continue
+            mac = row[0].strip().replace(":", "").replace("-", "").upper()
+            if not MAC_RE.match(mac):
+                sys.exit("%s: not a MAC address: %r" % (path, row[0]))
+            units.append((mac, row[1].strip() if len(row) > 1 and row[1].strip() else None))
+    return units
+
+
+def make(args):
+    if not args.network:
+        sys.exit("at least one --network SSID PASSWORD is required")
+    if len(args.network) > MAX_NETWORKS:
+        sys.exit("at most %d networks" % MAX_NETWORKS)
+    for ssid, password in args.network:
+        if not 1 <= len(ssid.encode()) <= 32 or not (password == "" or 8 <= len(password) <= 64):
+            sys.exit("network %r: SSID 1..32 bytes, password empty or 8..64 characters" % ssid)
+    key = load_key(args.key)
+
+    if args.fleet:
+        units = [("*", None)]
+    elif args.device:
+        units = [(args.device.replace(":", "").upper(), None)]
+    else:
+        units = devices_from_csv(args.devices)
+
+    out = Path(args.out)
+    single = len(units) == 1 and out.suffix == ".json"
+    if not single:
+        out.mkdir(parents=True, exist_ok=True)
+    for mac, name in units:
+        bundle = sign(key, payload_for(args, mac, name or args.name))
+        path = out if single else out / ("fleet.json" if mac == "*" else mac + ".json")
+        path.parent.mkdir(parents=True, exist_ok=True)
+        path.write_text(json.dumps(bundle) + "\n", encoding="utf-8")
+        print("%s  %s" % (path, "all units" if mac == "*" else mac))
+    print("%d bundle(s), seq %d" % (len(units), args.seq))
+
+
+def read_bundle(path):
+    bundle = json.loads(Path(path).read_text(encoding="utf-8"))
+    if not isinstance(bundle.get("payload"), str) or not isinstance(bundle.get("sig"), str):
+        sys.exit("%s: not a bundle" % path)
+    return bundle
+
+
+def show(args):
+    bundle = read_bundle(args.bundle)
+    payload = base64.b64decode(bundle["payload"])
+    decoded = json.loads(payload)
+    for n in decoded.get("networks", []):
+        n["password"] = "*" * len(n.get("password", ""))
+    print(json.dumps(decoded, indent=2))
+    if args.key:
+        try:
+            load_key(args.key).public_key().verify(base64.b64decode(bundle["sig"]), payload,
+                                                   ec.ECDSA(hashes.SHA256()))
+            print("Signature: valid")
+        except InvalidSignature:
+            sys.exit("Signature: INVALID for this key")
+
+
+def send(args):
+    import serial  # pyserial
+
+    bundle = read_bundle(args.bundle)
+    line = ("bundle apply %s %s\n" % (bundle["payload"], bundle["sig"])).encode()
+    with serial.Serial(args.port, args.baud, timeout=0.2) as port:
+        port.reset_input_buffer()
+        # Paced: the console drains the UART from the service task, and the RX buffer is small
+        for i in range(0, len(line), 64):
+            port.write(line[i:i + 64])
+            port.flush()
+            time.sleep(0.02)
+        deadline = time.time() + args.timeout
+        buf = b""
+        while time.time() < deadline:
+            buf += port.read(256)
+            for reply in buf.decode(errors="replace").splitlines():
+                if reply.startswith("Bundle "):
+                    print(reply)
+                    return reply.startswith("Bundle applied")
+        print("No reply from the console within %.0f s" % args.timeout)
+        return False
+
+
+def upload(args):
+    bundle = read_bundle(args.bundle)
+    req = urllib.request.Request("http://%s/api/bundle" % args.host, data=json.dumps(bundle).encode(),
+                                 headers={"Content-Type": "application/json"}, method="POST")
+    try:
+        with urllib.request.urlopen(req, timeout=args.timeout) as resp:
+            body, status = resp.read(), resp.status
+    except urllib.error.HTTPError as e:
+        body, status = e.read(), e.code
+    print("%d %s" % (status, body.decode(errors="replace")))
+    return status == 200
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Create and deliver signed provisioning bundles")
+    sub = ap.add_subparsers(dest="cmd", required=True)
+
+    p = sub.add_parser("keygen", help="create the fleet signing key")
+    p.add_argument("--key", required=True, help="private key file to create (PEM)")
+    p.add_argument("--header", help="write the public key into this header (src/bundleKey.h)")
+
+    p = sub.add_parser("make", help="sign bundles")
+    p.add_argument("--key", required=True)
+    p.add_argument("--seq", type=int, required=True, help="must increase with every round")
+    p.add_argument("--network", nargs=2, action="append", metavar=("SSID", "PASSWORD"),
+                   help="repeat for more networks; the first is the primary")
+    p.add_argument("--name", help="device name template, e.g. heater-{mac4}; {mac} is the full MAC")
+    p.add_argument("--ntp", help="NTP server")
+    p.add_argument("--displays", help="JSON file with the config.json \"displays\" array")
+    who = p.add_mutually_exclusive_group(required=True)
+    who.add_argument("--devices", help="CSV with mac[,name] per unit")
+    who.add_argument("--device", help="one unit's MAC")
+    who.add_argument("--fleet", action="store_true", help="one bundle valid on every unit")
+    p.add_argument("--out", required=True, help="directory, or a .json file for a single bundle")
+
+    p = sub.add_parser("show", help="decode a bundle (passwords masked)")
+    p.add_argument("bundle")
+    p.add_argument("--key", help="also check the signature with this private key's public half")
+
+    p = sub.add_parser("send", help="apply over the USB serial console")
+    p.add_argument("bundle")
+    p.add_argument("--port", required=True)
+    p.add_argument("--baud", type=int, default=115200)
+    p.add_argument("--timeout", type=float, default=5.0)
+
+    p = sub.add_parser("upload", help="apply over HTTP (POST /api/bundle)")
+    p.add_argument("bundle")
+    p.add_argument("--host", required=True)
+    p.add_argument("--timeout", type=float, default=10.0)
+
+    args = ap.parse_args()
+    ok = {"keygen": keygen, "make": make, "show": show, "send": send, "upload": upload}[args.cmd](args)
+    sys.exit(0 if ok in (None, True) else 1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,12 @@
+# scripts/native_gfx_fonts.py
+# Put the Adafruit GFX Library's bundled fonts (Fonts/*.h) on the include path of [env:native].
+# The library itself stays out of the build (lib_ignore); its Adafruit_GFX.h is replaced by
+# test/native/host/Adafruit_GFX.h, which comes first on the include path.
+
+import os
+
+Import("env")  # noqa: F821 (provided by PlatformIO/SCons)
+
+env.Append(  # noqa: F821
+    CPPPATH=[os.path.join(env.subst("$PROJECT_LIBDEPS_DIR"), env.subst("$PIOENV"), "Adafruit GFX Library")]  # noqa: F821
+)
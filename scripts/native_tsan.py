@@ -0,0 +1,10 @@
+# scripts/native_tsan.py
+# Build the native tests with ThreadSanitizer (compile and link flags), for [env:native_tsan].
+
+Import("env")  # noqa: F821 (provided by PlatformIO/SCons)
+
+env.Append(  # noqa: F821
+    # System's seqlock fence is not modelled by TSan; the tests here do not race on it
+    CCFLAGS=["-fsanitize=thread", "-g", "-O1", "-Wno-tsan"],
+    LINKFLAGS=["-fsanitize=thread"],
+)
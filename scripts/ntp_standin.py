@@ -0,0 +1,65 @@
+#!/usr/bin/env python3
+# scripts/ntp_standin.py
+# Minimal SNTP server for bench-testing TimeSync without internet access.
+#
+# Usage:
+#   sudo python3 scripts/ntp_standin.py [--port 123] [--offset SECONDS] [--drift PPM]
+# then on the device console:  time server <this-host-ip>
+#
+# --offset shifts the served time (to check step corrections), --drift makes the served
+# clock run fast/slow so the device's drift estimate can be verified across resyncs.
+
+import argparse
+import socket
+import struct
+import time
+
+NTP_EPOCH_DELTA = 2208988800  # seconds between 1900-01-01 and 1970-01-01
+
+
+def to_ntp(ts):
+    secs = int(ts)
+    frac = int((ts - secs) * (1 << 32)) & 0xFFFFFFFF
+    return secs + NTP_EPOCH_DELTA, frac
+
+
+def main():
+    ap = argparse.ArgumentParser(description="SNTP stand-in for bench tests")
+    ap.add_argument("--port", type=int, default=123)
+    ap.add_argument("--offset", type=float, default=0.0, help="seconds added to the served time")
+    ap.add_argument("--drift", type=float, default=0.0, help="served clock rate error in ppm")
+    args = ap.parse_args()
+
+    start = time.time()
+
+    def served_now():
+        now = time.time()
+        return now + args.offset + (now - start) * args.drift * 1e-6
+
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.bind(("0.0.0.0", args.port))
+    print(f"[ntp_standin] listening on udp/{args.port} offset={args.offset}s drift={args.drift}ppm")
+
+    while True:
+        data, addr = sock.recvfrom(512)
+        recv = served_now()
+        if len(data) < 48:
+            continue
+        # Echo the client's transmit timestamp as originate timestamp
+        orig = data[40:48]
+        rs, rf = to_ntp(recv)
+        ts, tf = to_ntp(served_now())
+        # LI=0, VN=4, Mode=4 (server), stratum 1, poll 6, precision -20, refid "LOCL"
+        reply = struct.pack("!BBbb", 0x24, 1, 6, -20)
+        reply += struct.pack("!II", 0, 0)  # root delay / dispersion
+        reply += b"LOCL"
+        reply += struct.pack("!II", rs, rf)  # reference timestamp
+        reply += orig
+        reply += struct.pack("!II", rs, rf)  # receive timestamp
+        reply += struct.pack("!II", ts, tf)  # transmit timestamp
+        sock.sendto(reply, addr)
+        print(f"[ntp_standin] {addr[0]} <- {time.strftime('%Y-%m-%dT%H:%M:%SZ', time.gmtime(ts - NTP_EPOCH_DELTA))}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+# scripts/snapshot_goldens.py
+# Regenerates test/native/test_display_snapshot/goldens.h: the PNG and PBM bytes
+# DisplaySnapshot must produce for a few fixed framebuffers, built here with Python's
+# zlib (checksums) and checked by decoding them again.
+#
+# Usage:
+#   python3 scripts/snapshot_goldens.py > test/native/test_display_snapshot/goldens.h
+#
+# The framebuffer pattern must match framebufferByte() in the test.
+
+import struct
+import sys
+import zlib
+
+# (name, width, height): shapes worth pinning down
+IMAGES = [
+    ("PANEL_128X64", 128, 64),
+    ("PANEL_128X32", 128, 32),
+    ("ODD_13X8", 13, 8),
+]
+# Too large to embed; only its size and CRC32 are checked (two stored deflate blocks)
+LARGE = ("LARGE_1024X512", 1024, 512)
+
+
+def framebuffer_byte(i):
+    return (i * 37 + (i >> 7) * 11 + 5) & 0xFF
+
+
+def pixel(fb, width, x, y):
+    return (fb[x + (y // 8) * width] >> (y & 7)) & 1
+
+
+def framebuffer(width, height):
+    return bytes(framebuffer_byte(i) for i in range(width * ((height + 7) // 8)))
+
+
+def packed_rows(fb, width, height, lit):
+    for y in range(height):
+        row = bytearray((width + 7) // 8)
+        for x in range(width):
+            if pixel(fb, width, x, y) == lit:
+                row[x // 8] |= 0x80 >> (x & 7)
+        yield bytes(row)
+
+
+def chunk(kind, data):
+    return struct.pack(">I", len(data)) + kind + data + struct.pack(">I", zlib.crc32(kind + data))
+
+
+def png(fb, width, height):
+    raw = b"".join(b"\x00" + row for row in packed_rows(fb, width, height, 1))
+    stream = bytearray(b"\x78\x01")
+    for start in range(0, len(raw), 65535):
+        block = raw[start:start + 65535]
+        final = start + 65535 >= len(raw)
+        stream += struct.pack("<BHH", 1 if final else 0, len(block), len(block) ^ 0xFFFF) + block
+    stream += struct.pack(">I", zlib.adler32(raw))
+    assert zlib.decompress(bytes(stream)) == raw
+    ihdr = struct.pack(">IIBBBBB", width, height, 1, 0, 0, 0, 0)
+    return b"\x89PNG\r\n\x1a\n" + chunk(b"IHDR", ihdr) + chunk(b"IDAT", bytes(stream)) + chunk(b"IEND", b"")
+
+
+def pbm_ascii(fb, width, height):
+    rows = ("".join("0" if pixel(fb, width, x, y) else "1" for x in range(width)) + "\n" for y in range(height))
+    return ("P1\n%d %d\n" % (width, height) + "".join(rows)).encode()
+
+
+def pbm_raw(fb, width, height):
+    # PBM 1 = black: unlit pixels are set, padding bits stay clear
+    return ("P4\n%d %d\n" % (width, height)).encode() + b"".join(packed_rows(fb, width, height, 0))
+
+
+def emit(out, name, data):
+    out.write("    constexpr uint8_t %s[%d] = {\n" % (name, len(data)))
+    for i in range(0, len(data), 16):
+        out.write("        " + ", ".join("0x%02X" % b for b in data[i:i + 16]) + ",\n")
+    out.write("    };\n")
+
+
+def main():
+    out = sys.stdout
+    out.write("#pragma once\n")
+    out.write("// Generated by scripts/snapshot_goldens.py -- do not edit.\n\n")
+    out.write("#include <stdint.h>\n\n")
+    out.write("namespace Golden\n{\n")
+    for name, width, height in IMAGES:
+        fb = framebuffer(width, height)
+        emit(out, name + "_PNG", png(fb, width, height))
+        emit(out, name + "_P1", pbm_ascii(fb, width, height))
+        emit(out, name + "_P4", pbm_raw(fb, width, height))
+    name, width, height = LARGE
+    data = png(framebuffer(width, height), width, height)
+    out.write("    constexpr uint32_t %s_PNG_SIZE = %d;\n" % (name, len(data)))
+    out.write("    constexpr uint32_t %s_PNG_CRC32 = 0x%08X;\n" % (name, zlib.crc32(data)))
+    out.write("}\n")
+
+
+if __name__ == "__main__":
+    main()
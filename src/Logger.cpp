@@ -1,11 +1,17 @@
 #include "Logger.h"
-#include "System.h"
+#include "system.h"
+#include "crashLog.h"
 
 #include <stdio.h> // for snprintf
 
 static void formatTimestamp(char *buf, size_t bufsize)
 {
-    uint64_t ms = System::instance().getUptime();
+    // Wall time (UTC) once the clock is trustworthy, so logs from several units line up
+    System &sys = System::instance();
+    if (sys.timeValid() && System::formatIso8601(sys.now(), buf, bufsize))
+        return;
+
+    uint64_t ms = sys.getUptime();
 
     uint64_t total_seconds = ms / 1000ULL;
     uint64_t hours = total_seconds / 3600ULL;
@@ -27,8 +33,11 @@ Logger &Logger::instance()
     return inst;
 }
 
+constexpr size_t Logger::LINE_LEN;
+constexpr size_t Logger::QUEUE_DEPTH;
+
 Logger::Logger()
-    : level_(LogLevel::Info), initialized_(false)
+    : level_(LogLevel::Info), initialized_(false), writer_(nullptr), dropped_(0)
 {
 }
 
@@ -42,8 +51,8 @@ void Logger::init(unsigned long baud)
 
     Serial.begin(baud);
     // brief wait for Serial on boards that support it
-    unsigned long start = millis();
-    while (!Serial && (millis() - start) < 2000)
+    const uint64_t start = System::instance().monotonicMs();
+    while (!Serial && (System::instance().monotonicMs() - start) < 2000)
     {
         delay(5);
     }
@@ -69,9 +78,37 @@ void Logger::log(LogLevel level, const String &msg)
 
     const char *prefix = levelToString(level);
 
-    char ts[24];
+    char ts[32];
     formatTimestamp(ts, sizeof(ts));
 
+    // Formatted once, straight into the queue record; CrashLog keeps its own (shorter) copy
+    Line rec;
+    char *text = reinterpret_cast<char *>(rec.payload);
+    const int n = snprintf(text, Line::payloadSize(), "%s [%s] %s", ts, prefix, msg.c_str());
+    rec.kind = level;
+    rec.length = (uint16_t)((n < 0 ? 0 : min((size_t)n, Line::payloadSize() - 1)) + 1);
+    rec.timestampMs = (uint32_t)System::instance().monotonicMs();
+
+    // Keep the tail in RTC memory for post-mortem (see CrashLog)
+    CrashLog::instance().recordLine(text);
+
+    const TaskHandle_t writer = writer_.load(std::memory_order_acquire);
+    if (!writer || writer == xTaskGetCurrentTaskHandle())
+    {
+        // Keep the order: whatever other tasks queued was logged before this line
+        if (writer)
+            flush();
+        // Printed in pieces, so this path is not cut to LINE_LEN
+        print(ts, prefix, msg.c_str());
+        return;
+    }
+
+    if (!queue_.push(rec))
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void Logger::print(const char *ts, const char *prefix, const char *msg)
+{
     // print even if not initialized
     Serial.print(ts);
     Serial.print(" [");
@@ -80,6 +117,22 @@ void Logger::log(LogLevel level, const String &msg)
     Serial.println(msg);
 }
 
+void Logger::attachWriter()
+{
+    writer_.store(xTaskGetCurrentTaskHandle(), std::memory_order_release);
+}
+
+void Logger::flush()
+{
+    Line rec;
+    while (queue_.pop(rec))
+        Serial.println(rec.text());
+
+    const uint32_t dropped = dropped_.exchange(0, std::memory_order_relaxed);
+    if (dropped)
+        Serial.printf("[Logger] %lu lines dropped (queue full)\r\n", (unsigned long)dropped);
+}
+
 void Logger::debug(const String &msg) { log(LogLevel::Debug, msg); }
 void Logger::info(const String &msg) { log(LogLevel::Info, msg); }
 void Logger::warn(const String &msg) { log(LogLevel::Warn, msg); }
@@ -1,6 +1,10 @@
 #pragma once
 
 #include <Arduino.h>
+#include <atomic>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "lockFreeQueue.h"
 
 /**
  * @file Logger.h
@@ -11,7 +15,12 @@
  *  Logger::instance().info("Started");
  *  Logger::instance().setLevel(Logger::LogLevel::Debug);
  *
- * Thread-safety: minimal; safe for typical Arduino use.
+ * Thread-safety: log() may be called from any task. Until a writer task is attached
+ * (attachWriter()) lines go straight to Serial. Afterwards only the writer prints; other
+ * tasks format the line and push it into a lock-free MPSC queue, and the writer prints
+ * it at its next flush(). Queued lines are cut to LINE_LEN. When the queue is full,
+ * lines are counted as dropped and the count is reported at the next flush. Every line
+ * also goes into the CrashLog ring right away, whichever task logs it.
  */
 class Logger
 {
@@ -39,6 +48,11 @@ public:
     void warn(const String &msg);
     void error(const String &msg);
 
+    // Make the calling task the only one printing; it must call flush() regularly
+    void attachWriter();
+    // Print queued lines (writer task only)
+    void flush();
+
     // Configure level (default is Info)
     void setLevel(LogLevel level);
     LogLevel getLevel() const;
@@ -55,9 +69,19 @@ private:
     Logger(const Logger &) = delete;
     Logger &operator=(const Logger &) = delete;
 
+    static constexpr size_t LINE_LEN = 128;
+    static constexpr size_t QUEUE_DEPTH = 32;
+    using Line = Message<LogLevel, LINE_LEN>;
+
+    void print(const char *ts, const char *prefix, const char *msg);
+
     volatile LogLevel level_;
     volatile bool initialized_;
 
+    std::atomic<TaskHandle_t> writer_;
+    std::atomic<uint32_t> dropped_;
+    MpscQueue<Line, QUEUE_DEPTH> queue_;
+
     // Note: Logger no longer keeps its own startMillis_; it uses System::getUptime()
     // for timestamps so uptime is consistent across the project.
 };
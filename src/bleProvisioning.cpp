@@ -0,0 +1,218 @@
+/**
+ * @file bleProvisioning.cpp
+ * @brief GATT service, BT-task/service-task handoff and status snapshot for BLE provisioning.
+ */
+
+#include "bleProvisioning.h"
+
+#include <WiFi.h>
+#include "esp_random.h"
+#include "Logger.h"
+#include "system.h"
+#include "provisioning.h"
+
+#if DHC_BLE_PROVISIONING
+#include <BLEDevice.h>
+#include <BLEServer.h>
+#include <BLEUtils.h>
+#include <BLE2902.h>
+#endif
+
+constexpr const char *BleProvisioning::SERVICE_UUID;
+constexpr const char *BleProvisioning::RX_UUID;
+constexpr const char *BleProvisioning::TX_UUID;
+constexpr uint16_t BleProvisioning::MTU;
+
+#if DHC_BLE_PROVISIONING
+namespace
+{
+    class ServerCallbacks : public BLEServerCallbacks
+    {
+        void onConnect(BLEServer * /*server*/) override { BleProvisioning::instance().onConnect(); }
+        void onDisconnect(BLEServer * /*server*/) override { BleProvisioning::instance().onDisconnect(); }
+    };
+
+    class RxCallbacks : public BLECharacteristicCallbacks
+    {
+        void onWrite(BLECharacteristic *c) override
+        {
+            // std::string (Arduino core 2.x) or String (3.x); both expose c_str()/length()
+            auto value = c->getValue();
+            BleProvisioning::instance().onFrame(reinterpret_cast<const uint8_t *>(value.c_str()), value.length());
+        }
+    };
+}
+#endif
+
+BleProvisioning &BleProvisioning::instance()
+{
+    static BleProvisioning inst;
+    return inst;
+}
+
+BleProvisioning::BleProvisioning()
+    : protocol_([](uint8_t *buf, size_t len)
+                { esp_fill_random(buf, len); },
+                [this](const ProvisioningProtocol::Credentials &creds)
+                { return acceptCredentials(creds); },
+                [this]
+                { return currentStatus(); }),
+      running_(false), released_(false), pending_(), pendingValid_(false),
+      pendingMux_(portMUX_INITIALIZER_UNLOCKED), status_(0), ip_(0), connected_(false), frames_(0),
+      connections_(0), tx_(nullptr)
+{
+}
+
+bool BleProvisioning::start(const String &name, const String &pop)
+{
+#if DHC_BLE_PROVISIONING
+    if (running_)
+        return true;
+    if (released_)
+    {
+        Logger::instance().warn("BleProvisioning: Bluetooth memory already released; reboot to use BLE again");
+        return false;
+    }
+
+    pop_ = pop;
+    protocol_.setPop(pop_.c_str(), pop_.length());
+
+    BLEDevice::init(name.c_str());
+    BLEDevice::setMTU(MTU);
+    BLEServer *server = BLEDevice::createServer();
+    server->setCallbacks(new ServerCallbacks());
+
+    BLEService *service = server->createService(SERVICE_UUID);
+    BLECharacteristic *rx = service->createCharacteristic(RX_UUID, BLECharacteristic::PROPERTY_WRITE);
+    rx->setCallbacks(new RxCallbacks());
+    BLECharacteristic *tx = service->createCharacteristic(TX_UUID, BLECharacteristic::PROPERTY_READ |
+                                                                       BLECharacteristic::PROPERTY_NOTIFY);
+    tx->addDescriptor(new BLE2902());
+    tx_ = tx;
+    service->start();
+
+    BLEAdvertising *adv = BLEDevice::getAdvertising();
+    adv->addServiceUUID(SERVICE_UUID);
+    adv->setScanResponse(true);
+    BLEDevice::startAdvertising();
+
+    running_ = true;
+    Logger::instance().info(String("BleProvisioning: advertising as '") + name + "'");
+    return true;
+#else
+    (void)name;
+    (void)pop;
+    return false;
+#endif
+}
+
+void BleProvisioning::stop()
+{
+#if DHC_BLE_PROVISIONING
+    if (!running_)
+        return;
+    running_ = false;
+    tx_ = nullptr;
+    BLEDevice::deinit(true); // frees controller and host memory; no BLE until reboot
+    released_ = true;
+    protocol_.setPop(nullptr, 0);
+
+    portENTER_CRITICAL(&pendingMux_);
+    memset(&pending_, 0, sizeof(pending_));
+    pendingValid_ = false;
+    portEXIT_CRITICAL(&pendingMux_);
+    Logger::instance().info(String("BleProvisioning: stopped after ") + String(frames()) + " frames");
+#endif
+}
+
+void BleProvisioning::loop()
+{
+    if (!running_)
+        return;
+
+    Provisioning &prov = Provisioning::instance();
+    status_.store((uint32_t)prov.phase() | ((uint32_t)prov.failReason() << 8), std::memory_order_relaxed);
+    ip_.store(prov.phase() == Provisioning::Phase::Connected ? (uint32_t)WiFi.localIP() : 0, std::memory_order_relaxed);
+
+    if (!pendingValid_)
+        return;
+    ProvisioningProtocol::Credentials creds;
+    portENTER_CRITICAL(&pendingMux_);
+    creds = pending_;
+    memset(&pending_, 0, sizeof(pending_));
+    pendingValid_ = false;
+    portEXIT_CRITICAL(&pendingMux_);
+
+    Logger::instance().info(String("BleProvisioning: credentials for '") + creds.ssid + "' received");
+    if (!prov.tryCredentials(creds.ssid, creds.password, creds.deviceName))
+        Logger::instance().warn("BleProvisioning: a connection test is already running; credentials dropped");
+    memset(&creds, 0, sizeof(creds));
+}
+
+void BleProvisioning::onFrame(const uint8_t *data, size_t len)
+{
+#if DHC_BLE_PROVISIONING
+    frames_.fetch_add(1, std::memory_order_relaxed);
+    uint8_t reply[ProvisioningProtocol::MAX_FRAME];
+    const size_t n = protocol_.handle(data, len, reply, sizeof(reply), (uint32_t)System::instance().monotonicMs());
+
+    BLECharacteristic *tx = static_cast<BLECharacteristic *>(tx_);
+    if (!tx || n == 0)
+        return;
+    // Readable in full; the notification is cut to the MTU, so clients read after writing
+    tx->setValue(reply, n);
+    tx->notify();
+#else
+    (void)data;
+    (void)len;
+#endif
+}
+
+void BleProvisioning::onConnect()
+{
+    connected_.store(true, std::memory_order_relaxed);
+    connections_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void BleProvisioning::onDisconnect()
+{
+#if DHC_BLE_PROVISIONING
+    connected_.store(false, std::memory_order_relaxed);
+    protocol_.reset();
+    // Advertising stops on connect; offer the service again
+    if (running_)
+        BLEDevice::startAdvertising();
+#endif
+}
+
+ProvisioningProtocol::Result BleProvisioning::acceptCredentials(const ProvisioningProtocol::Credentials &creds)
+{
+    if ((Provisioning::Phase)(status_.load(std::memory_order_relaxed) & 0xFF) == Provisioning::Phase::Testing)
+        return ProvisioningProtocol::Result::Busy;
+
+    ProvisioningProtocol::Result result = ProvisioningProtocol::Result::Busy;
+    portENTER_CRITICAL(&pendingMux_);
+    if (!pendingValid_)
+    {
+        pending_ = creds;
+        pendingValid_ = true;
+        result = ProvisioningProtocol::Result::Accepted;
+    }
+    portEXIT_CRITICAL(&pendingMux_);
+    return result;
+}
+
+ProvisioningProtocol::Status BleProvisioning::currentStatus() const
+{
+    ProvisioningProtocol::Status s;
+    const uint32_t st = status_.load(std::memory_order_relaxed);
+    const uint32_t ip = ip_.load(std::memory_order_relaxed);
+    s.phase = (uint8_t)st;
+    s.reason = (uint8_t)(st >> 8);
+    // IPAddress keeps the address in network order: first octet in the low byte
+    s.ip[0] = (uint8_t)ip;
+    s.ip[1] = (uint8_t)(ip >> 8);
+    s.ip[2] = (uint8_t)(ip >> 16);
+    s.ip[3] = (uint8_t)(ip >> 24);
+    return s;
+}
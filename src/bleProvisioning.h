@@ -0,0 +1,91 @@
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+#include "freertos/FreeRTOS.h"
+#include "provisioningProtocol.h"
+
+/**
+ * @file bleProvisioning.h
+ * @brief BLE GATT transport for ProvisioningProtocol, next to the SoftAP captive portal.
+ *
+ * A phone provisions over BLE without leaving its own WiFi network, so there is no
+ * captive-portal detection and no lost internet connection. The GATT service has two
+ * characteristics:
+ *  - RX (write): the client writes one protocol frame;
+ *  - TX (read, notify): the device's reply to that frame, notified when it fits the MTU.
+ * scripts/ble_provision.py is a reference client.
+ *
+ * Frames are handled in the Bluetooth stack's task. Accepted credentials are only
+ * copied to a pending slot there; loop() (service task) hands them to
+ * Provisioning::tryCredentials(), the same live trial as the web portal, and keeps the
+ * status snapshot that GET_STATUS reports up to date.
+ *
+ * stop() gives the Bluetooth stack's memory back for good; BLE provisioning can then
+ * only run again after a reboot, which is all first-boot provisioning needs.
+ *
+ * Build with DHC_BLE_PROVISIONING=0 to leave BLE (and its flash and RAM) out.
+ */
+
+#ifndef DHC_BLE_PROVISIONING
+#define DHC_BLE_PROVISIONING 1
+#endif
+
+class BleProvisioning
+{
+public:
+    static constexpr const char *SERVICE_UUID = "6e7d0001-3c4a-4b8e-9d2f-5a1c0b7e4f10";
+    static constexpr const char *RX_UUID = "6e7d0002-3c4a-4b8e-9d2f-5a1c0b7e4f10";
+    static constexpr const char *TX_UUID = "6e7d0003-3c4a-4b8e-9d2f-5a1c0b7e4f10";
+    static constexpr uint16_t MTU = 185;
+
+    static BleProvisioning &instance();
+
+    static constexpr bool compiledIn() { return DHC_BLE_PROVISIONING != 0; }
+
+    // Advertise as `name`; clients must know `pop`. Service task.
+    bool start(const String &name, const String &pop);
+    void stop();
+    void loop();
+
+    bool running() const { return running_; }
+    const String &pop() const { return pop_; }
+    bool clientConnected() const { return connected_.load(std::memory_order_relaxed); }
+    uint32_t frames() const { return frames_.load(std::memory_order_relaxed); }
+    uint32_t connections() const { return connections_.load(std::memory_order_relaxed); }
+    uint8_t authFailures() const { return protocol_.authFailures(); }
+
+    // Called from the Bluetooth stack's task
+    void onFrame(const uint8_t *data, size_t len);
+    void onConnect();
+    void onDisconnect();
+
+private:
+    BleProvisioning();
+    ~BleProvisioning() = default;
+    BleProvisioning(const BleProvisioning &) = delete;
+    BleProvisioning &operator=(const BleProvisioning &) = delete;
+
+    ProvisioningProtocol::Result acceptCredentials(const ProvisioningProtocol::Credentials &creds);
+    ProvisioningProtocol::Status currentStatus() const;
+
+    ProvisioningProtocol protocol_;
+    String pop_;
+    bool running_;
+    bool released_; // controller memory given back; no restart before reboot
+
+    // Credentials handed from the BT task to loop()
+    ProvisioningProtocol::Credentials pending_;
+    bool pendingValid_;
+    mutable portMUX_TYPE pendingMux_;
+
+    // Snapshot for GET_STATUS, refreshed by loop()
+    std::atomic<uint32_t> status_; // phase | reason << 8
+    std::atomic<uint32_t> ip_;
+
+    std::atomic<bool> connected_;
+    std::atomic<uint32_t> frames_;
+    std::atomic<uint32_t> connections_;
+
+    void *tx_; // BLECharacteristic *, kept opaque so this header needs no BLE includes
+};
@@ -0,0 +1,113 @@
+/**
+ * @file bufferAllocator.cpp
+ * @brief Internal/PSRAM placement policy, block headers and accounting.
+ *
+ * Platform-free: the heap and the log go through the Backend (see bufferHeap.cpp).
+ */
+
+#include "bufferAllocator.h"
+
+#include <stdio.h>
+
+constexpr size_t BufferAllocator::PSRAM_MIN_BYTES;
+constexpr size_t BufferAllocator::HOST_PSRAM_BYTES;
+
+namespace
+{
+    constexpr uint16_t HEADER_MAGIC = 0xB0FA;
+}
+
+BufferAllocator &BufferAllocator::instance()
+{
+    static BufferAllocator inst;
+    return inst;
+}
+
+BufferAllocator::BufferAllocator()
+    : backend_(&platformBackend()), psramTotal_(0), psramEnabled_(true)
+{
+    psramTotal_ = backend_->totalBytes(Region::Psram);
+}
+
+void BufferAllocator::setBackend(const Backend *backend)
+{
+    backend_ = backend ? backend : &platformBackend();
+    psramTotal_ = backend_->totalBytes(Region::Psram);
+}
+
+void BufferAllocator::begin()
+{
+    static_assert(sizeof(Header) == 8, "BufferAllocator header must keep 8-byte payload alignment");
+    char line[96];
+    if (psramTotal_)
+        snprintf(line, sizeof(line), "BufferAllocator: PSRAM %u KiB (%u KiB free), large buffers go there",
+                 (unsigned)(psramTotal_ / 1024), (unsigned)(freeBytes(Region::Psram) / 1024));
+    else
+        snprintf(line, sizeof(line), "BufferAllocator: no PSRAM, all buffers internal");
+    backend_->report(false, line);
+}
+
+void *BufferAllocator::allocate(size_t size, Placement placement, MemoryAccounting::ModuleId who)
+{
+    Region region = Region::Internal;
+    if (psramAvailable() &&
+        (placement == Placement::Psram || (placement == Placement::Large && size >= PSRAM_MIN_BYTES)))
+        region = Region::Psram;
+
+    const size_t bytes = sizeof(Header) + size;
+    void *raw = backend_->allocate(bytes, region, placement == Placement::Dma);
+    if (!raw && region == Region::Psram)
+    {
+        // PSRAM full: a latency-tolerant buffer still works from internal SRAM
+        region = Region::Internal;
+        raw = backend_->allocate(bytes, region, false);
+    }
+    if (!raw)
+    {
+        MemoryAccounting::instance().failed(who);
+        return nullptr;
+    }
+
+    Header *h = static_cast<Header *>(raw);
+    h->size = (uint32_t)size;
+    h->module = who;
+    h->region = region;
+    h->magic = HEADER_MAGIC;
+    MemoryAccounting::instance().add(who, size, region == Region::Psram);
+    return h + 1;
+}
+
+void BufferAllocator::release(void *p)
+{
+    if (!p)
+        return;
+    Header *h = static_cast<Header *>(p) - 1;
+    if (h->magic != HEADER_MAGIC)
+    {
+        backend_->report(true, "BufferAllocator: release of a foreign or corrupted block ignored");
+        return;
+    }
+    h->magic = 0;
+    MemoryAccounting::instance().remove(h->module, h->size, h->region == Region::Psram);
+    backend_->free(h, h->region, sizeof(Header) + h->size);
+}
+
+size_t BufferAllocator::sizeOf(const void *p)
+{
+    return p ? (static_cast<const Header *>(p) - 1)->size : 0;
+}
+
+BufferAllocator::Region BufferAllocator::regionOf(const void *p)
+{
+    return p ? (static_cast<const Header *>(p) - 1)->region : Region::Internal;
+}
+
+size_t BufferAllocator::freeBytes(Region region) const
+{
+    return backend_->freeBytes(region);
+}
+
+size_t BufferAllocator::totalBytes(Region region) const
+{
+    return region == Region::Psram ? psramTotal_ : backend_->totalBytes(region);
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <stddef.h>
+#include <stdint.h>
+#include "memoryAccounting.h"
+
+/**
+ * @file bufferAllocator.h
+ * @brief Singleton that places buffers in internal SRAM or PSRAM by declared use.
+ *
+ * Each allocation site states what its buffer needs:
+ *  - Internal: hot data, or anything touched while the flash cache is disabled.
+ *  - Dma: internal and DMA-capable (peripheral descriptors and buffers).
+ *  - Large: latency-tolerant; PSRAM when present and the buffer is at least
+ *    PSRAM_MIN_BYTES, internal otherwise (telemetry history, file caches, JSON
+ *    documents, display back buffers).
+ *  - Psram: PSRAM whenever present, whatever the size.
+ * Without PSRAM (or with setPsramEnabled(false)) everything lands in internal SRAM,
+ * so call sites do not need to care which devkit variant they run on.
+ *
+ * Every block carries a small header with its size, region and owning module, so
+ * release() needs only the pointer and MemoryAccounting reports internal and PSRAM
+ * bytes per module.
+ *
+ * The placement policy, headers and accounting here are plain C++. The heap itself is
+ * a Backend of function pointers; platformBackend() (bufferHeap.cpp) is heap_caps on
+ * the ESP32 and, on the host, malloc with HOST_PSRAM_BYTES of pretend PSRAM, so the
+ * policies can be exercised off-target. Tests may install their own with setBackend().
+ *
+ * Any task; not from ISRs.
+ */
+class BufferAllocator
+{
+public:
+    enum class Placement : uint8_t
+    {
+        Internal,
+        Dma,
+        Large,
+        Psram
+    };
+
+    enum class Region : uint8_t
+    {
+        Internal,
+        Psram
+    };
+
+    static constexpr size_t PSRAM_MIN_BYTES = 512;
+    static constexpr size_t HOST_PSRAM_BYTES = 2 * 1024 * 1024;
+
+    // Where the bytes come from; every member must be set
+    struct Backend
+    {
+        void *(*allocate)(size_t bytes, Region region, bool dma); // nullptr when out of memory
+        void (*free)(void *raw, Region region, size_t bytes);
+        size_t (*freeBytes)(Region region);
+        size_t (*totalBytes)(Region region); // 0 for Psram = not fitted
+        void (*report)(bool error, const char *message); // log line from the allocator
+    };
+
+    static const Backend &platformBackend();
+
+    static BufferAllocator &instance();
+
+    // Swap the heap (nullptr = platformBackend()); only while no block is outstanding
+    void setBackend(const Backend *backend);
+
+    // Detect PSRAM and log what is available
+    void begin();
+
+    // nullptr on failure (counted against `who`)
+    void *allocate(size_t size, Placement placement,
+                   MemoryAccounting::ModuleId who = MemoryAccounting::INVALID_MODULE);
+    void release(void *p);
+
+    // Only for pointers returned by allocate()
+    static size_t sizeOf(const void *p);
+    static Region regionOf(const void *p);
+
+    bool psramAvailable() const { return psramTotal_ > 0 && psramEnabled_; }
+    // Route all Large/Psram requests to internal SRAM (diagnostics); takes effect for new allocations
+    void setPsramEnabled(bool enabled) { psramEnabled_ = enabled; }
+
+    size_t freeBytes(Region region) const;
+    size_t totalBytes(Region region) const;
+
+private:
+    BufferAllocator();
+    ~BufferAllocator() = default;
+    BufferAllocator(const BufferAllocator &) = delete;
+    BufferAllocator &operator=(const BufferAllocator &) = delete;
+
+    struct Header
+    {
+        uint32_t size;
+        MemoryAccounting::ModuleId module;
+        Region region;
+        uint16_t magic; // catches release() of foreign pointers
+    };
+
+    const Backend *backend_;
+    size_t psramTotal_;
+    volatile bool psramEnabled_;
+};
+
+// unique_ptr support: BufferPtr<uint8_t[]> buf(static_cast<uint8_t *>(BufferAllocator::instance().allocate(...)));
+struct BufferDeleter
+{
+    void operator()(void *p) const { BufferAllocator::instance().release(p); }
+};
+
+template <typename T>
+using BufferPtr = std::unique_ptr<T, BufferDeleter>;
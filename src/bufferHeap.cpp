@@ -0,0 +1,94 @@
+/**
+ * @file bufferHeap.cpp
+ * @brief BufferAllocator's platform glue: heap_caps and Logger on the ESP32, malloc with a
+ *        simulated PSRAM budget on the host.
+ */
+
+#include "bufferAllocator.h"
+
+#include <stdlib.h>
+#include "Logger.h"
+
+#if defined(ESP_PLATFORM)
+#include "esp_heap_caps.h"
+#endif
+
+namespace
+{
+    using Region = BufferAllocator::Region;
+
+#if defined(ESP_PLATFORM)
+    void *heapAllocate(size_t bytes, Region region, bool dma)
+    {
+        if (region == Region::Psram)
+            return heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        return heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT | (dma ? MALLOC_CAP_DMA : 0));
+    }
+
+    void heapFree(void *raw, Region, size_t)
+    {
+        heap_caps_free(raw);
+    }
+
+    size_t heapFreeBytes(Region region)
+    {
+        return heap_caps_get_free_size(region == Region::Psram ? MALLOC_CAP_SPIRAM : (MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT));
+    }
+
+    size_t heapTotalBytes(Region region)
+    {
+        return heap_caps_get_total_size(region == Region::Psram ? MALLOC_CAP_SPIRAM : (MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT));
+    }
+#else
+    std::atomic<size_t> hostPsramUsed{0};
+
+    void *heapAllocate(size_t bytes, Region region, bool)
+    {
+        if (region == Region::Psram)
+        {
+            // Simulated PSRAM budget so exhaustion and fallback behave as on target
+            size_t used = hostPsramUsed.load(std::memory_order_relaxed);
+            do
+            {
+                if (used + bytes > BufferAllocator::HOST_PSRAM_BYTES)
+                    return nullptr;
+            } while (!hostPsramUsed.compare_exchange_weak(used, used + bytes, std::memory_order_relaxed));
+        }
+        void *raw = malloc(bytes);
+        if (!raw && region == Region::Psram)
+            hostPsramUsed.fetch_sub(bytes, std::memory_order_relaxed);
+        return raw;
+    }
+
+    void heapFree(void *raw, Region region, size_t bytes)
+    {
+        if (region == Region::Psram)
+            hostPsramUsed.fetch_sub(bytes, std::memory_order_relaxed);
+        free(raw);
+    }
+
+    size_t heapFreeBytes(Region region)
+    {
+        return region == Region::Psram ? BufferAllocator::HOST_PSRAM_BYTES - hostPsramUsed.load(std::memory_order_relaxed) : 0;
+    }
+
+    size_t heapTotalBytes(Region region)
+    {
+        return region == Region::Psram ? BufferAllocator::HOST_PSRAM_BYTES : 0;
+    }
+#endif
+
+    void heapReport(bool error, const char *message)
+    {
+        if (error)
+            Logger::instance().error(message);
+        else
+            Logger::instance().info(message);
+    }
+}
+
+const BufferAllocator::Backend &BufferAllocator::platformBackend()
+{
+    static const Backend backend = {heapAllocate, heapFree, heapFreeBytes, heapTotalBytes, heapReport};
+    return backend;
+}
@@ -0,0 +1,12 @@
+#pragma once
+
+/**
+ * @file bundleKey.h
+ * @brief Public key that signed provisioning bundles are verified against (PEM, ECDSA P-256).
+ *
+ * Replace with your fleet key: `python3 scripts/make_bundle.py keygen --key fleet-key.pem
+ * --header src/bundleKey.h` (keep the private key off the repository). Empty: every
+ * bundle is refused.
+ */
+
+static const char BUNDLE_PUBLIC_KEY_PEM[] = "";
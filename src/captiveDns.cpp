@@ -0,0 +1,343 @@
+/**
+ * @file captiveDns.cpp
+ * @brief Captive DNS task: drain-per-wake receive loop and in-place reply building.
+ */
+
+#include "captiveDns.h"
+
+#if defined(ESP_PLATFORM)
+#include "lwip/sockets.h"
+#else
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#endif
+
+#include "Logger.h"
+#include "taskLayout.h"
+#include "trace.h"
+
+constexpr uint16_t CaptiveDns::DNS_PORT;
+constexpr uint32_t CaptiveDns::TTL_S;
+constexpr uint32_t CaptiveDns::NEG_TTL_S;
+constexpr uint16_t CaptiveDns::MAX_BATCH;
+constexpr size_t CaptiveDns::MAX_PACKET;
+constexpr uint32_t CaptiveDns::RECV_TIMEOUT_MS;
+constexpr size_t CaptiveDns::REPLY_BUFFER;
+constexpr size_t CaptiveDns::A_TAIL_LEN;
+constexpr size_t CaptiveDns::SOA_TAIL_LEN;
+
+namespace
+{
+    constexpr size_t HEADER_LEN = 12;
+    constexpr size_t MAX_NAME_LEN = 255;
+
+    constexpr uint16_t TYPE_A = 1;
+    constexpr uint16_t TYPE_SOA = 6;
+    constexpr uint16_t TYPE_ANY = 255;
+    constexpr uint16_t CLASS_IN = 1;
+
+    constexpr uint8_t RCODE_FORMERR = 1;
+    constexpr uint8_t RCODE_NOTIMP = 4;
+
+    uint8_t *put16(uint8_t *p, uint16_t v)
+    {
+        p[0] = (uint8_t)(v >> 8);
+        p[1] = (uint8_t)v;
+        return p + 2;
+    }
+
+    uint8_t *put32(uint8_t *p, uint32_t v)
+    {
+        p = put16(p, (uint16_t)(v >> 16));
+        return put16(p, (uint16_t)v);
+    }
+
+    uint16_t get16(const uint8_t *p)
+    {
+        return (uint16_t)((p[0] << 8) | p[1]);
+    }
+
+    // Header-only reply (no question) carrying just an error code
+    size_t headerOnly(const uint8_t *query, uint8_t *out, uint8_t rcode)
+    {
+        memcpy(out, query, 4);
+        out[2] = (uint8_t)(0x80 | (query[2] & 0x79)); // QR; keep opcode and RD
+        out[3] = (uint8_t)(0x80 | rcode);              // RA
+        memset(out + 4, 0, HEADER_LEN - 4);
+        return HEADER_LEN;
+    }
+}
+
+CaptiveDns &CaptiveDns::instance()
+{
+    static CaptiveDns inst;
+    return inst;
+}
+
+CaptiveDns::CaptiveDns()
+    : aTail_(), soaTail_(), sock_(-1), task_(nullptr), running_(false), stopRequested_(false),
+      queries_(0), answered_(0), negative_(0), rejected_(0), dropped_(0), wakes_(0), maxBatch_(0)
+{
+}
+
+bool CaptiveDns::start(IPAddress portalIp, uint16_t port)
+{
+    if (running())
+    {
+        if (!stopRequested_.load(std::memory_order_relaxed))
+            return true;
+        Logger::instance().warn("CaptiveDns: previous responder still stopping");
+        return false;
+    }
+
+    buildTemplates(portalIp);
+
+    sock_ = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (sock_ < 0)
+    {
+        Logger::instance().error("CaptiveDns: socket() failed");
+        return false;
+    }
+
+    sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (bind(sock_, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) < 0)
+    {
+        Logger::instance().error(String("CaptiveDns: bind to port ") + String(port) + " failed");
+        close(sock_);
+        sock_ = -1;
+        return false;
+    }
+
+    // Bounded wait so the task sees stop() without anyone closing the socket under it
+    timeval tv = {};
+    tv.tv_sec = RECV_TIMEOUT_MS / 1000;
+    tv.tv_usec = (RECV_TIMEOUT_MS % 1000) * 1000;
+    setsockopt(sock_, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+
+    stopRequested_.store(false, std::memory_order_relaxed);
+    running_.store(true, std::memory_order_release);
+    if (xTaskCreatePinnedToCore(&CaptiveDns::taskEntry, "dns", TaskLayout::DNS_STACK, this,
+                                TaskLayout::DNS_PRIORITY, &task_, TaskLayout::DNS_CORE) != pdPASS)
+    {
+        task_ = nullptr;
+        running_.store(false, std::memory_order_release);
+        close(sock_);
+        sock_ = -1;
+        Logger::instance().error("CaptiveDns: failed to start task");
+        return false;
+    }
+
+    Logger::instance().info(String("CaptiveDns: answering port ") + String(port) + " with " + portalIp.toString());
+    return true;
+}
+
+void CaptiveDns::stop()
+{
+    if (!running())
+        return;
+    stopRequested_.store(true, std::memory_order_relaxed);
+
+    // The task closes its own socket; it notices within one receive timeout
+    const uint32_t waitMs = 2 * RECV_TIMEOUT_MS + 50;
+    for (uint32_t waited = 0; running() && waited < waitMs; waited += 10)
+        vTaskDelay(pdMS_TO_TICKS(10));
+
+    if (running())
+        Logger::instance().warn("CaptiveDns: task did not stop in time");
+    else
+        Logger::instance().info(String("CaptiveDns: stopped after ") + String(queries_.load(std::memory_order_relaxed)) +
+                                " queries");
+}
+
+void CaptiveDns::taskEntry(void *arg)
+{
+    CaptiveDns *self = static_cast<CaptiveDns *>(arg);
+    self->run();
+
+    close(self->sock_);
+    self->sock_ = -1;
+    self->task_ = nullptr;
+    self->running_.store(false, std::memory_order_release);
+    vTaskDelete(nullptr);
+}
+
+void CaptiveDns::run()
+{
+    uint8_t rx[MAX_PACKET];
+    uint8_t tx[REPLY_BUFFER];
+
+    while (!stopRequested_.load(std::memory_order_relaxed))
+    {
+        sockaddr_in from = {};
+        socklen_t fromLen = sizeof(from);
+        int n = recvfrom(sock_, rx, sizeof(rx), 0, reinterpret_cast<sockaddr *>(&from), &fromLen);
+        if (n < 0)
+            continue; // receive timeout
+
+        TRACE_SCOPE("dns");
+        uint16_t batch = 0;
+        while (n >= 0)
+        {
+            Outcome outcome;
+            const size_t replyLen = answer(rx, (size_t)n, tx, sizeof(tx), outcome);
+            if (replyLen &&
+                sendto(sock_, tx, replyLen, 0, reinterpret_cast<const sockaddr *>(&from), fromLen) < 0)
+                outcome = Outcome::Dropped;
+            count(outcome);
+
+            if (++batch >= MAX_BATCH)
+                break;
+            fromLen = sizeof(from);
+            n = recvfrom(sock_, rx, sizeof(rx), MSG_DONTWAIT, reinterpret_cast<sockaddr *>(&from), &fromLen);
+        }
+
+        wakes_.fetch_add(1, std::memory_order_relaxed);
+        if (batch > maxBatch_.load(std::memory_order_relaxed))
+            maxBatch_.store(batch, std::memory_order_relaxed);
+
+        // A full batch means a flood: leave a tick for the service task on this core
+        if (batch >= MAX_BATCH)
+            vTaskDelay(1);
+    }
+}
+
+size_t CaptiveDns::answer(const uint8_t *query, size_t len, uint8_t *out, size_t outSize, Outcome &outcome) const
+{
+    outcome = Outcome::Dropped;
+    if (len < HEADER_LEN || outSize < HEADER_LEN)
+        return 0;
+    if (query[2] & 0x80) // QR set: a response, never answer those
+        return 0;
+
+    const uint8_t opcode = (query[2] >> 3) & 0x0F;
+    if (opcode != 0)
+    {
+        outcome = Outcome::Rejected;
+        return headerOnly(query, out, RCODE_NOTIMP);
+    }
+    if (get16(query + 4) != 1)
+    {
+        outcome = Outcome::Rejected;
+        return headerOnly(query, out, RCODE_FORMERR);
+    }
+
+    // Walk the question name; queries never compress it
+    size_t pos = HEADER_LEN;
+    for (;;)
+    {
+        if (pos >= len || pos - HEADER_LEN > MAX_NAME_LEN)
+            return 0;
+        const uint8_t label = query[pos];
+        if (label == 0)
+            break;
+        if (label & 0xC0)
+            return 0;
+        pos += 1 + label;
+    }
+    const size_t questionEnd = pos + 1 + 4;
+    if (questionEnd > len || questionEnd + SOA_TAIL_LEN > outSize)
+        return 0;
+    const uint16_t qtype = get16(query + pos + 1);
+    const uint16_t qclass = get16(query + pos + 3);
+
+    // Header and question verbatim; additional records (EDNS OPT) are not echoed
+    memcpy(out, query, questionEnd);
+    out[2] = (uint8_t)(0x80 | (query[2] & 0x79) | 0x04); // QR, AA; keep opcode and RD
+    out[3] = 0x80;                                        // RA, NOERROR
+
+    uint8_t *p = out + questionEnd;
+    if (qclass == CLASS_IN && (qtype == TYPE_A || qtype == TYPE_ANY))
+    {
+        put16(out + 6, 1); // ANCOUNT
+        put16(out + 8, 0);
+        memcpy(p, aTail_, A_TAIL_LEN);
+        p += A_TAIL_LEN;
+        outcome = Outcome::Answered;
+    }
+    else
+    {
+        put16(out + 6, 0);
+        put16(out + 8, 1); // NSCOUNT: the SOA that makes the NODATA cacheable
+        memcpy(p, soaTail_, SOA_TAIL_LEN);
+        p += SOA_TAIL_LEN;
+        outcome = Outcome::Negative;
+    }
+    put16(out + 10, 0);
+    return (size_t)(p - out);
+}
+
+void CaptiveDns::buildTemplates(IPAddress portalIp)
+{
+    // Owner is the question name (pointer to offset 12) in both records
+    uint8_t *p = aTail_;
+    p = put16(p, 0xC000 | HEADER_LEN);
+    p = put16(p, TYPE_A);
+    p = put16(p, CLASS_IN);
+    p = put32(p, TTL_S);
+    p = put16(p, 4);
+    for (int i = 0; i < 4; ++i)
+        *p++ = portalIp[i];
+
+    p = soaTail_;
+    p = put16(p, 0xC000 | HEADER_LEN);
+    p = put16(p, TYPE_SOA);
+    p = put16(p, CLASS_IN);
+    p = put32(p, NEG_TTL_S);
+    p = put16(p, 2 + 5 * 4);
+    *p++ = 0; // MNAME: root
+    *p++ = 0; // RNAME: root
+    p = put32(p, 1);         // serial
+    p = put32(p, 3600);      // refresh
+    p = put32(p, 600);       // retry
+    p = put32(p, 86400);     // expire
+    p = put32(p, NEG_TTL_S); // minimum: negative-caching TTL
+}
+
+void CaptiveDns::count(Outcome outcome)
+{
+    queries_.fetch_add(1, std::memory_order_relaxed);
+    switch (outcome)
+    {
+    case Outcome::Answered:
+        answered_.fetch_add(1, std::memory_order_relaxed);
+        break;
+    case Outcome::Negative:
+        negative_.fetch_add(1, std::memory_order_relaxed);
+        break;
+    case Outcome::Rejected:
+        rejected_.fetch_add(1, std::memory_order_relaxed);
+        break;
+    case Outcome::Dropped:
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        break;
+    }
+}
+
+CaptiveDns::Stats CaptiveDns::stats() const
+{
+    Stats s;
+    s.queries = queries_.load(std::memory_order_relaxed);
+    s.answered = answered_.load(std::memory_order_relaxed);
+    s.negative = negative_.load(std::memory_order_relaxed);
+    s.rejected = rejected_.load(std::memory_order_relaxed);
+    s.dropped = dropped_.load(std::memory_order_relaxed);
+    s.wakes = wakes_.load(std::memory_order_relaxed);
+    s.maxBatch = maxBatch_.load(std::memory_order_relaxed);
+    return s;
+}
+
+void CaptiveDns::resetStats()
+{
+    queries_.store(0, std::memory_order_relaxed);
+    answered_.store(0, std::memory_order_relaxed);
+    negative_.store(0, std::memory_order_relaxed);
+    rejected_.store(0, std::memory_order_relaxed);
+    dropped_.store(0, std::memory_order_relaxed);
+    wakes_.store(0, std::memory_order_relaxed);
+    maxBatch_.store(0, std::memory_order_relaxed);
+}
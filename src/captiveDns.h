@@ -0,0 +1,106 @@
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+/**
+ * @file captiveDns.h
+ * @brief Captive-portal DNS responder on its own task: every name resolves to the portal.
+ *
+ * Phones fire a burst of DNS probes (A, AAAA, HTTPS, several hostnames) the moment they
+ * join the provisioning AP, and give up on captive-portal detection if those stall.
+ * Polling one query per service pass let that burst queue up, so the responder runs on
+ * a dedicated task blocked in recvfrom() and, once woken, drains every datagram already
+ * queued on the socket (up to MAX_BATCH) before sleeping again.
+ *
+ * Replies are built in place from the query:
+ *  - A (and ANY) in class IN: the query's header and question, then a precomputed
+ *    answer record pointing at the portal IP.
+ *  - Any other type (AAAA, HTTPS/SVCB, ...): NOERROR with no answer and a precomputed
+ *    SOA, so clients fall back to IPv4 at once and cache the negative for NEG_TTL_S.
+ *  - Non-QUERY opcodes or question counts other than one: header-only NOTIMP/FORMERR.
+ *  - Responses and packets too short or malformed to parse are dropped.
+ * answer() is the whole protocol part and touches no socket.
+ *
+ * start()/stop() from the service task (Provisioning); stats() from any task.
+ */
+class CaptiveDns
+{
+public:
+    static constexpr uint16_t DNS_PORT = 53;
+    static constexpr uint32_t TTL_S = 60;
+    static constexpr uint32_t NEG_TTL_S = 30;
+    static constexpr uint16_t MAX_BATCH = 32;        // datagrams answered per wake before yielding
+    static constexpr size_t MAX_PACKET = 512;        // classic DNS over UDP; longer datagrams are truncated
+    static constexpr uint32_t RECV_TIMEOUT_MS = 250; // how quickly the task notices stop()
+
+    struct Stats
+    {
+        uint32_t queries = 0;  // datagrams received
+        uint32_t answered = 0; // A/ANY answered with the portal IP
+        uint32_t negative = 0; // NODATA (AAAA, HTTPS, ...)
+        uint32_t rejected = 0; // NOTIMP / FORMERR
+        uint32_t dropped = 0;  // unparseable, responses, send failures
+        uint32_t wakes = 0;    // recvfrom() wake-ups that found work
+        uint16_t maxBatch = 0; // most datagrams drained in one wake
+    };
+
+    enum class Outcome : uint8_t
+    {
+        Answered,
+        Negative,
+        Rejected,
+        Dropped
+    };
+
+    static CaptiveDns &instance();
+
+    bool start(IPAddress portalIp, uint16_t port = DNS_PORT);
+    void stop();
+    bool running() const { return running_.load(std::memory_order_acquire); }
+
+    Stats stats() const;
+    void resetStats();
+
+    /**
+     * Build the reply to `query` in `out` (REPLY_BUFFER bytes always suffice). Returns
+     * the reply length, 0 when the query is to be dropped; `outcome` says which.
+     */
+    size_t answer(const uint8_t *query, size_t len, uint8_t *out, size_t outSize, Outcome &outcome) const;
+
+    // Reply buffer size that always fits a reply to a MAX_PACKET query
+    static constexpr size_t REPLY_BUFFER = MAX_PACKET + 48;
+
+private:
+    CaptiveDns();
+    ~CaptiveDns() = default;
+    CaptiveDns(const CaptiveDns &) = delete;
+    CaptiveDns &operator=(const CaptiveDns &) = delete;
+
+    static void taskEntry(void *arg);
+    void run();
+    void count(Outcome outcome);
+    void buildTemplates(IPAddress portalIp);
+
+    static constexpr size_t A_TAIL_LEN = 16;   // name ptr, type, class, TTL, rdlength, IPv4
+    static constexpr size_t SOA_TAIL_LEN = 34; // name ptr, type, class, TTL, rdlength, root mname/rname, 5 x uint32
+
+    uint8_t aTail_[A_TAIL_LEN];
+    uint8_t soaTail_[SOA_TAIL_LEN];
+
+    int sock_;
+    TaskHandle_t task_;
+    std::atomic<bool> running_;
+    std::atomic<bool> stopRequested_;
+
+    // Written by the DNS task only
+    std::atomic<uint32_t> queries_;
+    std::atomic<uint32_t> answered_;
+    std::atomic<uint32_t> negative_;
+    std::atomic<uint32_t> rejected_;
+    std::atomic<uint32_t> dropped_;
+    std::atomic<uint32_t> wakes_;
+    std::atomic<uint16_t> maxBatch_;
+};
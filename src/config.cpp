@@ -1,8 +1,12 @@
 #include "config.h"
 
 #include <LittleFS.h>
+#include <utility>
+#include "system.h"
+#include "trace.h"
 
 const String Config::DEFAULT_DEVICE_NAME = String("DieselHeaterController");
+const String Config::DEFAULT_NTP_SERVER = String("pool.ntp.org");
 
 /*
  * Simple scoped critical section for basic thread/ISR protection.
@@ -24,10 +28,13 @@ Config &Config::instance()
 }
 
 Config::Config()
-    : ssid_(), password_(), deviceName_(DEFAULT_DEVICE_NAME),
+    : ssid_(), password_(), deviceName_(DEFAULT_DEVICE_NAME), ntpServer_(DEFAULT_NTP_SERVER), bundleSeq_(0),
       fileCbId_(0), suppressReload_(false),
       dirty_(false), lastChangeMs_(0)
 {
+    for (uint8_t i = 0; i < MAX_DISPLAYS; ++i)
+        displays_[i] = defaultDisplay(i);
+
     loadFromDisk();
 
     // Register callback to keep in-memory config in sync with file changes.
@@ -58,6 +65,49 @@ String Config::getDeviceName() const
     ScopedCritical lock;
     return deviceName_;
 }
+String Config::getNtpServer() const
+{
+    ScopedCritical lock;
+    return ntpServer_;
+}
+uint32_t Config::getBundleSeq() const
+{
+    ScopedCritical lock;
+    return bundleSeq_;
+}
+Config::DisplaySettings Config::getDisplay(uint8_t index) const
+{
+    if (index >= MAX_DISPLAYS)
+        return defaultDisplay(index);
+    ScopedCritical lock;
+    return displays_[index];
+}
+
+std::vector<Config::WifiNetwork> Config::getNetworks() const
+{
+    ScopedCritical lock;
+    std::vector<WifiNetwork> out;
+    out.reserve(networks_.size() + 1);
+    if (ssid_.length() > 0)
+        out.push_back(WifiNetwork{ssid_, password_});
+    for (const auto &n : networks_)
+    {
+        if (n.ssid != ssid_)
+            out.push_back(n);
+    }
+    return out;
+}
+
+/* Factory defaults: a 128x64 SSD1306 at 0x3C, no secondary panel. */
+Config::DisplaySettings Config::defaultDisplay(uint8_t index)
+{
+    DisplaySettings d;
+    d.controller = (index == 0) ? "ssd1306" : "none";
+    d.address = (index == 0) ? 0x3C : 0x3D;
+    d.width = 128;
+    d.height = 64;
+    return d;
+}
 
 /* Setters mark dirty and update timestamp. Persist is debounced via poll(). */
 void Config::setSsid(const String &s)
@@ -66,7 +116,7 @@ void Config::setSsid(const String &s)
         ScopedCritical lock;
         ssid_ = s;
         dirty_ = true;
-        lastChangeMs_ = millis();
+        lastChangeMs_ = System::instance().monotonicMs();
     }
 }
 
@@ -76,7 +126,7 @@ void Config::setPassword(const String &p)
         ScopedCritical lock;
         password_ = p;
         dirty_ = true;
-        lastChangeMs_ = millis();
+        lastChangeMs_ = System::instance().monotonicMs();
     }
 }
 
@@ -86,8 +136,106 @@ void Config::setDeviceName(const String &d)
         ScopedCritical lock;
         deviceName_ = d;
         dirty_ = true;
-        lastChangeMs_ = millis();
+        lastChangeMs_ = System::instance().monotonicMs();
+    }
+}
+
+void Config::setNtpServer(const String &s)
+{
+    {
+        ScopedCritical lock;
+        ntpServer_ = s.length() > 0 ? s : DEFAULT_NTP_SERVER;
+        dirty_ = true;
+        lastChangeMs_ = System::instance().monotonicMs();
+    }
+}
+
+void Config::setDisplay(uint8_t index, const DisplaySettings &settings)
+{
+    if (index >= MAX_DISPLAYS)
+        return;
+    {
+        ScopedCritical lock;
+        displays_[index] = settings;
+        dirty_ = true;
+        lastChangeMs_ = System::instance().monotonicMs();
+    }
+}
+
+bool Config::addNetwork(const String &ssid, const String &password)
+{
+    if (ssid.length() == 0)
+        return false;
+
+    ScopedCritical lock;
+    for (auto &n : networks_)
+    {
+        if (n.ssid == ssid)
+        {
+            n.password = password;
+            dirty_ = true;
+            lastChangeMs_ = System::instance().monotonicMs();
+            return true;
+        }
     }
+    if (networks_.size() >= MAX_EXTRA_NETWORKS)
+        return false;
+    networks_.push_back(WifiNetwork{ssid, password});
+    dirty_ = true;
+    lastChangeMs_ = System::instance().monotonicMs();
+    return true;
+}
+
+bool Config::removeNetwork(const String &ssid)
+{
+    ScopedCritical lock;
+    for (auto it = networks_.begin(); it != networks_.end(); ++it)
+    {
+        if (it->ssid == ssid)
+        {
+            networks_.erase(it);
+            dirty_ = true;
+            lastChangeMs_ = System::instance().monotonicMs();
+            return true;
+        }
+    }
+    return false;
+}
+
+void Config::promoteNetwork(const String &ssid, const String &password)
+{
+    if (ssid.length() == 0)
+        return;
+
+    ScopedCritical lock;
+    for (auto it = networks_.begin(); it != networks_.end(); ++it)
+    {
+        if (it->ssid == ssid)
+        {
+            networks_.erase(it);
+            break;
+        }
+    }
+    if (ssid_.length() > 0 && ssid_ != ssid)
+    {
+        if (networks_.size() >= MAX_EXTRA_NETWORKS)
+            networks_.pop_back();
+        networks_.insert(networks_.begin(), WifiNetwork{ssid_, password_});
+    }
+    ssid_ = ssid;
+    password_ = password;
+    dirty_ = true;
+    lastChangeMs_ = System::instance().monotonicMs();
+}
+
+void Config::clearNetworks()
+{
+    ScopedCritical lock;
+    if (networks_.empty())
+        return;
+    networks_.clear();
+    dirty_ = true;
+    lastChangeMs_ = System::instance().monotonicMs();
 }
 
 /**
@@ -96,15 +244,14 @@ void Config::setDeviceName(const String &d)
  */
 void Config::poll()
 {
+    TRACE_SCOPE("config.poll");
     // quick snapshot to minimize time in critical section
     bool shouldPersist = false;
     {
         ScopedCritical lock;
         if (dirty_)
         {
-            unsigned long now = millis();
-            unsigned long elapsed = now - lastChangeMs_;
-            if (elapsed >= DEBOUNCE_MS)
+            if (System::instance().monotonicMs() - lastChangeMs_ >= DEBOUNCE_MS)
                 shouldPersist = true;
         }
     }
@@ -136,6 +283,34 @@ bool Config::forcePersist()
     return persist();
 }
 
+/**
+ * The document is applied to a copy outside the critical section and swapped in; a
+ * setter racing in between is overwritten (callers are on the service task, as are
+ * the setters). A failed write swaps the previous values, bundleSeq included, back.
+ */
+bool Config::applyAndPersist(const JsonDocument &doc)
+{
+    Fields f;
+    {
+        ScopedCritical lock;
+        f = copyFields();
+    }
+    applyJson(doc, f);
+    {
+        ScopedCritical lock;
+        swapFields(f); // f now holds the previous values
+        dirty_ = true;
+        lastChangeMs_ = System::instance().monotonicMs();
+    }
+    if (persist())
+        return true;
+
+    // config.json is untouched (temp file + rename); bring memory back in line with it
+    ScopedCritical lock;
+    swapFields(f);
+    return false;
+}
+
 /**
  * Load config from disk into memory. Protected by critical section.
  */
@@ -155,7 +330,7 @@ void Config::loadFromDisk()
         return;
     }
 
-    StaticJsonDocument<512> doc;
+    StaticJsonDocument<1536> doc;
     DeserializationError err = deserializeJson(doc, json);
     if (err)
     {
@@ -163,15 +338,15 @@ void Config::loadFromDisk()
         return;
     }
 
-    // Update fields inside critical section
+    Fields f;
+    {
+        ScopedCritical lock;
+        f = copyFields();
+    }
+    applyJson(doc, f);
     {
         ScopedCritical lock;
-        if (doc.containsKey("ssid"))
-            ssid_ = String(doc["ssid"].as<const char *>());
-        if (doc.containsKey("password"))
-            password_ = String(doc["password"].as<const char *>());
-        if (doc.containsKey("deviceName"))
-            deviceName_ = String(doc["deviceName"].as<const char *>());
+        swapFields(f);
 
         // loaded from disk means no pending local changes
         dirty_ = false;
@@ -193,12 +368,13 @@ void Config::loadFromDisk()
 bool Config::persist()
 {
     // Acquire a short critical section to snapshot current data and set suppress flag.
-    String json;
+    Fields snapshot;
     {
         ScopedCritical lock;
-        json = serializeToJson();
+        snapshot = copyFields();
         suppressReload_ = true;
     }
+    const String json = serializeToJson(snapshot);
 
     // Ensure filesystem is mounted via FileSystem helper.
     FileSystem::instance().mount();
@@ -229,12 +405,8 @@ bool Config::persist()
         return false;
     }
 
-    // Remove existing file (if any) and rename temp to target.
-    if (LittleFS.exists(CONFIG_PATH))
-    {
-        LittleFS.remove(CONFIG_PATH);
-    }
-
+    // LittleFS renames over an existing file atomically: a reader (or a power cut) sees
+    // either the old or the new config, never none
     bool renamed = LittleFS.rename(tmpPath.c_str(), CONFIG_PATH);
 
     // allow reloads again
@@ -252,15 +424,61 @@ bool Config::persist()
     return renamed;
 }
 
+Config::Fields Config::copyFields() const
+{
+    Fields f;
+    f.ssid = ssid_;
+    f.password = password_;
+    f.deviceName = deviceName_;
+    f.ntpServer = ntpServer_;
+    f.bundleSeq = bundleSeq_;
+    for (uint8_t i = 0; i < MAX_DISPLAYS; ++i)
+        f.displays[i] = displays_[i];
+    f.networks = networks_;
+    return f;
+}
+
+void Config::swapFields(Fields &f)
+{
+    std::swap(ssid_, f.ssid);
+    std::swap(password_, f.password);
+    std::swap(deviceName_, f.deviceName);
+    std::swap(ntpServer_, f.ntpServer);
+    std::swap(bundleSeq_, f.bundleSeq);
+    for (uint8_t i = 0; i < MAX_DISPLAYS; ++i)
+        std::swap(displays_[i], f.displays[i]);
+    networks_.swap(f.networks);
+}
+
 /**
- * Serialize current fields to JSON.
+ * Serialize a field snapshot to JSON.
  */
-String Config::serializeToJson() const
+String Config::serializeToJson(const Fields &f)
 {
-    StaticJsonDocument<512> doc;
-    doc["ssid"] = ssid_;
-    doc["password"] = password_;
-    doc["deviceName"] = deviceName_;
+    StaticJsonDocument<1536> doc;
+    doc["ssid"] = f.ssid;
+    doc["password"] = f.password;
+    doc["deviceName"] = f.deviceName;
+    doc["ntpServer"] = f.ntpServer;
+    doc["bundleSeq"] = f.bundleSeq;
+
+    JsonArray networks = doc.createNestedArray("networks");
+    for (const auto &n : f.networks)
+    {
+        JsonObject o = networks.createNestedObject();
+        o["ssid"] = n.ssid;
+        o["password"] = n.password;
+    }
+
+    JsonArray displays = doc.createNestedArray("displays");
+    for (uint8_t i = 0; i < MAX_DISPLAYS; ++i)
+    {
+        JsonObject d = displays.createNestedObject();
+        d["controller"] = f.displays[i].controller;
+        d["address"] = f.displays[i].address;
+        d["width"] = f.displays[i].width;
+        d["height"] = f.displays[i].height;
+    }
 
     String out;
     serializeJson(doc, out);
@@ -268,23 +486,56 @@ String Config::serializeToJson() const
 }
 
 /**
- * Parse JSON and update fields. Returns true on success.
+ * Copy known fields from a parsed document into `f`.
+ * Missing keys leave the current values untouched.
  */
-bool Config::parseFromJson(const String &json)
+void Config::applyJson(const JsonDocument &doc, Fields &f)
 {
-    StaticJsonDocument<512> doc;
-    DeserializationError err = deserializeJson(doc, json);
-    if (err)
-        return false;
-
-    ScopedCritical lock;
     if (doc.containsKey("ssid"))
-        ssid_ = String(doc["ssid"].as<const char *>());
+        f.ssid = String(doc["ssid"].as<const char *>());
     if (doc.containsKey("password"))
-        password_ = String(doc["password"].as<const char *>());
+        f.password = String(doc["password"].as<const char *>());
     if (doc.containsKey("deviceName"))
-        deviceName_ = String(doc["deviceName"].as<const char *>());
-    return true;
+        f.deviceName = String(doc["deviceName"].as<const char *>());
+    if (doc.containsKey("ntpServer"))
+        f.ntpServer = String(doc["ntpServer"].as<const char *>());
+    if (f.ntpServer.length() == 0)
+        f.ntpServer = DEFAULT_NTP_SERVER;
+    if (doc.containsKey("bundleSeq"))
+        f.bundleSeq = doc["bundleSeq"] | (uint32_t)0;
+
+    if (doc.containsKey("networks"))
+    {
+        f.networks.clear();
+        for (JsonVariantConst v : doc["networks"].as<JsonArrayConst>())
+        {
+            if (f.networks.size() >= MAX_EXTRA_NETWORKS)
+                break;
+            JsonObjectConst n = v.as<JsonObjectConst>();
+            String ssid = n["ssid"] | "";
+            if (ssid.length() > 0)
+                f.networks.push_back(WifiNetwork{ssid, String(n["password"] | "")});
+        }
+    }
+
+    if (doc.containsKey("displays"))
+    {
+        JsonArrayConst displays = doc["displays"].as<JsonArrayConst>();
+        uint8_t i = 0;
+        for (JsonVariantConst v : displays)
+        {
+            if (i >= MAX_DISPLAYS)
+                break;
+            JsonObjectConst d = v.as<JsonObjectConst>();
+            DisplaySettings s = defaultDisplay(i);
+            if (d.containsKey("controller"))
+                s.controller = String(d["controller"].as<const char *>());
+            s.address = d["address"] | s.address;
+            s.width = d["width"] | s.width;
+            s.height = d["height"] | s.height;
+            f.displays[i++] = s;
+        }
+    }
 }
 
 /**
@@ -309,6 +560,10 @@ void Config::onFileEvent(const String &path, FileAction action)
         ssid_.clear();
         password_.clear();
         deviceName_ = DEFAULT_DEVICE_NAME;
+        ntpServer_ = DEFAULT_NTP_SERVER;
+        networks_.clear();
+        for (uint8_t i = 0; i < MAX_DISPLAYS; ++i)
+            displays_[i] = defaultDisplay(i);
 
         // removal is an external change, ensure we clear pending local dirty state
         dirty_ = false;
@@ -324,5 +579,7 @@ void Config::print() const
     Serial.print(F(", password="));
     Serial.print(password_);
     Serial.print(F(", deviceName="));
-    Serial.println(deviceName_);
+    Serial.print(deviceName_);
+    Serial.print(F(", ntpServer="));
+    Serial.println(ntpServer_);
 }
\ No newline at end of file
@@ -15,18 +15,45 @@
 
 #include <Arduino.h>
 #include <ArduinoJson.h>
+#include <vector>
 #include "fileSystem.h"
 
 // I2C pins for display (can be adjusted per board)
 constexpr uint8_t DISPLAY_SDA = 21;
 constexpr uint8_t DISPLAY_SCL = 4;
 
+// BOOT button (active low): factory reset hold and deep-sleep wake
+constexpr int BOOT_BUTTON_PIN = 0;
+// Heater UART RX, used as a deep/light-sleep wake source; -1 until the heater link is wired
+constexpr int HEATER_UART_RX_PIN = -1;
+
 class Config
 {
 public:
     static const String DEFAULT_DEVICE_NAME;
+    static const String DEFAULT_NTP_SERVER;
     static constexpr const char *CONFIG_PATH = "/config.json";
 
+    // Display panels on the shared I2C bus (index 0 = primary, 1 = secondary)
+    static constexpr uint8_t MAX_DISPLAYS = 2;
+
+    // Additional WiFi networks besides the primary ssid/password
+    static constexpr uint8_t MAX_EXTRA_NETWORKS = 4;
+
+    struct WifiNetwork
+    {
+        String ssid;
+        String password;
+    };
+
+    struct DisplaySettings
+    {
+        String controller; // "ssd1306", "sh1106", "memory" or "none"
+        uint8_t address;   // 7-bit I2C address
+        uint16_t width;
+        uint16_t height;
+    };
+
     // Singleton access
     static Config &instance();
 
@@ -34,11 +61,26 @@ public:
     String getSsid() const;
     String getPassword() const;
     String getDeviceName() const;
+    String getNtpServer() const;
+    // Sequence number of the last signed provisioning bundle applied (0 = none)
+    uint32_t getBundleSeq() const;
+    DisplaySettings getDisplay(uint8_t index) const;
+    // All known networks: the primary ssid/password first (if set), then extras.
+    std::vector<WifiNetwork> getNetworks() const;
 
     // Setters (mark dirty, persist is debounced)
     void setSsid(const String &s);
     void setPassword(const String &p);
     void setDeviceName(const String &d);
+    void setNtpServer(const String &s);
+    void setDisplay(uint8_t index, const DisplaySettings &settings);
+    // Add or update an extra network (the primary is set via setSsid/setPassword).
+    // Returns false if the list is full.
+    bool addNetwork(const String &ssid, const String &password);
+    bool removeNetwork(const String &ssid);
+    // Make ssid the primary network; the previous primary moves to the front of the extras.
+    void promoteNetwork(const String &ssid, const String &password);
+    void clearNetworks();
 
     // Polling: call periodically from main loop to flush debounced changes
     void poll();
@@ -46,6 +88,10 @@ public:
     // Force flush pending changes immediately
     bool forcePersist();
 
+    // Apply every key of `doc` (config.json layout) in one step and write the file at
+    // once. On a failed write the previous values are restored. Used by ProvisioningBundle.
+    bool applyAndPersist(const JsonDocument &doc);
+
     // Debug print
     void print() const;
 
@@ -64,6 +110,10 @@ private:
     String ssid_;
     String password_;
     String deviceName_;
+    String ntpServer_;
+    uint32_t bundleSeq_;
+    DisplaySettings displays_[MAX_DISPLAYS];
+    std::vector<WifiNetwork> networks_;
 
     // FileSystem callback management
     uint32_t fileCbId_;
@@ -71,7 +121,7 @@ private:
 
     // Debounce state
     volatile bool dirty_;
-    volatile unsigned long lastChangeMs_;
+    volatile uint64_t lastChangeMs_; // System::monotonicMs()
     static constexpr unsigned long DEBOUNCE_MS = 2000; // milliseconds
 
     // Load from file (internal)
@@ -80,9 +130,25 @@ private:
     // Persist current in-memory config to disk (internal)
     bool persist();
 
-    // Serialize/deserialize helpers (internal)
-    String serializeToJson() const;
-    bool parseFromJson(const String &json);
+    // The backing fields as one value: copied out and swapped back in under the critical
+    // section, so JSON work on them happens outside it
+    struct Fields
+    {
+        String ssid;
+        String password;
+        String deviceName;
+        String ntpServer;
+        uint32_t bundleSeq;
+        DisplaySettings displays[MAX_DISPLAYS];
+        std::vector<WifiNetwork> networks;
+    };
+    Fields copyFields() const;  // caller holds the critical section
+    void swapFields(Fields &f); // caller holds the critical section; no allocation
+
+    // Serialize/deserialize helpers (internal, no locking)
+    static String serializeToJson(const Fields &f);
+    static void applyJson(const JsonDocument &doc, Fields &f);
+    static DisplaySettings defaultDisplay(uint8_t index);
 
     // FileSystem event callback
     void onFileEvent(const String &path, FileAction action);
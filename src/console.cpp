@@ -2,6 +2,70 @@
 #include "Logger.h"
 #include "config.h"
 #include "provisioning.h"
+#include "captiveDns.h"
+#include "bleProvisioning.h"
+#include "provisioningBundle.h"
+#include "display.h"
+#include "displaySnapshot.h"
+#include "networkController.h"
+#include "linkMonitor.h"
+#include "timeSync.h"
+#include "powerManager.h"
+#include "crashLog.h"
+#include "supervisor.h"
+#include "controlLoop.h"
+#include "memoryPool.h"
+#include "bufferAllocator.h"
+#include "heapMonitor.h"
+#include "trace.h"
+#include "system.h"
+
+namespace
+{
+    // Print adapter that base64-encodes everything written through it.
+    class Base64Print : public Print
+    {
+    public:
+        explicit Base64Print(Print &out) : out_(out) {}
+
+        size_t write(uint8_t b) override
+        {
+            buf_[used_++] = b;
+            if (used_ == 3)
+                emit();
+            return 1;
+        }
+
+        // Flush a trailing partial group with '=' padding.
+        void finish()
+        {
+            if (used_ > 0)
+                emit();
+            out_.println();
+        }
+
+    private:
+        void emit()
+        {
+            static const char ALPHABET[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+            const uint32_t v = (uint32_t(buf_[0]) << 16) | (uint32_t(used_ > 1 ? buf_[1] : 0) << 8) | (used_ > 2 ? buf_[2] : 0);
+            char q[4] = {ALPHABET[(v >> 18) & 0x3F], ALPHABET[(v >> 12) & 0x3F],
+                         used_ > 1 ? ALPHABET[(v >> 6) & 0x3F] : '=', used_ > 2 ? ALPHABET[v & 0x3F] : '='};
+            out_.write(reinterpret_cast<const uint8_t *>(q), sizeof(q));
+            used_ = 0;
+            if (++groups_ == 19) // 76 chars per line
+            {
+                out_.println();
+                groups_ = 0;
+            }
+        }
+
+        Print &out_;
+        uint8_t buf_[3] = {0, 0, 0};
+        uint8_t used_ = 0;
+        uint8_t groups_ = 0;
+    };
+}
 
 Console &Console::instance()
 {
@@ -119,6 +183,491 @@ void Console::registerDefaultCommands()
                         Provisioning::instance().reset();
                         out.println(F("Factory reset requested.")); }, "Reset device to factory defaults");
 
+    registerCommand("screenshot", [](const std::vector<String> &args, Stream &out)
+                    {
+                        const Display &d = Display::instance();
+                        const uint8_t *fb = d.framebuffer();
+                        if (!fb)
+                        {
+                            out.println(F("Display unavailable"));
+                            return;
+                        }
+                        String fmt = args.empty() ? String("pbm") : args[0];
+                        fmt.toLowerCase();
+                        if (fmt == "png")
+                        {
+                            Base64Print b64(out);
+                            DisplaySnapshot::writePng(b64, fb, d.width(), d.height());
+                            b64.finish();
+                        }
+                        else if (fmt == "pbm")
+                        {
+                            DisplaySnapshot::writePbm(out, fb, d.width(), d.height(), true);
+                        }
+                        else
+                        {
+                            out.println(F("Usage: screenshot [pbm|png]"));
+                        } }, "Dump display contents (plain PBM or base64 PNG)");
+
+    registerCommand("wifi", [](const std::vector<String> &args, Stream &out)
+                    {
+                        String sub = args.empty() ? String("status") : args[0];
+                        sub.toLowerCase();
+                        if (sub == "add" && args.size() >= 2)
+                        {
+                            String pwd = (args.size() >= 3) ? args[2] : String();
+                            out.println(Config::instance().addNetwork(args[1], pwd) ? F("Network saved.") : F("Network list full."));
+                            return;
+                        }
+                        if (sub == "remove" && args.size() >= 2)
+                        {
+                            out.println(Config::instance().removeNetwork(args[1]) ? F("Network removed.") : F("Network not found."));
+                            return;
+                        }
+                        if (sub == "connect" && args.size() >= 2)
+                        {
+                            String ssid = args[1];
+                            String pwd = (args.size() >= 3) ? args[2] : String();
+                            bool started = NetworkController::instance().beginTrial(ssid, pwd, [ssid, pwd](bool ok)
+                                                                                    {
+                                if (!ok)
+                                    return;
+                                Config::instance().promoteNetwork(ssid, pwd);
+                                Config::instance().forcePersist(); });
+                            out.println(started ? F("Trying network; it becomes primary if the connection succeeds.")
+                                                : F("A WiFi trial is already running."));
+                            return;
+                        }
+                        if (sub == "scan")
+                        {
+                            NetworkController &nc = NetworkController::instance();
+                            if (nc.startScan(args.size() >= 2 && args[1] == "refresh"))
+                                out.println(F("Scan running; run 'wifi scan' again for fresh results."));
+                            for (const auto &r : nc.scanResults())
+                                out.printf("  %-32s %4ld dBm  ch %2u  %s  (%u AP)\r\n", r.ssid.c_str(), (long)r.rssi,
+                                           (unsigned)r.channel, r.encryption == WIFI_AUTH_OPEN ? "open  " : "secure",
+                                           (unsigned)r.apCount);
+                            if (nc.scanAgeMs() != UINT32_MAX)
+                                out.printf("Results age %lu ms\r\n", (unsigned long)nc.scanAgeMs());
+                            return;
+                        }
+                        if (sub != "status")
+                        {
+                            out.println(F("Usage: wifi [status | scan [refresh] | connect <ssid> [password] | add <ssid> [password] | remove <ssid>]"));
+                            return;
+                        }
+
+                        NetworkController &nc = NetworkController::instance();
+                        const auto &m = nc.metrics();
+                        out.print(F("State: "));
+                        out.println(NetworkController::stateToString(nc.state()));
+                        if (nc.isConnected())
+                        {
+                            out.print(F("SSID: "));
+                            out.print(WiFi.SSID());
+                            out.print(F("  IP: "));
+                            out.print(WiFi.localIP().toString());
+                            out.print(F("  RSSI: "));
+                            out.println(WiFi.RSSI());
+                        }
+                        out.printf("Attempts %lu, successes %lu, failures %lu, disconnects %lu\r\n",
+                                   (unsigned long)m.attempts, (unsigned long)m.successes,
+                                   (unsigned long)m.failures, (unsigned long)m.disconnects);
+                        out.printf("Boot->IP %lu ms, last connect %lu ms, last recovery %lu ms, last reason %u\r\n",
+                                   (unsigned long)m.bootToIpMs, (unsigned long)m.lastConnectMs,
+                                   (unsigned long)m.lastRecoveryMs, (unsigned)m.lastDisconnectReason);
+                        out.printf("Fast boot: %s, lease reused: %s, previous boot->IP %lu ms\r\n",
+                                   m.fastBoot ? "yes" : "no", m.leaseReused ? "yes" : "no",
+                                   (unsigned long)m.previousBootToIpMs);
+                        out.println(F("Stored networks:"));
+                        for (const auto &n : Config::instance().getNetworks())
+                        {
+                            out.print(F("  "));
+                            out.println(n.ssid);
+                        } }, "WiFi status/metrics and stored networks");
+
+    registerCommand("link", [](const std::vector<String> &args, Stream &out)
+                    {
+                        LinkMonitor &lm = LinkMonitor::instance();
+                        if (args.size() >= 2 && args[0] == "policy")
+                        {
+                            String p = args[1];
+                            p.toLowerCase();
+                            if (p == "auto")
+                                lm.setPolicy(LinkMonitor::PowerPolicy::Auto);
+                            else if (p == "on")
+                                lm.setPolicy(LinkMonitor::PowerPolicy::AlwaysOn);
+                            else if (p == "save")
+                                lm.setPolicy(LinkMonitor::PowerPolicy::AlwaysSave);
+                            else
+                                out.println(F("Usage: link policy <auto|on|save>"));
+                            return;
+                        }
+
+                        const LinkMonitor::RssiStats st = lm.rssiStats();
+                        if (st.count > 0)
+                            out.printf("RSSI over %u samples: min %d, avg %d, max %d dBm\r\n",
+                                       (unsigned)st.count, st.min, st.avg, st.max);
+                        else
+                            out.println(F("No RSSI samples yet."));
+
+                        LinkMonitor::Sample samples[12];
+                        size_t n = lm.samples(samples, 12);
+                        if (n > 0)
+                        {
+                            out.print(F("Recent:"));
+                            for (size_t i = 0; i < n; ++i)
+                                out.printf(" %d", samples[i].rssi);
+                            out.println();
+                        }
+
+                        out.printf("Power save: %s (policy %s), %lu switches, awake %lu ms, modem sleep %lu ms\r\n",
+                                   LinkMonitor::powerSaveToString(lm.powerSave()), LinkMonitor::policyToString(lm.policy()),
+                                   (unsigned long)lm.powerSaveSwitches(), (unsigned long)lm.msAwake(),
+                                   (unsigned long)lm.msModemSleep());
+
+                        LinkMonitor::DisconnectRecord recs[LinkMonitor::DISCONNECT_HISTORY];
+                        n = lm.disconnects(recs, LinkMonitor::DISCONNECT_HISTORY);
+                        out.printf("Disconnects (%u recorded):\r\n", (unsigned)n);
+                        for (size_t i = 0; i < n; ++i)
+                            out.printf("  t=%lu ms reason %u\r\n", (unsigned long)recs[i].atMs, (unsigned)recs[i].reason); }, "WiFi link quality and power-save policy");
+
+    registerCommand("time", [](const std::vector<String> &args, Stream &out)
+                    {
+                        TimeSync &ts = TimeSync::instance();
+                        if (!args.empty() && args[0] == "server" && args.size() >= 2)
+                        {
+                            Config::instance().setNtpServer(args[1]);
+                            Config::instance().forcePersist();
+                            ts.resync();
+                            out.println(F("NTP server set; resyncing."));
+                            return;
+                        }
+                        if (!args.empty() && args[0] == "sync")
+                        {
+                            ts.resync();
+                            out.println(F("Resyncing."));
+                            return;
+                        }
+
+                        System &sys = System::instance();
+                        char buf[32];
+                        if (sys.timeSource() != System::TimeSource::None && System::formatIso8601(sys.now(), buf, sizeof(buf)))
+                            out.printf("Now: %s (source %s)\r\n", buf, System::timeSourceToString(sys.timeSource()));
+                        else
+                            out.println(F("Now: unknown"));
+                        out.printf("Server: %s, syncs %lu, drift %ld ppb, last correction %ld us\r\n",
+                                   Config::instance().getNtpServer().c_str(), (unsigned long)ts.syncCount(),
+                                   (long)sys.driftPpb(), (long)sys.lastCorrectionUs());
+                        if (sys.lastSyncMonoUs() != 0)
+                            out.printf("Last sync %lu s ago\r\n",
+                                       (unsigned long)((sys.monotonicUs() - sys.lastSyncMonoUs()) / 1000000LL)); }, "Wall clock / SNTP status: time [sync | server <host>]");
+
+    registerCommand("ap", [](const std::vector<String> &args, Stream &out)
+                    {
+                        Provisioning &prov = Provisioning::instance();
+                        String sub = args.empty() ? String("status") : args[0];
+                        sub.toLowerCase();
+                        if (sub == "start")
+                        {
+                            uint32_t minutes = (args.size() >= 2) ? (uint32_t)args[1].toInt() : 0;
+                            uint32_t ms = minutes > 0 ? minutes * 60UL * 1000UL : Provisioning::TEMP_AP_DEFAULT_MS;
+                            out.println(prov.startTemporaryAp(ms) ? F("Temporary AP running.") : F("Temporary AP not started (see log)."));
+                        }
+                        else if (sub == "stop")
+                        {
+                            prov.stopTemporaryAp();
+                            out.println(F("Temporary AP stopped."));
+                        }
+                        else if (sub == "dnsreset")
+                        {
+                            CaptiveDns::instance().resetStats();
+                            out.println(F("Captive DNS counters reset."));
+                        }
+                        else
+                        {
+                            out.print(F("Temporary AP: "));
+                            out.println(prov.temporaryApActive() ? F("running") : F("off"));
+                            const CaptiveDns::Stats ds = CaptiveDns::instance().stats();
+                            out.printf("Captive DNS: %s, %lu queries (A %lu, no-data %lu, rejected %lu, dropped %lu), %lu wakes, max batch %u\r\n",
+                                       CaptiveDns::instance().running() ? "running" : "off", (unsigned long)ds.queries,
+                                       (unsigned long)ds.answered, (unsigned long)ds.negative, (unsigned long)ds.rejected,
+                                       (unsigned long)ds.dropped, (unsigned long)ds.wakes, (unsigned)ds.maxBatch);
+                            out.println(F("Usage: ap [status | start [minutes] | stop | dnsreset]"));
+                        } }, "Temporary provisioning AP next to the station link");
+
+    registerCommand("ble", [](const std::vector<String> &, Stream &out)
+                    {
+                        BleProvisioning &ble = BleProvisioning::instance();
+                        if (!BleProvisioning::compiledIn())
+                        {
+                            out.println(F("BLE provisioning not compiled in (DHC_BLE_PROVISIONING=0)."));
+                            return;
+                        }
+                        if (!ble.running())
+                        {
+                            out.println(F("BLE provisioning: off"));
+                            return;
+                        }
+                        out.printf("BLE provisioning: advertising, code %s, client %s\r\n", ble.pop().c_str(),
+                                   ble.clientConnected() ? "connected" : "none");
+                        out.printf("  %lu connections, %lu frames, %u failed auth\r\n", (unsigned long)ble.connections(),
+                                   (unsigned long)ble.frames(), (unsigned)ble.authFailures()); }, "BLE provisioning state and code");
+
+    registerCommand("crashlog", [](const std::vector<String> &args, Stream &out)
+                    {
+                        if (!args.empty() && args[0] == "clear")
+                        {
+                            out.println(CrashLog::instance().clear() ? F("Crash log cleared.") : F("Failed to clear crash log."));
+                            return;
+                        }
+                        if (!args.empty() && args[0] == "json")
+                        {
+                            out.println(CrashLog::instance().json());
+                            return;
+                        }
+
+                        PooledJsonDocument doc(CrashLog::JSON_CAPACITY,
+                                               PooledJsonAllocator(MemoryAccounting::instance().registerModule("console")));
+                        if (deserializeJson(doc, CrashLog::instance().json()) || doc.as<JsonArray>().size() == 0)
+                        {
+                            out.println(F("No crash log records."));
+                            return;
+                        }
+                        for (JsonObject r : doc.as<JsonArray>())
+                        {
+                            out.printf("#%lu %s%s fw %s", (unsigned long)r["boot"].as<uint32_t>(), r["reason"].as<const char *>(),
+                                       r["abnormal"].as<bool>() ? " (!)" : "", r["fw"].as<const char *>());
+                            JsonObject p = r["previous"];
+                            if (!p.isNull())
+                                out.printf(", previous run %lu s, heap free %lu min %lu largest %lu",
+                                           (unsigned long)(p["uptimeMs"].as<uint64_t>() / 1000), (unsigned long)p["heap"]["free"].as<uint32_t>(),
+                                           (unsigned long)p["heap"]["minFree"].as<uint32_t>(), (unsigned long)p["heap"]["largest"].as<uint32_t>());
+                            out.println();
+                            if (!p.isNull())
+                                for (const char *line : p["log"].as<JsonArray>())
+                                {
+                                    out.print(F("    | "));
+                                    out.println(line);
+                                }
+                            JsonObject cd = r["coredump"];
+                            if (!cd.isNull())
+                            {
+                                out.printf("    core dump: task %s pc %s%s\r\n    backtrace:", cd["task"].as<const char *>(),
+                                           cd["pc"].as<const char *>(), cd["corrupted"].as<bool>() ? " (corrupted)" : "");
+                                for (const char *a : cd["backtrace"].as<JsonArray>())
+                                {
+                                    out.print(' ');
+                                    out.print(a);
+                                }
+                                out.println();
+                            }
+                        } }, "Reset/crash history: crashlog [json | clear]");
+
+    registerCommand("health", [](const std::vector<String> & /*args*/, Stream &out)
+                    {
+                        Supervisor &sup = Supervisor::instance();
+                        Supervisor::ModuleStatus st[Supervisor::MAX_MODULES];
+                        const size_t n = sup.status(st, Supervisor::MAX_MODULES);
+                        out.printf("Supervisor: %s%s, watchdog %lu s\r\n", sup.healthy() ? "healthy" : "STALLED",
+                                   sup.paused() ? " (paused)" : "", (unsigned long)Supervisor::TWDT_TIMEOUT_S);
+                        for (size_t i = 0; i < n; ++i)
+                            out.printf("  %-14s last beat %6lu ms ago, deadline %lu ms, misses %lu%s\r\n", st[i].name,
+                                       (unsigned long)st[i].ageMs, (unsigned long)st[i].deadlineMs, (unsigned long)st[i].misses,
+                                       st[i].enabled ? "" : " (disabled)"); }, "Module heartbeats and watchdog state");
+
+    registerCommand("tasks", [](const std::vector<String> &args, Stream &out)
+                    {
+                        ControlLoop &cl = ControlLoop::instance();
+                        if (!args.empty() && args[0] == "reset")
+                        {
+                            cl.resetJitter();
+                            out.println(F("Jitter statistics reset."));
+                            return;
+                        }
+                        out.printf("Control: core %d prio %u, %s, period %lu ms; service: core %d prio %u; running on core %d\r\n",
+                                   (int)TaskLayout::CONTROL_CORE, (unsigned)TaskLayout::CONTROL_PRIORITY,
+                                   cl.running() ? "running" : "stopped", (unsigned long)cl.periodMs(),
+                                   (int)TaskLayout::SERVICE_CORE, (unsigned)TaskLayout::SERVICE_PRIORITY, (int)xPortGetCoreID());
+                        const ControlLoop::JitterStats js = cl.jitter();
+                        out.printf("Cycles %lu, wake-up late min %ld / mean %ld / max %ld us, max exec %lu us, overruns %lu, missed %lu\r\n",
+                                   (unsigned long)js.cycles, (long)js.minLateUs, (long)js.meanLateUs, (long)js.maxLateUs,
+                                   (unsigned long)js.maxExecUs, (unsigned long)js.overruns, (unsigned long)js.missedCycles);
+                        for (uint8_t i = 0; i < ControlLoop::HIST_BUCKETS; ++i)
+                        {
+                            if (i < ControlLoop::HIST_BUCKETS - 1)
+                                out.printf("  < %4lu us: %lu\r\n", (unsigned long)ControlLoop::HIST_LIMITS_US[i], (unsigned long)js.hist[i]);
+                            else
+                                out.printf("  >=%4lu us: %lu\r\n", (unsigned long)ControlLoop::HIST_LIMITS_US[i - 1], (unsigned long)js.hist[i]);
+                        } }, "Task layout and control loop jitter: tasks [reset]");
+
+    registerCommand("heap", [](const std::vector<String> &args, Stream &out)
+                    {
+                        HeapMonitor &hm = HeapMonitor::instance();
+                        BufferAllocator &ba = BufferAllocator::instance();
+                        if (!args.empty() && args[0] == "sample")
+                            hm.sample();
+                        if (args.size() >= 2 && args[0] == "psram")
+                        {
+                            ba.setPsramEnabled(args[1] == "on");
+                            out.printf("Large buffers now allocated in %s\r\n", ba.psramAvailable() ? "PSRAM" : "internal SRAM");
+                            return;
+                        }
+                        const HeapMonitor::Status st = hm.status();
+                        out.printf("Heap: %lu free, largest block %lu, min free %lu\r\n", (unsigned long)st.freeBytes,
+                                   (unsigned long)st.largestBlock, (unsigned long)st.minFreeBytes);
+                        out.printf("Fragmentation %u%% (peak %u%%), largest block trend %ld bytes/h over %u samples%s\r\n",
+                                   (unsigned)st.fragmentationPct, (unsigned)st.peakFragmentationPct, (long)st.largestTrendPerHour,
+                                   (unsigned)st.samples, st.alert ? " [ALERT]" : "");
+                        out.printf("PSRAM: %lu of %lu KiB free%s\r\n",
+                                   (unsigned long)(ba.freeBytes(BufferAllocator::Region::Psram) / 1024),
+                                   (unsigned long)(ba.totalBytes(BufferAllocator::Region::Psram) / 1024),
+                                   ba.psramAvailable() ? "" : " (not used)");
+
+                        const FixedBlockPool *pools[8];
+                        const size_t np = FixedBlockPool::list(pools, 8);
+                        for (size_t i = 0; i < np; ++i)
+                            out.printf("  pool %-10s %4u x %5u bytes, in use %u (peak %u), failures %lu\r\n", pools[i]->name(),
+                                       (unsigned)pools[i]->blockCount(), (unsigned)pools[i]->blockSize(), (unsigned)pools[i]->inUse(),
+                                       (unsigned)pools[i]->peakInUse(), (unsigned long)pools[i]->failures());
+
+                        MemoryAccounting::ModuleStats ms[MemoryAccounting::MAX_MODULES];
+                        const size_t nm = MemoryAccounting::instance().stats(ms, MemoryAccounting::MAX_MODULES);
+                        for (size_t i = 0; i < nm; ++i)
+                            out.printf("  module %-10s internal %6lu (peak %lu), psram %6lu (peak %lu), %lu allocs, %lu failures\r\n",
+                                       ms[i].name, (unsigned long)ms[i].bytes, (unsigned long)ms[i].peakBytes,
+                                       (unsigned long)ms[i].psramBytes, (unsigned long)ms[i].psramPeakBytes,
+                                       (unsigned long)ms[i].allocs, (unsigned long)ms[i].failures); }, "Heap fragmentation, pools and per-module usage: heap [sample | psram on|off]");
+
+    registerCommand("trace", [](const std::vector<String> &args, Stream &out)
+                    {
+                        Trace &tr = Trace::instance();
+                        if (!Trace::compiledIn())
+                        {
+                            out.println(F("Tracing not compiled in (build with DHC_TRACE_ENABLED=1)."));
+                            return;
+                        }
+                        String sub = args.empty() ? String("status") : args[0];
+                        sub.toLowerCase();
+                        if (sub == "dump")
+                        {
+                            tr.writeChromeJson(out);
+                            out.println();
+                            return;
+                        }
+                        if (sub == "bench")
+                        {
+                            // Empty scopes timed in CPU cycles; afterwards the rings hold only these, so clear them
+                            const uint32_t n = args.size() >= 2 ? (uint32_t)max<long>(1, min<long>(args[1].toInt(), 1000000)) : 10000;
+                            const bool wasRecording = tr.recording();
+                            tr.setRecording(true);
+                            if (!tr.recording())
+                            {
+                                out.println(F("Trace rings not allocated."));
+                                return;
+                            }
+                            const uint32_t c0 = ESP.getCycleCount();
+                            for (uint32_t i = 0; i < n; ++i)
+                            {
+                                TRACE_SCOPE("trace bench");
+                            }
+                            const uint32_t cycles = ESP.getCycleCount() - c0;
+                            tr.setRecording(wasRecording);
+                            tr.clear();
+                            const uint32_t mhz = ESP.getCpuFreqMHz();
+                            out.printf("%lu empty TRACE_SCOPEs: %lu cycles each, %.3f us at %lu MHz (spans cleared)\r\n",
+                                       (unsigned long)n, (unsigned long)(cycles / n), (double)cycles / n / mhz,
+                                       (unsigned long)mhz);
+                            return;
+                        }
+                        if (sub == "on" || sub == "off")
+                            tr.setRecording(sub == "on");
+                        else if (sub == "clear")
+                            tr.clear();
+                        out.printf("Trace: %s, %u spans held (%u per core); GET /api/trace for Chrome trace JSON\r\n",
+                                   tr.recording() ? "recording" : "paused", (unsigned)tr.eventCount(),
+                                   (unsigned)Trace::EVENTS_PER_CORE); }, "Trace spans: trace [on | off | clear | dump | bench [n]]");
+
+    registerCommand("power", [](const std::vector<String> &args, Stream &out)
+                    {
+                        PowerManager &pm = PowerManager::instance();
+                        String sub = args.empty() ? String("status") : args[0];
+                        sub.toLowerCase();
+                        if (sub == "sleep")
+                        {
+                            uint32_t secs = (args.size() >= 2) ? (uint32_t)args[1].toInt() : 0;
+                            out.println(secs ? F("Entering deep sleep.") : F("Entering deep sleep until button/heater wake."));
+                            pm.enterDeepSleep(secs * 1000UL, "console");
+                            return;
+                        }
+                        if (sub == "auto")
+                        {
+                            if (args.size() >= 3)
+                                pm.setAutoDeepSleep((uint32_t)args[1].toInt() * 60000UL, (uint32_t)args[2].toInt() * 60000UL);
+                            else if (args.size() == 2 && args[1] == "off")
+                                pm.setAutoDeepSleep(0, 0);
+                            else
+                                out.println(F("Usage: power auto <idle-minutes> <sleep-minutes> | power auto off"));
+                            return;
+                        }
+                        if (sub == "stay" && args.size() >= 2)
+                        {
+                            if (args[1] == "on")
+                                pm.acquire(PowerManager::WakeLock::User);
+                            else
+                                pm.release(PowerManager::WakeLock::User);
+                            return;
+                        }
+
+                        out.printf("Boot #%lu, wake cause %s, %lu deep sleeps",
+                                   (unsigned long)pm.bootCount(), PowerManager::wakeCauseToString(pm.wakeCause()),
+                                   (unsigned long)pm.deepSleepCount());
+                        if (pm.lastDeepSleepMs())
+                            out.printf(" (last %lu s)", (unsigned long)(pm.lastDeepSleepMs() / 1000));
+                        out.println();
+                        const PowerManager::State states[] = {PowerManager::State::Active, PowerManager::State::LightSleep,
+                                                              PowerManager::State::DeepSleep};
+                        for (PowerManager::State s : states)
+                            out.printf("  %-12s %llu ms\r\n", PowerManager::stateToString(s), (unsigned long long)pm.msIn(s));
+                        out.printf("Idle: %s, wake locks 0x%02x, auto light sleep %s\r\n", pm.isIdle() ? "yes" : "no",
+                                   (unsigned)pm.wakeLocks(), pm.autoLightSleep() ? "on" : "off");
+                        if (pm.autoDeepSleepIdleMs())
+                            out.printf("Auto deep sleep: after %lu min idle, for %lu min\r\n",
+                                       (unsigned long)(pm.autoDeepSleepIdleMs() / 60000), (unsigned long)(pm.autoDeepSleepMs() / 60000));
+                        else
+                            out.println(F("Auto deep sleep: off"));
+                        out.println(F("Usage: power [status | sleep [seconds] | auto <idle-min> <sleep-min> | auto off | stay on|off]")); }, "Power states, sleep and wake sources");
+
+    registerCommand("bundle", [](const std::vector<String> &args, Stream &out)
+                    {
+                        ProvisioningBundle &bundle = ProvisioningBundle::instance();
+                        const String sub = args.empty() ? String("status") : args[0];
+                        if (sub == "apply" && args.size() == 3)
+                        {
+                            const ProvisioningBundle::Result r = bundle.apply(args[1], args[2]);
+                            out.printf("Bundle %s: %s\r\n", ProvisioningBundle::resultToString(r), bundle.lastDetail().c_str());
+                            return;
+                        }
+                        if (sub == "file")
+                        {
+                            if (!FileSystem::instance().exists(ProvisioningBundle::DROP_PATH))
+                            {
+                                out.printf("No %s on the file system.\r\n", ProvisioningBundle::DROP_PATH);
+                                return;
+                            }
+                            bundle.applyDroppedFile();
+                            out.printf("Bundle %s: %s\r\n", ProvisioningBundle::resultToString(bundle.lastResult()),
+                                       bundle.lastDetail().c_str());
+                            return;
+                        }
+                        out.printf("Device %s, signing key %s, last applied seq %lu\r\n", bundle.deviceId().c_str(),
+                                   ProvisioningBundle::keyCompiledIn() ? "present" : "missing",
+                                   (unsigned long)Config::instance().getBundleSeq());
+                        if (bundle.attempted())
+                            out.printf("Last bundle: %s (%s)\r\n", ProvisioningBundle::resultToString(bundle.lastResult()),
+                                       bundle.lastDetail().c_str());
+                        out.println(F("Usage: bundle [status | apply <payload> <sig> | file]")); }, "Signed provisioning bundles");
+
     registerCommand("provision", [](const std::vector<String> &args, Stream &out)
                     {
                         if (args.size() < 2)
@@ -215,6 +764,7 @@ void Console::processLine(const String &line)
 
 void Console::consoleLoop()
 {
+    TRACE_SCOPE("console");
     if (!in_ || !out_)
         return;
 
@@ -223,6 +773,7 @@ void Console::consoleLoop()
         int c = in_->read();
         if (c < 0)
             break;
+        PowerManager::instance().noteActivity();
 
         // Echo input if enabled
         if (echoInput_)
@@ -13,7 +13,7 @@
  * - Singleton via Console::instance()
  * - Inject input/output Stream (defaults to Serial) via init()
  * - Register commands with registerCommand() or use registerDefaultCommands()
- * - Call consoleLoop() from main loop() to process incoming serial data
+ * - Call consoleLoop() from the service loop to process incoming serial data
  * - processLine() is public for unit testing
  */
 class Console
@@ -33,7 +33,7 @@ public:
     // Register a command handler (name case-insensitive)
     void registerCommand(const String &name, Handler handler, const String &description = String());
 
-    // Add built-in commands (help, echo, cat, dir, factoryreset, provision)
+    // Add built-in commands (help, echo, cat, dir, factoryreset, screenshot, wifi, link, time, ap, ble, crashlog, health, tasks, heap, trace, power, bundle, provision)
     void registerDefaultCommands();
 
     // Process incoming data from configured input Stream; call frequently from loop()
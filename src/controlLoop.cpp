@@ -0,0 +1,139 @@
+/**
+ * @file controlLoop.cpp
+ * @brief Fixed-rate control task and its jitter statistics.
+ */
+
+#include "controlLoop.h"
+
+#include "Logger.h"
+#include "system.h"
+#include "trace.h"
+
+constexpr uint8_t ControlLoop::MAX_STEPS;
+constexpr uint8_t ControlLoop::HIST_BUCKETS;
+constexpr uint32_t ControlLoop::HIST_LIMITS_US[];
+
+ControlLoop &ControlLoop::instance()
+{
+    static ControlLoop inst;
+    return inst;
+}
+
+ControlLoop::ControlLoop()
+    : steps_(), stepCount_(0), periodMs_(TaskLayout::CONTROL_PERIOD_MS), task_(nullptr),
+      heartbeat_(Supervisor::INVALID_MODULE), stats_(), lateSumUs_(0), resetRequested_(false),
+      statsMux_(portMUX_INITIALIZER_UNLOCKED)
+{
+}
+
+bool ControlLoop::addStep(const char *name, Step step)
+{
+    if (task_ || stepCount_ >= MAX_STEPS || !step)
+        return false;
+    steps_[stepCount_++] = Entry{name, std::move(step)};
+    return true;
+}
+
+bool ControlLoop::start(uint32_t periodMs)
+{
+    if (task_)
+        return true;
+    periodMs_ = periodMs ? periodMs : TaskLayout::CONTROL_PERIOD_MS;
+
+    // A missed deadline of 50 periods (but at least 1 s) means the task is wedged
+    heartbeat_ = Supervisor::instance().registerModule("control", max<uint32_t>(1000, 50 * periodMs_));
+
+    if (xTaskCreatePinnedToCore(&ControlLoop::taskEntry, "control", TaskLayout::CONTROL_STACK, this,
+                                TaskLayout::CONTROL_PRIORITY, &task_, TaskLayout::CONTROL_CORE) != pdPASS)
+    {
+        task_ = nullptr;
+        Logger::instance().error("ControlLoop: failed to start task");
+        return false;
+    }
+    Logger::instance().info(String("ControlLoop: ") + String(stepCount_) + " steps every " + String(periodMs_) +
+                            " ms on core " + String((int)TaskLayout::CONTROL_CORE));
+    return true;
+}
+
+void ControlLoop::taskEntry(void *arg)
+{
+    static_cast<ControlLoop *>(arg)->run();
+}
+
+void ControlLoop::run()
+{
+    System &sys = System::instance();
+    const TickType_t periodTicks = pdMS_TO_TICKS(periodMs_);
+    // The grid vTaskDelayUntil() actually follows (periodMs_ rounded down to whole ticks)
+    const int64_t periodUs = (int64_t)periodTicks * portTICK_PERIOD_MS * 1000;
+
+    TickType_t lastWake = xTaskGetTickCount();
+    int64_t expectedUs = sys.monotonicUs() + periodUs;
+    for (;;)
+    {
+        vTaskDelayUntil(&lastWake, periodTicks);
+        const int64_t wakeUs = sys.monotonicUs();
+
+        {
+            TRACE_SCOPE("control");
+            for (uint8_t i = 0; i < stepCount_; ++i)
+                steps_[i].step((uint64_t)wakeUs);
+        }
+        Supervisor::instance().heartbeat(heartbeat_);
+
+        const int64_t doneUs = sys.monotonicUs();
+        record(wakeUs - expectedUs, (uint32_t)(doneUs - wakeUs));
+
+        // vTaskDelayUntil() advances lastWake by exactly one period, even after an overrun:
+        // missed cycles run back to back and each one is measured against its own slot
+        expectedUs += periodUs;
+    }
+}
+
+void ControlLoop::record(int64_t lateUs, uint32_t execUs)
+{
+    const int32_t late = (int32_t)(lateUs > INT32_MAX ? INT32_MAX : (lateUs < INT32_MIN ? INT32_MIN : lateUs));
+    const uint32_t mag = (uint32_t)(late < 0 ? -late : late);
+    uint8_t bucket = 0;
+    while (bucket < HIST_BUCKETS - 1 && mag >= HIST_LIMITS_US[bucket])
+        bucket++;
+
+    portENTER_CRITICAL(&statsMux_);
+    if (resetRequested_)
+    {
+        stats_ = JitterStats();
+        lateSumUs_ = 0;
+        resetRequested_ = false;
+    }
+    if (stats_.cycles == 0 || late < stats_.minLateUs)
+        stats_.minLateUs = late;
+    if (stats_.cycles == 0 || late > stats_.maxLateUs)
+        stats_.maxLateUs = late;
+    stats_.cycles++;
+    lateSumUs_ += late;
+    stats_.meanLateUs = (int32_t)(lateSumUs_ / stats_.cycles);
+    if (execUs > stats_.maxExecUs)
+        stats_.maxExecUs = execUs;
+    if (execUs > periodMs_ * 1000)
+        stats_.overruns++;
+    if (late >= (int32_t)(periodMs_ * 1000))
+        stats_.missedCycles++;
+    stats_.hist[bucket]++;
+    portEXIT_CRITICAL(&statsMux_);
+}
+
+ControlLoop::JitterStats ControlLoop::jitter() const
+{
+    portENTER_CRITICAL(&statsMux_);
+    JitterStats copy = stats_;
+    portEXIT_CRITICAL(&statsMux_);
+    return copy;
+}
+
+void ControlLoop::resetJitter()
+{
+    // Applied by the control task at its next cycle so it never races an update
+    portENTER_CRITICAL(&statsMux_);
+    resetRequested_ = true;
+    portEXIT_CRITICAL(&statsMux_);
+}
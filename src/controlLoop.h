@@ -0,0 +1,86 @@
+#pragma once
+
+#include <Arduino.h>
+#include <functional>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "supervisor.h"
+#include "taskLayout.h"
+
+/**
+ * @file controlLoop.h
+ * @brief Fixed-rate control task pinned to the control core, with wake-up jitter statistics.
+ *
+ * Control code (the heater controller) registers steps with addStep() before start();
+ * every period the task runs them in order. Wake-ups follow an ideal grid anchored at
+ * the first cycle, and each cycle's lateness against that grid is recorded
+ * (min/max/mean plus a histogram), along with the longest step execution time. Cycles
+ * missed during an overrun still run, late and back to back, and are counted. Compare
+ * jitter() with the network idle and under load (e.g. scripts/http_load.py) to see how
+ * well the core split isolates control from networking.
+ *
+ * Steps must not block; they run at TaskLayout::CONTROL_PRIORITY above everything else
+ * on that core.
+ */
+class ControlLoop
+{
+public:
+    using Step = std::function<void(uint64_t nowUs)>;
+
+    static constexpr uint8_t MAX_STEPS = 8;
+    static constexpr uint8_t HIST_BUCKETS = 7;
+    // Upper bounds (us) of the lateness histogram buckets; the last bucket is open
+    static constexpr uint32_t HIST_LIMITS_US[HIST_BUCKETS - 1] = {50, 100, 250, 500, 1000, 2000};
+
+    struct JitterStats
+    {
+        uint32_t cycles = 0;
+        int32_t minLateUs = 0;
+        int32_t maxLateUs = 0;
+        int32_t meanLateUs = 0;
+        uint32_t maxExecUs = 0;
+        uint32_t overruns = 0;     // steps took longer than the period
+        uint32_t missedCycles = 0; // started a period or more late (catch-up after an overrun)
+        uint32_t hist[HIST_BUCKETS] = {};
+    };
+
+    static ControlLoop &instance();
+
+    // Register a step; only before start()
+    bool addStep(const char *name, Step step);
+
+    bool start(uint32_t periodMs = TaskLayout::CONTROL_PERIOD_MS);
+    bool running() const { return task_ != nullptr; }
+    uint32_t periodMs() const { return periodMs_; }
+
+    JitterStats jitter() const;
+    void resetJitter();
+
+private:
+    ControlLoop();
+    ~ControlLoop() = default;
+    ControlLoop(const ControlLoop &) = delete;
+    ControlLoop &operator=(const ControlLoop &) = delete;
+
+    static void taskEntry(void *arg);
+    void run();
+    void record(int64_t lateUs, uint32_t execUs);
+
+    struct Entry
+    {
+        const char *name;
+        Step step;
+    };
+
+    Entry steps_[MAX_STEPS];
+    uint8_t stepCount_;
+    uint32_t periodMs_;
+    TaskHandle_t task_;
+    Supervisor::ModuleId heartbeat_;
+
+    // Written by the control task under statsMux_
+    JitterStats stats_;
+    int64_t lateSumUs_;
+    bool resetRequested_;
+    mutable portMUX_TYPE statsMux_;
+};
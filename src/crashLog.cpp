@@ -0,0 +1,285 @@
+/**
+ * @file crashLog.cpp
+ * @brief RTC-backed crash context and the persistent boot/crash history.
+ */
+
+#include "crashLog.h"
+
+#include <ArduinoJson.h>
+#include "freertos/FreeRTOS.h"
+#include "sdkconfig.h"
+#include "esp_attr.h"
+#include "Logger.h"
+#include "system.h"
+#include "fileSystem.h"
+#include "memoryPool.h"
+#include "version.h"
+
+#if CONFIG_ESP_COREDUMP_ENABLE_TO_FLASH && CONFIG_ESP_COREDUMP_DATA_FORMAT_ELF && CONFIG_IDF_TARGET_ARCH_XTENSA
+#include "esp_core_dump.h"
+#define DHC_HAVE_COREDUMP_SUMMARY 1
+#endif
+
+constexpr const char *CrashLog::CRASHLOG_PATH;
+constexpr uint8_t CrashLog::MAX_RECORDS;
+constexpr uint8_t CrashLog::LOG_LINES;
+constexpr uint8_t CrashLog::LINE_LEN;
+constexpr uint8_t CrashLog::MAX_BACKTRACE;
+constexpr uint32_t CrashLog::SAMPLE_INTERVAL_MS;
+constexpr size_t CrashLog::JSON_CAPACITY;
+
+namespace
+{
+    constexpr uint32_t RTC_MAGIC = 0x43525348; // "CRSH"
+
+    // Survives soft resets (panic, watchdog, reboot), not power loss
+    struct RtcCrashContext
+    {
+        uint32_t magic;
+        uint8_t head;  // next line slot
+        uint8_t count; // valid lines
+        uint64_t uptimeMs;
+        int64_t wallUs;
+        uint32_t freeHeap;
+        uint32_t minFreeHeap;
+        uint32_t largestBlock;
+        char lines[CrashLog::LOG_LINES][CrashLog::LINE_LEN];
+    };
+    RTC_NOINIT_ATTR RtcCrashContext rtcCrash;
+
+    portMUX_TYPE ringMux = portMUX_INITIALIZER_UNLOCKED;
+
+    bool isAbnormal(esp_reset_reason_t r)
+    {
+        switch (r)
+        {
+        case ESP_RST_PANIC:
+        case ESP_RST_INT_WDT:
+        case ESP_RST_TASK_WDT:
+        case ESP_RST_WDT:
+        case ESP_RST_BROWNOUT:
+            return true;
+        default:
+            return false;
+        }
+    }
+}
+
+CrashLog &CrashLog::instance()
+{
+    static CrashLog inst;
+    return inst;
+}
+
+CrashLog::CrashLog()
+    : reason_(ESP_RST_UNKNOWN), abnormal_(false), persisted_(false), prev_()
+{
+}
+
+void CrashLog::begin()
+{
+    reason_ = System::instance().resetReasonCode();
+    abnormal_ = isAbnormal(reason_);
+
+    // RTC memory is garbage after power-on; only trust it with an intact header
+    const bool powerOn = reason_ == ESP_RST_POWERON;
+    if (!powerOn && rtcCrash.magic == RTC_MAGIC && rtcCrash.count <= LOG_LINES && rtcCrash.head < LOG_LINES)
+    {
+        prev_.valid = true;
+        prev_.uptimeMs = rtcCrash.uptimeMs;
+        prev_.wallUs = rtcCrash.wallUs;
+        prev_.freeHeap = rtcCrash.freeHeap;
+        prev_.minFreeHeap = rtcCrash.minFreeHeap;
+        prev_.largestBlock = rtcCrash.largestBlock;
+        prev_.lineCount = rtcCrash.count;
+        const uint8_t start = (uint8_t)((rtcCrash.head + LOG_LINES - rtcCrash.count) % LOG_LINES);
+        for (uint8_t i = 0; i < rtcCrash.count; ++i)
+        {
+            memcpy(prev_.lines[i], rtcCrash.lines[(start + i) % LOG_LINES], LINE_LEN);
+            prev_.lines[i][LINE_LEN - 1] = '\0';
+        }
+    }
+
+    if (reason_ == ESP_RST_PANIC || reason_ == ESP_RST_TASK_WDT || reason_ == ESP_RST_INT_WDT)
+        readCoreDump();
+
+    // Start a fresh context for this run
+    portENTER_CRITICAL(&ringMux);
+    memset(&rtcCrash, 0, sizeof(rtcCrash));
+    rtcCrash.magic = RTC_MAGIC;
+    portEXIT_CRITICAL(&ringMux);
+
+    sample();
+    System::instance().timers().schedulePeriodic(SAMPLE_INTERVAL_MS, [this]
+                                                 { sample(); });
+}
+
+void CrashLog::readCoreDump()
+{
+#ifdef DHC_HAVE_COREDUMP_SUMMARY
+    if (esp_core_dump_image_check() != ESP_OK)
+        return;
+    esp_core_dump_summary_t summary;
+    if (esp_core_dump_get_summary(&summary) != ESP_OK)
+        return;
+
+    prev_.coreDump = true;
+    strncpy(prev_.task, summary.exc_task, sizeof(prev_.task) - 1);
+    prev_.pc = summary.exc_pc;
+    prev_.btCorrupted = summary.exc_bt_info.corrupted;
+    prev_.depth = (uint8_t)min<uint32_t>(summary.exc_bt_info.depth, MAX_BACKTRACE);
+    for (uint8_t i = 0; i < prev_.depth; ++i)
+        prev_.backtrace[i] = summary.exc_bt_info.bt[i];
+
+    // Report each dump once
+    esp_core_dump_image_erase();
+#endif
+}
+
+void CrashLog::sample()
+{
+    System &sys = System::instance();
+    const uint64_t up = sys.getUptime();
+    const int64_t wall = sys.timeValid() ? sys.now() : 0;
+    const uint32_t freeHeap = ESP.getFreeHeap();
+    const uint32_t minFree = ESP.getMinFreeHeap();
+    const uint32_t largest = ESP.getMaxAllocHeap();
+
+    portENTER_CRITICAL(&ringMux);
+    rtcCrash.uptimeMs = up;
+    rtcCrash.wallUs = wall;
+    rtcCrash.freeHeap = freeHeap;
+    rtcCrash.minFreeHeap = minFree;
+    rtcCrash.largestBlock = largest;
+    portEXIT_CRITICAL(&ringMux);
+}
+
+void CrashLog::recordLine(const char *line)
+{
+    if (!line)
+        return;
+    const size_t len = strnlen(line, LINE_LEN - 1);
+
+    portENTER_CRITICAL(&ringMux);
+    if (rtcCrash.magic == RTC_MAGIC)
+    {
+        char *slot = rtcCrash.lines[rtcCrash.head];
+        memcpy(slot, line, len);
+        slot[len] = '\0';
+        rtcCrash.head = (uint8_t)((rtcCrash.head + 1) % LOG_LINES);
+        if (rtcCrash.count < LOG_LINES)
+            rtcCrash.count++;
+    }
+    portEXIT_CRITICAL(&ringMux);
+}
+
+bool CrashLog::persist()
+{
+    if (persisted_)
+        return true;
+
+    FileSystem &fs = FileSystem::instance();
+    PooledJsonDocument doc(JSON_CAPACITY, PooledJsonAllocator(MemoryAccounting::instance().registerModule("crashlog")));
+    if (fs.exists(CRASHLOG_PATH))
+    {
+        DeserializationError err = deserializeJson(doc, fs.read(CRASHLOG_PATH));
+        if (err || !doc.is<JsonArray>())
+        {
+            Logger::instance().warn(String("CrashLog: discarding unreadable ") + CRASHLOG_PATH);
+            doc.clear();
+        }
+    }
+    if (!doc.is<JsonArray>())
+        doc.to<JsonArray>();
+    JsonArray records = doc.as<JsonArray>();
+
+    while (records.size() >= MAX_RECORDS)
+        records.remove(0);
+
+    uint32_t boot = 1;
+    if (records.size() > 0)
+        boot = records[records.size() - 1]["boot"].as<uint32_t>() + 1;
+
+    JsonObject r = records.createNestedObject();
+    r["boot"] = boot;
+    r["reason"] = System::instance().resetReason();
+    r["abnormal"] = abnormal_;
+    r["fw"] = Version::toString();
+    if (System::instance().timeValid())
+    {
+        char buf[32];
+        System::formatIso8601(System::instance().now(), buf, sizeof(buf));
+        r["bootTime"] = buf;
+    }
+
+    if (prev_.valid)
+    {
+        JsonObject p = r.createNestedObject("previous");
+        p["uptimeMs"] = prev_.uptimeMs;
+        if (prev_.wallUs != 0)
+        {
+            char buf[32];
+            System::formatIso8601(prev_.wallUs, buf, sizeof(buf));
+            p["lastSeen"] = buf;
+        }
+        JsonObject heap = p.createNestedObject("heap");
+        heap["free"] = prev_.freeHeap;
+        heap["minFree"] = prev_.minFreeHeap;
+        heap["largest"] = prev_.largestBlock;
+
+        // Log tails only matter when something went wrong
+        if (abnormal_)
+        {
+            JsonArray lines = p.createNestedArray("log");
+            for (uint8_t i = 0; i < prev_.lineCount; ++i)
+                lines.add(prev_.lines[i]);
+        }
+    }
+
+    if (prev_.coreDump)
+    {
+        JsonObject cd = r.createNestedObject("coredump");
+        cd["task"] = prev_.task;
+        char hex[11];
+        snprintf(hex, sizeof(hex), "0x%08lx", (unsigned long)prev_.pc);
+        cd["pc"] = hex;
+        cd["corrupted"] = prev_.btCorrupted;
+        JsonArray bt = cd.createNestedArray("backtrace");
+        for (uint8_t i = 0; i < prev_.depth; ++i)
+        {
+            snprintf(hex, sizeof(hex), "0x%08lx", (unsigned long)prev_.backtrace[i]);
+            bt.add(hex);
+        }
+    }
+
+    String out;
+    serializeJson(doc, out);
+    if (!fs.write(CRASHLOG_PATH, out))
+    {
+        Logger::instance().error("CrashLog: failed to write crash log");
+        return false;
+    }
+    persisted_ = true;
+
+    if (abnormal_)
+        Logger::instance().warn(String("CrashLog: previous run ended with ") + System::instance().resetReason() +
+                                (prev_.valid ? String(" after ") + String((unsigned long)(prev_.uptimeMs / 1000)) + " s" : String("")) +
+                                (prev_.coreDump ? String(" in task ") + prev_.task : String("")) + "; see 'crashlog'");
+    return true;
+}
+
+String CrashLog::json() const
+{
+    FileSystem &fs = FileSystem::instance();
+    if (!fs.exists(CRASHLOG_PATH))
+        return String("[]");
+    return fs.read(CRASHLOG_PATH);
+}
+
+bool CrashLog::clear()
+{
+    FileSystem &fs = FileSystem::instance();
+    if (!fs.exists(CRASHLOG_PATH))
+        return true;
+    return fs.remove(CRASHLOG_PATH);
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <Arduino.h>
+#include "esp_system.h"
+
+/**
+ * @file crashLog.h
+ * @brief Singleton that keeps reset/crash forensics across reboots.
+ *
+ * While running, the last LOG_LINES log lines plus periodic heap/uptime samples are
+ * mirrored into RTC_NOINIT memory, which survives panics, watchdog and software
+ * resets (not power loss). On the next boot begin() snapshots that context together
+ * with the reset reason and, after a panic, the core dump summary (task, PC,
+ * backtrace) if the firmware has a core dump partition. persist() then appends one
+ * record per boot to /crashlog.json (newest last, at most MAX_RECORDS), so the boot
+ * history with the context of each abnormal reset is available from the console
+ * ("crashlog") and over HTTP (GET /api/crashlog).
+ *
+ * Usage:
+ *   CrashLog::instance().begin();   // first thing in setup(), before any logging
+ *   ...mount the filesystem...
+ *   CrashLog::instance().persist(); // write the record for this boot
+ *
+ * recordLine() is called by Logger for every line and is safe from any task.
+ */
+class CrashLog
+{
+public:
+    static CrashLog &instance();
+
+    void begin();
+    bool persist();
+
+    // Mirror a log line into the RTC ring (Logger calls this)
+    void recordLine(const char *line);
+
+    // Contents of /crashlog.json ("[]" if none) and removal
+    String json() const;
+    bool clear();
+
+    // Whether the previous run ended abnormally (panic, watchdog, brownout)
+    bool lastResetAbnormal() const { return abnormal_; }
+
+    static constexpr const char *CRASHLOG_PATH = "/crashlog.json";
+    static constexpr uint8_t MAX_RECORDS = 8;
+    static constexpr uint8_t LOG_LINES = 8;
+    static constexpr uint8_t LINE_LEN = 96;
+    static constexpr uint8_t MAX_BACKTRACE = 16;
+    static constexpr uint32_t SAMPLE_INTERVAL_MS = 1000;
+    static constexpr size_t JSON_CAPACITY = 20480; // parsing the full history
+
+private:
+    CrashLog();
+    ~CrashLog() = default;
+    CrashLog(const CrashLog &) = delete;
+    CrashLog &operator=(const CrashLog &) = delete;
+
+    // Context of the previous run, captured by begin()
+    struct Snapshot
+    {
+        bool valid = false; // RTC context was intact
+        uint64_t uptimeMs = 0;
+        int64_t wallUs = 0; // 0 = unknown
+        uint32_t freeHeap = 0;
+        uint32_t minFreeHeap = 0;
+        uint32_t largestBlock = 0;
+        uint8_t lineCount = 0;
+        char lines[LOG_LINES][LINE_LEN] = {};
+
+        bool coreDump = false;
+        char task[16] = {};
+        uint32_t pc = 0;
+        uint8_t depth = 0;
+        bool btCorrupted = false;
+        uint32_t backtrace[MAX_BACKTRACE] = {};
+    };
+
+    void sample();
+    void readCoreDump();
+
+    esp_reset_reason_t reason_;
+    bool abnormal_;
+    bool persisted_;
+    Snapshot prev_;
+};
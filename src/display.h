@@ -3,28 +3,33 @@
 #include <Arduino.h>
 #include <vector>
 #include <functional>
+#include "displayDriver.h"
 
 class Display
 {
 public:
-    // Get the singleton instance
-    static Display &instance();
+    // Get a panel instance: 0 = primary (default), 1 = secondary on the same bus.
+    static Display &instance(uint8_t index = 0);
 
-    // Initialize I2C (SDA, SCL) and the SSD1306. Returns true on success.
-    // Uses I2C address 0x3C and geometry 128x64.
+    // Initialize I2C (SDA, SCL) and the panel described by
+    // Config::getDisplay(index). Returns true on success.
     bool begin(uint8_t sda, uint8_t scl);
 
+    // Same as above with explicit controller type, address and geometry.
+    // Geometry height must be a multiple of 8 (page-major framebuffer).
+    bool begin(uint8_t sda, uint8_t scl, const DisplayGeometry &geometry);
+
     // Basic operations
     void clear();                       // clear buffer, does not push
     void update();                      // push buffer to display
     void setContrast(uint8_t contrast); // set contrast (0-255)
     void invert(bool inv);              // invert display
 
-    // Print text on a logical text line (0..7). Uses built-in small font.
+    // Print text on a logical text line (0..height/8-1). Uses built-in small font.
     // Text longer than line width will be clipped.
     void printLine(uint8_t line, const String &text);
 
-    // Show a vertical menu (items.size() up to 8 visible rows). Selected
+    // Show a vertical menu (up to height/8 visible rows). Selected
     // index is highlighted. Calls display() internally.
     void showMenu(const std::vector<String> &items, size_t selected);
 
@@ -49,8 +54,16 @@ public:
     // Query whether a splash screen is currently active.
     bool isSplashActive() const;
 
+    // Read-only view of the framebuffer in the controller's native
+    // page-major layout: width() * height() / 8 bytes, each byte a vertical
+    // strip of 8 pixels (LSB = top), pages ordered top to bottom.
+    // Returns nullptr when the display is unavailable.
+    const uint8_t *framebuffer() const;
+    uint16_t width() const;
+    uint16_t height() const;
+
 private:
-    Display();
+    explicit Display(uint8_t index);
     ~Display();
 
     // Non-copyable
@@ -61,4 +74,5 @@ private:
     struct Impl;
     Impl *_impl;
     bool _disabled;
+    uint8_t _index;
 };
@@ -0,0 +1,187 @@
+/**
+ * @file displayDriver.cpp
+ * @brief SSD1306, SH1106 and in-memory DisplayDriver backends.
+ */
+
+#include "displayDriver.h"
+#include "bufferAllocator.h"
+
+#include <Adafruit_SSD1306.h>
+#include <Adafruit_SH110X.h>
+
+namespace
+{
+    class Ssd1306Driver : public DisplayDriver
+    {
+    public:
+        Ssd1306Driver(const DisplayGeometry &g, TwoWire &bus)
+            : DisplayDriver(g), bus_(bus), oled_(g.width, g.height, &bus, -1) {}
+
+        bool begin() override
+        {
+            // Adafruit_SSD1306::begin() only fails on allocation; probe the address first
+            bus_.beginTransmission(geometry_.address);
+            if (bus_.endTransmission() != 0)
+                return false;
+            // SSD1306_SWITCHCAPVCC asks the library to use the charge pump.
+            // The bus is shared, so do not let the library re-initialize it.
+            return oled_.begin(SSD1306_SWITCHCAPVCC, geometry_.address, true, false);
+        }
+
+        Adafruit_GFX &gfx() override { return oled_; }
+        void clearBuffer() override { oled_.clearDisplay(); }
+        void flush() override { oled_.display(); }
+
+        void setContrast(uint8_t contrast) override
+        {
+            oled_.ssd1306_command(SSD1306_SETCONTRAST);
+            oled_.ssd1306_command(contrast);
+        }
+
+        void invert(bool inv) override { oled_.invertDisplay(inv); }
+
+        const uint8_t *buffer() const override
+        {
+            return const_cast<Adafruit_SSD1306 &>(oled_).getBuffer();
+        }
+
+    private:
+        TwoWire &bus_;
+        Adafruit_SSD1306 oled_;
+    };
+
+    // Adafruit_GrayOLED keeps its framebuffer protected; expose it read-only.
+    class Sh1106Panel : public Adafruit_SH1106G
+    {
+    public:
+        using Adafruit_SH1106G::Adafruit_SH1106G;
+        const uint8_t *frame() const { return buffer; }
+    };
+
+    class Sh1106Driver : public DisplayDriver
+    {
+    public:
+        Sh1106Driver(const DisplayGeometry &g, TwoWire &bus)
+            : DisplayDriver(g), oled_(g.width, g.height, &bus, -1) {}
+
+        bool begin() override { return oled_.begin(geometry_.address, true); }
+
+        Adafruit_GFX &gfx() override { return oled_; }
+        void clearBuffer() override { oled_.clearDisplay(); }
+        void flush() override { oled_.display(); }
+        void setContrast(uint8_t contrast) override { oled_.setContrast(contrast); }
+        void invert(bool inv) override { oled_.invertDisplay(inv); }
+
+        const uint8_t *buffer() const override { return oled_.frame(); }
+
+    private:
+        Sh1106Panel oled_;
+    };
+
+    // Adafruit_GFX surface over a page-major 1bpp buffer (rotation 0 only).
+    class PageBufferCanvas : public Adafruit_GFX
+    {
+    public:
+        // Latency-tolerant back buffer: PSRAM when fitted (see BufferAllocator)
+        PageBufferCanvas(uint16_t w, uint16_t h)
+            : Adafruit_GFX(w, h),
+              buffer_(static_cast<uint8_t *>(BufferAllocator::instance().allocate(
+                  (size_t)w * ((h + 7) / 8), BufferAllocator::Placement::Large,
+                  MemoryAccounting::instance().registerModule("display"))))
+        {
+            clear();
+        }
+
+        void drawPixel(int16_t x, int16_t y, uint16_t color) override
+        {
+            if (!buffer_ || x < 0 || y < 0 || x >= WIDTH || y >= HEIGHT)
+                return;
+            uint8_t &cell = buffer_[x + (y / 8) * WIDTH];
+            const uint8_t bit = 1 << (y & 7);
+            if (color == DISPLAY_WHITE)
+                cell |= bit;
+            else if (color == DISPLAY_BLACK)
+                cell &= ~bit;
+            else
+                cell ^= bit;
+        }
+
+        void clear()
+        {
+            if (buffer_)
+                memset(buffer_.get(), 0, size());
+        }
+        uint8_t *data() { return buffer_.get(); }
+        const uint8_t *data() const { return buffer_.get(); }
+        size_t size() const { return (size_t)WIDTH * ((HEIGHT + 7) / 8); }
+
+    private:
+        BufferPtr<uint8_t[]> buffer_;
+    };
+
+    class MemoryDriver : public DisplayDriver
+    {
+    public:
+        explicit MemoryDriver(const DisplayGeometry &g)
+            : DisplayDriver(g), canvas_(g.width, g.height) {}
+
+        bool begin() override { return canvas_.data() != nullptr; }
+        Adafruit_GFX &gfx() override { return canvas_; }
+        void clearBuffer() override { canvas_.clear(); }
+        void flush() override {}
+        void setContrast(uint8_t) override {}
+        void invert(bool) override {}
+        const uint8_t *buffer() const override { return canvas_.data(); }
+
+    private:
+        PageBufferCanvas canvas_;
+    };
+}
+
+DisplayController DisplayDriver::controllerFromString(const String &s)
+{
+    String t = s;
+    t.trim();
+    t.toLowerCase();
+    if (t == "ssd1306")
+        return DisplayController::Ssd1306;
+    if (t == "sh1106")
+        return DisplayController::Sh1106;
+    if (t == "memory")
+        return DisplayController::Memory;
+    return DisplayController::None;
+}
+
+const char *DisplayDriver::controllerToString(DisplayController c)
+{
+    switch (c)
+    {
+    case DisplayController::Ssd1306:
+        return "ssd1306";
+    case DisplayController::Sh1106:
+        return "sh1106";
+    case DisplayController::Memory:
+        return "memory";
+    default:
+        return "none";
+    }
+}
+
+std::unique_ptr<DisplayDriver> DisplayDriver::create(const DisplayGeometry &geometry, TwoWire &bus)
+{
+    // Page-major buffers need whole pages
+    if (geometry.width == 0 || geometry.height == 0 || (geometry.height % 8) != 0)
+        return nullptr;
+
+    switch (geometry.controller)
+    {
+    case DisplayController::Ssd1306:
+        return std::unique_ptr<DisplayDriver>(new Ssd1306Driver(geometry, bus));
+    case DisplayController::Sh1106:
+        return std::unique_ptr<DisplayDriver>(new Sh1106Driver(geometry, bus));
+    case DisplayController::Memory:
+        return std::unique_ptr<DisplayDriver>(new MemoryDriver(geometry));
+    default:
+        return nullptr;
+    }
+}
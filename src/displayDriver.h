@@ -0,0 +1,83 @@
+#pragma once
+/**
+ * @file displayDriver.h
+ * @brief Controller abstraction for monochrome I2C OLED panels.
+ *
+ * A DisplayDriver owns the framebuffer for one panel and exposes it through
+ * Adafruit_GFX for drawing. Each backend keeps the framebuffer in the
+ * controller's native page-major layout (width * height / 8 bytes, each byte a
+ * vertical strip of 8 pixels, LSB = top) so flushing never converts pixels.
+ *
+ * Backends:
+ *  - Ssd1306: Adafruit_SSD1306 (128x64 / 128x32 panels)
+ *  - Sh1106:  Adafruit_SH1106G (1.3" 128x64 panels, 132-column controller)
+ *  - Memory:  framebuffer only, no bus traffic; used for headless units and
+ *             for rendering without hardware.
+ *
+ * Several drivers may share one TwoWire bus as long as their addresses differ.
+ */
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <Adafruit_GFX.h>
+#include <memory>
+
+// Pixel colors for 1bpp panels (identical across the supported controllers)
+constexpr uint16_t DISPLAY_BLACK = 0;
+constexpr uint16_t DISPLAY_WHITE = 1;
+
+enum class DisplayController : uint8_t
+{
+    None = 0, // panel not fitted
+    Ssd1306,
+    Sh1106,
+    Memory
+};
+
+struct DisplayGeometry
+{
+    DisplayController controller = DisplayController::Ssd1306;
+    uint8_t address = 0x3C;
+    uint16_t width = 128;
+    uint16_t height = 64;
+};
+
+class DisplayDriver
+{
+public:
+    virtual ~DisplayDriver() = default;
+
+    // Probe and initialize the controller. Returns false if the panel does not respond.
+    virtual bool begin() = 0;
+
+    // Drawing surface backed by the framebuffer.
+    virtual Adafruit_GFX &gfx() = 0;
+
+    // Clear the framebuffer (no bus traffic).
+    virtual void clearBuffer() = 0;
+
+    // Push the framebuffer to the panel.
+    virtual void flush() = 0;
+
+    virtual void setContrast(uint8_t contrast) = 0;
+    virtual void invert(bool inv) = 0;
+
+    // Native page-major framebuffer, or nullptr before begin().
+    virtual const uint8_t *buffer() const = 0;
+
+    uint16_t width() const { return geometry_.width; }
+    uint16_t height() const { return geometry_.height; }
+    const DisplayGeometry &geometry() const { return geometry_; }
+
+    // Parse/format controller names used in Config ("ssd1306", "sh1106", "memory", "none").
+    static DisplayController controllerFromString(const String &s);
+    static const char *controllerToString(DisplayController c);
+
+    // Create the backend for `geometry` on `bus`. Returns nullptr for DisplayController::None.
+    static std::unique_ptr<DisplayDriver> create(const DisplayGeometry &geometry, TwoWire &bus);
+
+protected:
+    explicit DisplayDriver(const DisplayGeometry &geometry) : geometry_(geometry) {}
+
+    DisplayGeometry geometry_;
+};
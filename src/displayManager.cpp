@@ -1,7 +1,43 @@
 #include "displayManager.h"
 #include "display.h"
 #include "Logger.h"
+#include "system.h"
 #include "config.h"
+#include "trace.h"
+
+#include <utility>
+
+constexpr uint8_t DisplayManager::ROWS;
+constexpr uint8_t DisplayManager::COLS;
+constexpr uint8_t DisplayManager::CMD_QUEUE_DEPTH;
+
+void DisplayManager::ScreenText::clear()
+{
+    memset(lines, 0, sizeof(lines));
+}
+
+void DisplayManager::ScreenText::set(uint8_t row, const String &text)
+{
+    if (row >= ROWS)
+        return;
+    strncpy(lines[row], text.c_str(), COLS);
+    lines[row][COLS] = '\0';
+}
+
+bool DisplayManager::ScreenText::empty() const
+{
+    for (uint8_t i = 0; i < ROWS; ++i)
+    {
+        if (lines[i][0] != '\0')
+            return false;
+    }
+    return true;
+}
+
+bool DisplayManager::ScreenText::operator==(const ScreenText &other) const
+{
+    return memcmp(lines, other.lines, sizeof(lines)) == 0;
+}
 
 DisplayManager &DisplayManager::instance()
 {
@@ -9,8 +45,30 @@ DisplayManager &DisplayManager::instance()
     return inst;
 }
 
+DisplayManager::DisplayManager()
+    : freeCount_(MAX_QUEUED), heapSize_(0), nextSeq_(0),
+      current_(NONE), currentSinceMs_(0),
+      ambientCount_(1), ambientIndex_(0), ambientSinceMs_(0), ambientRefreshMs_(0),
+      shownValid_(false), forceRender_(true), owner_(nullptr)
+{
+    for (uint8_t i = 0; i < MAX_QUEUED; ++i)
+        freeList_[i] = static_cast<int8_t>(MAX_QUEUED - 1 - i);
+
+    // Slot 0 is the status screen fed by showStatus()/showStatusAt()
+    ambient_[0].name = "status";
+    ambient_[0].text.clear();
+    shown_.clear();
+}
+
 bool DisplayManager::initWithSplash(uint8_t sda, uint8_t scl, const String &title, const String &subtitle, uint32_t durationMs)
 {
+    owner_ = xTaskGetCurrentTaskHandle();
+
+    // Optional secondary panel on the same bus; it stays blank until a
+    // caller draws on Display::instance(1).
+    if (Display::instance(1).begin(sda, scl))
+        Logger::instance().info("Display: secondary panel initialized");
+
     if (Display::instance().begin(sda, scl))
     {
         // Register a callback so we can show any queued status after the
@@ -24,113 +82,397 @@ bool DisplayManager::initWithSplash(uint8_t sda, uint8_t scl, const String &titl
 
 void DisplayManager::showStatus(const String &line0, const String &line1)
 {
-    // If splash is active, queue the status to be shown afterwards.
-    if (!Display::instance().available())
-        return;
-
-    if (Display::instance().isSplashActive())
+    if (fromOtherTask())
     {
-        _queuedLines[0] = line0;
-        _queuedLines[1] = line1;
-        _queuedIsError = false;
+        Command cmd = {};
+        cmd.op = Command::Op::Status;
+        cmd.text.clear();
+        cmd.text.set(0, line0);
+        cmd.text.set(1, line1);
+        enqueue(cmd);
         return;
     }
-
-    Display::instance().clear();
-    Display::instance().printLine(0, line0);
-    if (!line1.isEmpty())
-        Display::instance().printLine(1, line1);
-    Display::instance().update();
+    applyStatus(0, line0, line1, true);
 }
 
 void DisplayManager::showStatusAt(uint8_t startLine, const String &line0, const String &line1)
 {
-    if (!Display::instance().available())
+    if (fromOtherTask())
+    {
+        Command cmd = {};
+        cmd.op = Command::Op::StatusAt;
+        cmd.startLine = startLine;
+        cmd.text.clear();
+        cmd.text.set(0, line0);
+        cmd.text.set(1, line1);
+        enqueue(cmd);
         return;
+    }
+    applyStatus(startLine, line0, line1, false);
+}
 
-    // clamp startLine to valid range
-    if (startLine >= 8)
-        startLine = 0;
+void DisplayManager::showError(const String &msg)
+{
+    ScreenText t;
+    t.clear();
+    t.set(0, msg);
+    if (!post(Severity::Error, t, 0))
+        Logger::instance().warn(String("DisplayManager: queue full, dropped error '") + msg + "'");
+}
 
-    if (Display::instance().isSplashActive())
+void DisplayManager::clearError()
+{
+    if (fromOtherTask())
     {
-        if (startLine < 8)
-            _queuedLines[startLine] = line0;
-        if (startLine + 1 < 8 && !line1.isEmpty())
-            _queuedLines[startLine + 1] = line1;
-        _queuedIsError = false;
+        Command cmd = {};
+        cmd.op = Command::Op::ClearError;
+        enqueue(cmd);
         return;
     }
+    applyClearError();
+}
 
-    Display::instance().clear();
-    Display::instance().printLine(startLine, line0);
-    if (!line1.isEmpty())
-        Display::instance().printLine(startLine + 1, line1);
-    Display::instance().update();
+bool DisplayManager::post(Severity severity, const ScreenText &text, uint32_t durationMs)
+{
+    if (fromOtherTask())
+    {
+        Command cmd = {};
+        cmd.op = Command::Op::Post;
+        cmd.severity = severity;
+        cmd.durationMs = durationMs;
+        cmd.text = text;
+        return enqueue(cmd);
+    }
+    return applyPost(severity, text, durationMs);
 }
 
-void DisplayManager::showError(const String &msg)
+bool DisplayManager::post(Severity severity, const String &line0, const String &line1, uint32_t durationMs)
+{
+    ScreenText t;
+    t.clear();
+    t.set(0, line0);
+    t.set(1, line1);
+    return post(severity, t, durationMs);
+}
+
+bool DisplayManager::addAmbient(const char *name, AmbientProvider provider)
+{
+    const uint8_t n = ambientCount_.load(std::memory_order_relaxed);
+    if (n >= MAX_AMBIENT || !provider)
+        return false;
+    Ambient &a = ambient_[n];
+    a.name = name;
+    a.provider = provider;
+    a.text.clear();
+    ambientCount_.store(n + 1, std::memory_order_release);
+    return true;
+}
+
+void DisplayManager::run()
 {
-    if (!Display::instance().available())
+    drainCommands();
+
+    // Delegate splash loop (Display handles no-op if unavailable).
+    Display::instance().splashLoop();
+
+    // Keep queueing while the splash is up; everything is shown afterwards.
+    if (!Display::instance().available() || Display::instance().isSplashActive())
         return;
 
-    if (Display::instance().isSplashActive())
+    const uint64_t now = System::instance().monotonicMs();
+
+    // Expire the visible timed screen.
+    if (current_ != NONE)
     {
-        _queuedLines[0] = msg;
-        _queuedIsError = true;
+        const Entry &cur = pool_[current_];
+        if (cur.durationMs != 0 && (now - currentSinceMs_) >= cur.durationMs)
+        {
+            releaseEntry(current_);
+            current_ = NONE;
+            forceRender_ = true;
+        }
+    }
+
+    // Preempt: a more severe screen wins; a sticky screen yields to a newer one
+    // of the same severity.
+    if (heapSize_ > 0)
+    {
+        const int8_t top = heap_[0];
+        bool takeTop = (current_ == NONE);
+        if (!takeTop)
+        {
+            const Entry &cur = pool_[current_];
+            takeTop = (pool_[top].severity > cur.severity) ||
+                      (pool_[top].severity == cur.severity && cur.durationMs == 0);
+        }
+
+        if (takeTop)
+        {
+            heapPop();
+            if (current_ != NONE)
+            {
+                Entry &cur = pool_[current_];
+                if (cur.durationMs == 0 && cur.severity == pool_[top].severity)
+                {
+                    releaseEntry(current_); // replaced
+                }
+                else
+                {
+                    // Requeue with whatever time it had left
+                    if (cur.durationMs != 0)
+                        cur.durationMs -= (uint32_t)min<uint64_t>(cur.durationMs - 1, now - currentSinceMs_);
+                    heapPush(current_);
+                }
+            }
+            current_ = top;
+            currentSinceMs_ = now;
+            forceRender_ = true;
+        }
+    }
+
+    if (current_ != NONE)
+    {
+        if (forceRender_)
+            render(pool_[current_].text);
         return;
     }
 
+    showAmbient(now, (now - ambientSinceMs_) >= AMBIENT_ROTATE_MS);
+}
+
+void DisplayManager::showAmbient(uint64_t now, bool advance)
+{
+    if (advance)
+    {
+        // Next ambient screen that has something to show (status may be blank).
+        const uint8_t count = ambientCount_.load(std::memory_order_acquire);
+        for (uint8_t n = 0; n < count; ++n)
+        {
+            ambientIndex_ = (ambientIndex_ + 1) % count;
+            const Ambient &a = ambient_[ambientIndex_];
+            if (a.provider || !a.text.empty())
+                break;
+        }
+        ambientSinceMs_ = now;
+        forceRender_ = true;
+    }
+
+    Ambient &a = ambient_[ambientIndex_];
+    if (a.provider && (forceRender_ || (now - ambientRefreshMs_) >= AMBIENT_REFRESH_MS))
+    {
+        a.text.clear();
+        a.provider(a.text);
+        ambientRefreshMs_ = now;
+        forceRender_ = true;
+    }
+
+    if (forceRender_)
+        render(a.text);
+}
+
+void DisplayManager::render(const ScreenText &text)
+{
+    forceRender_ = false;
+    if (shownValid_ && text == shown_)
+        return;
+    shown_ = text;
+    shownValid_ = true;
+
+    TRACE_SCOPE("display.i2c");
     Display::instance().clear();
-    Display::instance().printLine(0, msg);
+    for (uint8_t i = 0; i < ROWS; ++i)
+    {
+        if (text.lines[i][0] != '\0')
+            Display::instance().printLine(i, String(text.lines[i]));
+    }
     Display::instance().update();
 }
 
-void DisplayManager::run()
+void DisplayManager::onSplashFinished()
 {
-    // Delegate splash loop (Display handles no-op if unavailable).
-    Display::instance().splashLoop();
+    // The splash drew over the panel; redraw whatever should be visible now.
+    shownValid_ = false;
+    forceRender_ = true;
 }
 
-void DisplayManager::onSplashFinished()
+bool DisplayManager::available() const
 {
-    // If something was queued while the splash was active, show it now.
-    bool anyQueued = false;
-    for (int i = 0; i < 8; ++i)
+    return Display::instance().available();
+}
+
+// ---- cross-task commands ----
+
+bool DisplayManager::fromOtherTask() const
+{
+    return owner_ && xTaskGetCurrentTaskHandle() != owner_;
+}
+
+bool DisplayManager::enqueue(const Command &cmd)
+{
+    // Never blocks the caller; the owner drains the queue every run()
+    return commands_.push(cmd);
+}
+
+void DisplayManager::drainCommands()
+{
+    Command cmd;
+    while (commands_.pop(cmd))
     {
-        if (!_queuedLines[i].isEmpty())
+        switch (cmd.op)
         {
-            anyQueued = true;
+        case Command::Op::Post:
+            if (!applyPost(cmd.severity, cmd.text, cmd.durationMs))
+                Logger::instance().warn(String("DisplayManager: queue full, dropped '") + cmd.text.lines[0] + "'");
+            break;
+        case Command::Op::Status:
+            applyStatus(0, cmd.text.lines[0], cmd.text.lines[1], true);
+            break;
+        case Command::Op::StatusAt:
+            applyStatus(cmd.startLine, cmd.text.lines[0], cmd.text.lines[1], false);
+            break;
+        case Command::Op::ClearError:
+            applyClearError();
             break;
         }
     }
+}
+
+void DisplayManager::applyStatus(uint8_t startLine, const String &line0, const String &line1, bool replace)
+{
+    // clamp startLine to valid range
+    if (startLine >= ROWS)
+        startLine = 0;
+
+    ScreenText &t = ambient_[0].text;
+    if (replace)
+    {
+        t.clear();
+        t.set(0, line0);
+        t.set(1, line1);
+    }
+    else
+    {
+        t.set(startLine, line0);
+        if (!line1.isEmpty())
+            t.set(startLine + 1, line1);
+    }
+
+    // Bring the status screen forward so the update is visible right away.
+    ambientIndex_ = 0;
+    ambientSinceMs_ = System::instance().monotonicMs();
+    forceRender_ = true;
+}
+
+bool DisplayManager::applyPost(Severity severity, const ScreenText &text, uint32_t durationMs)
+{
+    int8_t idx = allocEntry();
+    if (idx == NONE)
+        return false;
 
-    if (anyQueued)
+    Entry &e = pool_[idx];
+    e.text = text;
+    e.severity = severity;
+    e.durationMs = durationMs;
+    e.seq = nextSeq_++;
+    heapPush(idx);
+    return true;
+}
+
+void DisplayManager::applyClearError()
+{
+    if (current_ != NONE && pool_[current_].severity == Severity::Error)
+    {
+        releaseEntry(current_);
+        current_ = NONE;
+        forceRender_ = true;
+    }
+    for (uint8_t pos = 0; pos < heapSize_;)
     {
-        if (_queuedIsError)
+        int8_t idx = heap_[pos];
+        if (pool_[idx].severity == Severity::Error)
         {
-            // Error messages are shown on line 0 only
-            showError(_queuedLines[0]);
+            heapRemoveAt(pos);
+            releaseEntry(idx);
         }
         else
         {
-            Display::instance().clear();
-            for (uint8_t i = 0; i < 8; ++i)
-            {
-                if (!_queuedLines[i].isEmpty())
-                    Display::instance().printLine(i, _queuedLines[i]);
-            }
-            Display::instance().update();
+            ++pos;
         }
+    }
+}
+
+// ---- fixed pool / heap helpers ----
 
-        // Clear queue
-        for (int i = 0; i < 8; ++i)
-            _queuedLines[i] = String();
-        _queuedIsError = false;
+bool DisplayManager::higher(int8_t a, int8_t b) const
+{
+    const Entry &ea = pool_[a];
+    const Entry &eb = pool_[b];
+    if (ea.severity != eb.severity)
+        return ea.severity > eb.severity;
+    return (int32_t)(eb.seq - ea.seq) > 0;
+}
+
+void DisplayManager::heapPush(int8_t idx)
+{
+    uint8_t pos = heapSize_++;
+    heap_[pos] = idx;
+    while (pos > 0)
+    {
+        uint8_t parent = (pos - 1) / 2;
+        if (!higher(heap_[pos], heap_[parent]))
+            break;
+        std::swap(heap_[pos], heap_[parent]);
+        pos = parent;
     }
 }
 
-bool DisplayManager::available() const
+int8_t DisplayManager::heapPop()
 {
-    return Display::instance().available();
+    if (heapSize_ == 0)
+        return NONE;
+    int8_t top = heap_[0];
+    heapRemoveAt(0);
+    return top;
+}
+
+void DisplayManager::heapRemoveAt(uint8_t pos)
+{
+    heap_[pos] = heap_[--heapSize_];
+    if (pos >= heapSize_)
+        return;
+
+    // Sift up (the moved element may outrank its new parent) ...
+    while (pos > 0 && higher(heap_[pos], heap_[(pos - 1) / 2]))
+    {
+        std::swap(heap_[pos], heap_[(pos - 1) / 2]);
+        pos = (pos - 1) / 2;
+    }
+    // ... then down.
+    for (;;)
+    {
+        uint8_t best = pos;
+        uint8_t l = 2 * pos + 1;
+        uint8_t r = l + 1;
+        if (l < heapSize_ && higher(heap_[l], heap_[best]))
+            best = l;
+        if (r < heapSize_ && higher(heap_[r], heap_[best]))
+            best = r;
+        if (best == pos)
+            break;
+        std::swap(heap_[pos], heap_[best]);
+        pos = best;
+    }
+}
+
+int8_t DisplayManager::allocEntry()
+{
+    if (freeCount_ == 0)
+        return NONE;
+    return freeList_[--freeCount_];
+}
+
+void DisplayManager::releaseEntry(int8_t idx)
+{
+    if (idx != NONE && freeCount_ < MAX_QUEUED)
+        freeList_[freeCount_++] = idx;
 }
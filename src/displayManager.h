@@ -1,37 +1,186 @@
 #pragma once
 
 #include <Arduino.h>
+#include <atomic>
+#include <functional>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "lockFreeQueue.h"
 
+/**
+ * @file displayManager.h
+ * @brief Decides what the primary display shows.
+ *
+ * Screens are queued by severity and shown highest-severity first:
+ *  - Error/Warning/Info screens are posted with a duration (0 = until replaced
+ *    by another screen of the same severity or dismissed).
+ *  - A more severe screen preempts the current one; the preempted screen goes
+ *    back into the queue with its remaining time.
+ *  - When nothing is queued, ambient screens (status, network, ...) rotate.
+ *
+ * The queue is a binary heap over a fixed pool, so posting is O(log n) and
+ * never allocates. run() does all rendering and never blocks; it only touches
+ * the bus when the visible content changes.
+ *
+ * The task that calls initWithSplash() owns the manager and must be the one calling
+ * run(). post(), showStatus(), showStatusAt(), showError() and clearError() may be
+ * called from any task: from other tasks they are copied into a lock-free command queue
+ * (CMD_QUEUE_DEPTH deep) and applied at the start of the next run(). addAmbient() may
+ * also be called from another task (one task at a time): a screen is published only
+ * once its slot is filled.
+ */
 class DisplayManager
 {
 public:
+    enum class Severity : uint8_t
+    {
+        Ambient = 0,
+        Info,
+        Warning,
+        Error
+    };
+
+    // Text grid of one screen (built-in font on a 128x64 panel)
+    static constexpr uint8_t ROWS = 8;
+    static constexpr uint8_t COLS = 21;
+
+    struct ScreenText
+    {
+        char lines[ROWS][COLS + 1];
+
+        void clear();
+        // Copy `text` into `row` (clipped to COLS). Out-of-range rows are ignored.
+        void set(uint8_t row, const String &text);
+        bool empty() const;
+        bool operator==(const ScreenText &other) const;
+    };
+
+    // Fills an ambient screen just before it is shown.
+    using AmbientProvider = std::function<void(ScreenText &text)>;
+
     static DisplayManager &instance();
 
     // Initialize display and start a splash if available.
     // Returns true on successful init.
     bool initWithSplash(uint8_t sda, uint8_t scl, const String &title, const String &subtitle, uint32_t durationMs = 3000);
 
-    // Show two-line status; second line may be empty.
+    // Update the ambient status screen (two lines; second may be empty).
     void showStatus(const String &line0, const String &line1 = String());
-    // Show two-line status starting at a specific logical line (0..7).
-    // Useful for multi-line layouts where callers want to place text
-    // at arbitrary rows (e.g., show additional info on lines 2..3).
+    // Update two lines of the ambient status screen starting at a specific
+    // logical line (0..7), keeping the other lines. Useful for multi-line
+    // layouts (e.g., show additional info on lines 2..3).
     void showStatusAt(uint8_t startLine, const String &line0, const String &line1 = String());
 
-    // Show a single-line error message (on line 0).
+    // Show a single-line error message (on line 0) until cleared or replaced
+    // by another error.
     void showError(const String &msg);
 
-    // Call from loop() to drive splash lifecycle.
+    // Dismiss all queued and visible error screens.
+    void clearError();
+
+    // Queue a screen. durationMs == 0 keeps it until a screen of the same
+    // severity replaces it. Returns false if the queue (or, from another task,
+    // the command queue) is full.
+    bool post(Severity severity, const ScreenText &text, uint32_t durationMs);
+
+    // Convenience: queue a two-line screen.
+    bool post(Severity severity, const String &line0, const String &line1, uint32_t durationMs);
+
+    // Register an ambient screen shown in rotation when the queue is empty.
+    // The built-in "status" screen (fed by showStatus) is always first.
+    bool addAmbient(const char *name, AmbientProvider provider);
+
+    // Call from the owning task to apply queued commands and drive splash
+    // lifecycle, expiry, preemption and rotation.
     void run();
 
     // Convenience: whether low-level display is available.
     bool available() const;
 
 private:
-    DisplayManager() = default;
-    // Queued lines shown after splash finishes (up to 8 logical text rows)
-    String _queuedLines[8];
-    bool _queuedIsError = false;
+    DisplayManager();
+
+    static constexpr uint8_t MAX_QUEUED = 8;
+    static constexpr uint8_t MAX_AMBIENT = 4;
+    static constexpr uint32_t AMBIENT_ROTATE_MS = 5000;
+    static constexpr uint32_t AMBIENT_REFRESH_MS = 1000;
+    static constexpr int8_t NONE = -1;
+    static constexpr uint8_t CMD_QUEUE_DEPTH = 16;
+
+    // A mutator call made from a task other than the owner
+    struct Command
+    {
+        enum class Op : uint8_t
+        {
+            Post,
+            Status,
+            StatusAt,
+            ClearError
+        };
+        Op op;
+        Severity severity;
+        uint8_t startLine;
+        uint32_t durationMs;
+        ScreenText text; // Status/StatusAt: lines 0 and 1
+    };
+
+    struct Entry
+    {
+        ScreenText text;
+        Severity severity;
+        uint32_t durationMs; // 0 = sticky
+        uint32_t seq;        // FIFO order among equal severities
+    };
+
+    struct Ambient
+    {
+        const char *name;
+        AmbientProvider provider;
+        ScreenText text;
+    };
+
+    // Fixed pool + binary max-heap of pool indices
+    Entry pool_[MAX_QUEUED];
+    int8_t freeList_[MAX_QUEUED];
+    uint8_t freeCount_;
+    int8_t heap_[MAX_QUEUED];
+    uint8_t heapSize_;
+    uint32_t nextSeq_;
+
+    // Currently visible queued screen (pool index) or NONE when ambient
+    int8_t current_;
+    uint64_t currentSinceMs_;
+
+    Ambient ambient_[MAX_AMBIENT];
+    std::atomic<uint8_t> ambientCount_; // written by addAmbient(), read by run()
+    uint8_t ambientIndex_;
+    uint64_t ambientSinceMs_;
+    uint64_t ambientRefreshMs_;
+
+    // What the panel currently shows (invalid after the splash drew over it)
+    ScreenText shown_;
+    bool shownValid_;
+    bool forceRender_;
+
+    TaskHandle_t owner_; // nullptr until initWithSplash(): everything is applied directly
+    MpscQueue<Command, CMD_QUEUE_DEPTH> commands_;
+
+    bool higher(int8_t a, int8_t b) const;
+    void heapPush(int8_t idx);
+    int8_t heapPop();
+    void heapRemoveAt(uint8_t pos);
+    int8_t allocEntry();
+    void releaseEntry(int8_t idx);
+
+    bool fromOtherTask() const;
+    bool enqueue(const Command &cmd);
+    void drainCommands();
+    void applyStatus(uint8_t startLine, const String &line0, const String &line1, bool replace);
+    bool applyPost(Severity severity, const ScreenText &text, uint32_t durationMs);
+    void applyClearError();
+
+    void render(const ScreenText &text);
+    void showAmbient(uint64_t now, bool advance);
 
     // Called by the display when the splash finishes.
     void onSplashFinished();
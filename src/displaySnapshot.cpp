@@ -0,0 +1,253 @@
+/**
+ * @file displaySnapshot.cpp
+ * @brief PNG/PBM encoders for the page-major display framebuffer.
+ *
+ * Implementation notes:
+ *  - PNG uses a single zlib stream made of stored deflate blocks (no compression),
+ *    which keeps the encoder allocation-free and the output size predictable.
+ *  - CRC32 and Adler-32 are updated incrementally as rows are produced.
+ *  - Output goes through a small stack buffer so network sinks see a few larger
+ *    writes instead of one write per byte.
+ */
+
+#include "displaySnapshot.h"
+
+namespace
+{
+    constexpr uint8_t PNG_SIGNATURE[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    constexpr size_t DEFLATE_MAX_STORED = 65535;
+
+    // Nibble-wise CRC32 table (polynomial 0xEDB88320)
+    constexpr uint32_t CRC_NIBBLE[16] = {
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+        0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C};
+
+    inline uint8_t pixelAt(const uint8_t *fb, uint16_t width, uint16_t x, uint16_t y)
+    {
+        return (fb[x + (y / 8) * width] >> (y & 7)) & 0x01;
+    }
+
+    // Pack one framebuffer row into MSB-first bytes (PNG/PBM row order).
+    void packRow(const uint8_t *fb, uint16_t width, uint16_t y, uint8_t *row)
+    {
+        const size_t rowBytes = (width + 7) / 8;
+        memset(row, 0, rowBytes);
+        for (uint16_t x = 0; x < width; ++x)
+        {
+            if (pixelAt(fb, width, x, y))
+                row[x / 8] |= 0x80 >> (x & 7);
+        }
+    }
+
+    // Buffered sink that tracks a running PNG chunk CRC and zlib Adler-32.
+    class SnapshotWriter
+    {
+    public:
+        explicit SnapshotWriter(Print &out) : out_(out) {}
+        ~SnapshotWriter() { flush(); }
+
+        void put(const uint8_t *data, size_t len)
+        {
+            for (size_t i = 0; i < len; ++i)
+            {
+                const uint8_t b = data[i];
+                crc_ ^= b;
+                crc_ = (crc_ >> 4) ^ CRC_NIBBLE[crc_ & 0x0F];
+                crc_ = (crc_ >> 4) ^ CRC_NIBBLE[crc_ & 0x0F];
+                buf_[used_++] = b;
+                if (used_ == sizeof(buf_))
+                    flush();
+            }
+        }
+
+        void put8(uint8_t v) { put(&v, 1); }
+
+        void put32be(uint32_t v)
+        {
+            const uint8_t b[4] = {uint8_t(v >> 24), uint8_t(v >> 16), uint8_t(v >> 8), uint8_t(v)};
+            put(b, sizeof(b));
+        }
+
+        // Image data inside the zlib stream also feeds the Adler-32 checksum.
+        void putData(const uint8_t *data, size_t len)
+        {
+            for (size_t i = 0; i < len; ++i)
+            {
+                adlerA_ = (adlerA_ + data[i]) % 65521;
+                adlerB_ = (adlerB_ + adlerA_) % 65521;
+            }
+            put(data, len);
+        }
+
+        void beginChunk(uint32_t length, const char *type)
+        {
+            put32be(length);
+            crc_ = 0xFFFFFFFF;
+            put(reinterpret_cast<const uint8_t *>(type), 4);
+        }
+
+        void endChunk() { put32be(crc_ ^ 0xFFFFFFFF); }
+
+        uint32_t adler() const { return (adlerB_ << 16) | adlerA_; }
+
+        void flush()
+        {
+            if (used_ == 0)
+                return;
+            if (out_.write(buf_, used_) != used_)
+                ok_ = false;
+            used_ = 0;
+        }
+
+        bool ok() const { return ok_; }
+
+    private:
+        Print &out_;
+        uint8_t buf_[64];
+        size_t used_ = 0;
+        uint32_t crc_ = 0xFFFFFFFF;
+        uint32_t adlerA_ = 1;
+        uint32_t adlerB_ = 0;
+        bool ok_ = true;
+    };
+
+    // "P1\n<w> <h>\n" / "P4\n<w> <h>\n"
+    int formatPbmHeader(char *buf, size_t len, uint16_t width, uint16_t height, bool ascii)
+    {
+        return snprintf(buf, len, "%s\n%u %u\n", ascii ? "P1" : "P4", (unsigned)width, (unsigned)height);
+    }
+
+    size_t rawImageSize(uint16_t width, uint16_t height)
+    {
+        // One filter byte per row followed by packed pixels
+        return static_cast<size_t>(height) * (1 + (width + 7) / 8);
+    }
+
+    size_t idatLength(uint16_t width, uint16_t height)
+    {
+        const size_t raw = rawImageSize(width, height);
+        const size_t blocks = raw == 0 ? 1 : (raw + DEFLATE_MAX_STORED - 1) / DEFLATE_MAX_STORED;
+        // zlib header + stored block headers + data + Adler-32
+        return 2 + blocks * 5 + raw + 4;
+    }
+}
+
+size_t DisplaySnapshot::pngSize(uint16_t width, uint16_t height)
+{
+    // signature + IHDR + IDAT + IEND
+    return sizeof(PNG_SIGNATURE) + (12 + 13) + (12 + idatLength(width, height)) + 12;
+}
+
+bool DisplaySnapshot::writePng(Print &out, const uint8_t *fb, uint16_t width, uint16_t height)
+{
+    // Refuse before writing anything: a truncated PNG after the signature is worse than none
+    const size_t rowBytes = (width + 7) / 8;
+    uint8_t row[1 + (1024 + 7) / 8];
+    if (!fb || width == 0 || height == 0 || rowBytes + 1 > sizeof(row))
+        return false;
+
+    SnapshotWriter w(out);
+    w.put(PNG_SIGNATURE, sizeof(PNG_SIGNATURE));
+
+    // IHDR: 1-bit grayscale, no interlace
+    w.beginChunk(13, "IHDR");
+    w.put32be(width);
+    w.put32be(height);
+    w.put8(1); // bit depth
+    w.put8(0); // color type: grayscale
+    w.put8(0); // compression
+    w.put8(0); // filter
+    w.put8(0); // interlace
+    w.endChunk();
+
+    // IDAT: zlib stream of stored blocks, one packed row at a time
+    w.beginChunk(static_cast<uint32_t>(idatLength(width, height)), "IDAT");
+    w.put8(0x78);
+    w.put8(0x01);
+
+    size_t remaining = rawImageSize(width, height);
+    size_t blockLeft = 0;
+    uint16_t y = 0;
+    size_t rowPos = rowBytes + 1; // force first row pack
+
+    while (remaining > 0)
+    {
+        if (blockLeft == 0)
+        {
+            blockLeft = min(remaining, DEFLATE_MAX_STORED);
+            const uint16_t len = static_cast<uint16_t>(blockLeft);
+            w.put8(remaining == blockLeft ? 0x01 : 0x00); // BFINAL, BTYPE=00
+            w.put8(len & 0xFF);
+            w.put8(len >> 8);
+            w.put8(~len & 0xFF);
+            w.put8((~len >> 8) & 0xFF);
+        }
+
+        if (rowPos > rowBytes)
+        {
+            row[0] = 0; // filter: none
+            packRow(fb, width, y++, row + 1);
+            rowPos = 0;
+        }
+
+        const size_t n = min(min(blockLeft, remaining), rowBytes + 1 - rowPos);
+        w.putData(row + rowPos, n);
+        rowPos += n;
+        blockLeft -= n;
+        remaining -= n;
+    }
+
+    w.put32be(w.adler());
+    w.endChunk();
+
+    w.beginChunk(0, "IEND");
+    w.endChunk();
+
+    w.flush();
+    return w.ok();
+}
+
+size_t DisplaySnapshot::pbmSize(uint16_t width, uint16_t height, bool ascii)
+{
+    char header[24];
+    const size_t headerLen = (size_t)formatPbmHeader(header, sizeof(header), width, height, ascii);
+    const size_t rowLen = ascii ? (size_t)width + 1 : (size_t)(width + 7) / 8;
+    return headerLen + rowLen * height;
+}
+
+bool DisplaySnapshot::writePbm(Print &out, const uint8_t *fb, uint16_t width, uint16_t height, bool ascii)
+{
+    const size_t rowBytes = (width + 7) / 8;
+    uint8_t row[(1024 + 7) / 8];
+    if (!fb || width == 0 || height == 0 || (!ascii && rowBytes > sizeof(row)))
+        return false;
+
+    SnapshotWriter w(out);
+    char header[24];
+    const int n = formatPbmHeader(header, sizeof(header), width, height, ascii);
+    w.put(reinterpret_cast<const uint8_t *>(header), (size_t)n);
+
+    // PBM uses 1 = black; lit OLED pixels are rendered as white.
+    for (uint16_t y = 0; y < height; ++y)
+    {
+        if (ascii)
+        {
+            for (uint16_t x = 0; x < width; ++x)
+                w.put8(pixelAt(fb, width, x, y) ? '0' : '1');
+            w.put8('\n');
+        }
+        else
+        {
+            packRow(fb, width, y, row);
+            for (size_t i = 0; i < rowBytes; ++i)
+                row[i] = ~row[i];
+            // Clear padding bits past the last column
+            if (width & 7)
+                row[rowBytes - 1] &= static_cast<uint8_t>(0xFF << (8 - (width & 7)));
+            w.put(row, rowBytes);
+        }
+    }
+
+    w.flush();
+    return w.ok();
+}
@@ -0,0 +1,47 @@
+#pragma once
+/**
+ * @file displaySnapshot.h
+ * @brief Streaming image encoders for the monochrome display framebuffer.
+ *
+ * Encodes a page-major 1bpp framebuffer (see Display::framebuffer()) to PNG or
+ * PBM directly into a Print sink, one row at a time. No full image copy is
+ * made; peak extra memory is one output row plus a small write buffer.
+ *
+ * Usage:
+ *   const Display &d = Display::instance();
+ *   DisplaySnapshot::writePng(client, d.framebuffer(), d.width(), d.height());
+ *
+ * Lit pixels are encoded as white, unlit as black.
+ */
+
+#include <Arduino.h>
+
+namespace DisplaySnapshot
+{
+    /**
+     * @brief Exact size in bytes of the PNG produced by writePng() for the given geometry.
+     *
+     * The encoder uses stored (uncompressed) deflate blocks, so the size only depends
+     * on the geometry. Use this for the HTTP Content-Length.
+     */
+    size_t pngSize(uint16_t width, uint16_t height);
+
+    /**
+     * @brief Encode the framebuffer as a 1-bit grayscale PNG.
+     * @return true if all bytes were accepted by the sink.
+     */
+    bool writePng(Print &out, const uint8_t *fb, uint16_t width, uint16_t height);
+
+    /**
+     * @brief Exact size in bytes of the PBM produced by writePbm().
+     */
+    size_t pbmSize(uint16_t width, uint16_t height, bool ascii);
+
+    /**
+     * @brief Encode the framebuffer as PBM.
+     * @param ascii true for plain PBM (P1, readable on a serial terminal),
+     *              false for raw PBM (P4).
+     * @return true if all bytes were accepted by the sink.
+     */
+    bool writePbm(Print &out, const uint8_t *fb, uint16_t width, uint16_t height, bool ascii);
+}
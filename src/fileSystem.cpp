@@ -1,4 +1,5 @@
 #include "fileSystem.h"
+#include "trace.h"
 
 #include <LittleFS.h>
 #include <FS.h>
@@ -152,6 +153,7 @@ bool FileSystem::write(const String &path, const String &content)
  */
 bool FileSystem::write(const String &path, const uint8_t *data, size_t len)
 {
+    TRACE_SCOPE("fs.write");
     if (!mounted && !mount())
         return false;
 
@@ -192,6 +194,7 @@ bool FileSystem::write(const String &path, const std::vector<uint8_t> &data)
  */
 String FileSystem::read(const String &path)
 {
+    TRACE_SCOPE("fs.read");
     if (!mounted && !mount())
         return String();
 
@@ -0,0 +1,148 @@
+/**
+ * @file heapMonitor.cpp
+ * @brief Internal heap fragmentation sampling, trend and alerts.
+ */
+
+#include "heapMonitor.h"
+
+#include "esp_heap_caps.h"
+#include "Logger.h"
+#include "system.h"
+
+constexpr uint32_t HeapMonitor::SAMPLE_INTERVAL_MS;
+constexpr uint8_t HeapMonitor::HISTORY;
+constexpr uint8_t HeapMonitor::FRAG_WARN_PCT;
+constexpr uint32_t HeapMonitor::LARGEST_WARN_BYTES;
+constexpr int32_t HeapMonitor::TREND_WARN_BYTES_PER_H;
+
+namespace
+{
+    constexpr uint32_t HEAP_CAPS = MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT;
+
+    uint8_t fragmentation(uint32_t freeBytes, uint32_t largest)
+    {
+        if (freeBytes == 0)
+            return 0;
+        return (uint8_t)(100 - (uint64_t)largest * 100 / freeBytes);
+    }
+}
+
+HeapMonitor &HeapMonitor::instance()
+{
+    static HeapMonitor inst;
+    return inst;
+}
+
+HeapMonitor::HeapMonitor()
+    : history_(), head_(0), count_(0), peakFragPct_(0),
+      fragAlert_(false), largestAlert_(false), trendAlert_(false),
+      timer_(0)
+{
+}
+
+void HeapMonitor::begin()
+{
+    if (timer_)
+        return;
+    sample();
+    timer_ = System::instance().timers().schedulePeriodic(SAMPLE_INTERVAL_MS, [this]
+                                                          { sample(); });
+}
+
+void HeapMonitor::sample()
+{
+    Sample s;
+    s.atMs = (uint32_t)System::instance().monotonicMs();
+    s.freeBytes = (uint32_t)heap_caps_get_free_size(HEAP_CAPS);
+    s.largestBlock = (uint32_t)heap_caps_get_largest_free_block(HEAP_CAPS);
+
+    history_[head_] = s;
+    head_ = (head_ + 1) % HISTORY;
+    if (count_ < HISTORY)
+        count_++;
+
+    const uint8_t frag = fragmentation(s.freeBytes, s.largestBlock);
+    if (frag > peakFragPct_)
+        peakFragPct_ = frag;
+    checkAlerts(s, frag);
+}
+
+int32_t HeapMonitor::trendPerHour() const
+{
+    if (count_ < 2)
+        return 0;
+
+    // Least-squares slope of largest block over time, relative to the oldest sample
+    const uint8_t oldest = (head_ + HISTORY - count_) % HISTORY;
+    const uint32_t t0 = history_[oldest].atMs;
+    double sumT = 0, sumY = 0, sumTT = 0, sumTY = 0;
+    for (uint8_t i = 0; i < count_; ++i)
+    {
+        const Sample &s = history_[(oldest + i) % HISTORY];
+        const double t = (double)(s.atMs - t0) / 3600000.0;
+        const double y = (double)s.largestBlock;
+        sumT += t;
+        sumY += y;
+        sumTT += t * t;
+        sumTY += t * y;
+    }
+    const double n = count_;
+    const double denom = n * sumTT - sumT * sumT;
+    if (denom <= 0)
+        return 0;
+    return (int32_t)((n * sumTY - sumT * sumY) / denom);
+}
+
+void HeapMonitor::checkAlerts(const Sample &s, uint8_t fragPct)
+{
+    Logger &log = Logger::instance();
+
+    const bool frag = fragPct >= FRAG_WARN_PCT;
+    if (frag != fragAlert_)
+    {
+        fragAlert_ = frag;
+        if (frag)
+            log.warn(String("HeapMonitor: fragmentation ") + String(fragPct) + "% (free " + String(s.freeBytes) +
+                     ", largest block " + String(s.largestBlock) + ")");
+        else
+            log.info(String("HeapMonitor: fragmentation back to ") + String(fragPct) + "%");
+    }
+
+    const bool largest = s.largestBlock < LARGEST_WARN_BYTES;
+    if (largest != largestAlert_)
+    {
+        largestAlert_ = largest;
+        if (largest)
+            log.warn(String("HeapMonitor: largest free block down to ") + String(s.largestBlock) + " bytes");
+        else
+            log.info(String("HeapMonitor: largest free block back to ") + String(s.largestBlock) + " bytes");
+    }
+
+    // Only judge the trend over a full window; a few samples after boot are noise
+    const int32_t trend = count_ >= HISTORY ? trendPerHour() : 0;
+    const bool shrinking = trend < -TREND_WARN_BYTES_PER_H;
+    if (shrinking != trendAlert_)
+    {
+        trendAlert_ = shrinking;
+        if (shrinking)
+            log.warn(String("HeapMonitor: largest free block shrinking by ") + String(-trend) + " bytes/h");
+    }
+}
+
+HeapMonitor::Status HeapMonitor::status() const
+{
+    Status st = {};
+    st.minFreeBytes = (uint32_t)heap_caps_get_minimum_free_size(HEAP_CAPS);
+    st.peakFragmentationPct = peakFragPct_;
+    st.largestTrendPerHour = trendPerHour();
+    st.samples = count_;
+    st.alert = fragAlert_ || largestAlert_ || trendAlert_;
+    if (count_ > 0)
+    {
+        const Sample &last = history_[(head_ + HISTORY - 1) % HISTORY];
+        st.freeBytes = last.freeBytes;
+        st.largestBlock = last.largestBlock;
+        st.fragmentationPct = fragmentation(last.freeBytes, last.largestBlock);
+    }
+    return st;
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <Arduino.h>
+#include "timerWheel.h"
+
+/**
+ * @file heapMonitor.h
+ * @brief Singleton that samples internal heap fragmentation and warns about bad trends.
+ *
+ * Every SAMPLE_INTERVAL_MS (on System::timers()) it records the free internal heap and
+ * the largest free block. Fragmentation is 100 - largest * 100 / free: 0 % means all
+ * free memory is one block, values near 100 % mean plenty is free but nothing large
+ * fits. The last HISTORY samples give a least-squares trend of the largest block in
+ * bytes per hour.
+ *
+ * A warning is logged (once, until the condition clears) when fragmentation reaches
+ * FRAG_WARN_PCT, the largest block drops below LARGEST_WARN_BYTES, or, with a full
+ * history, the largest block shrinks faster than TREND_WARN_BYTES_PER_H.
+ *
+ * Service task only.
+ */
+class HeapMonitor
+{
+public:
+    static constexpr uint32_t SAMPLE_INTERVAL_MS = 60000;
+    static constexpr uint8_t HISTORY = 60; // one hour at the default interval
+    static constexpr uint8_t FRAG_WARN_PCT = 60;
+    static constexpr uint32_t LARGEST_WARN_BYTES = 16384;
+    static constexpr int32_t TREND_WARN_BYTES_PER_H = 2048;
+
+    struct Status
+    {
+        uint32_t freeBytes;
+        uint32_t largestBlock;
+        uint32_t minFreeBytes; // low-water mark since boot
+        uint8_t fragmentationPct;
+        uint8_t peakFragmentationPct;
+        int32_t largestTrendPerHour; // 0 until two samples exist
+        uint8_t samples;
+        bool alert;
+    };
+
+    static HeapMonitor &instance();
+
+    // Take a first sample and start periodic sampling
+    void begin();
+    // Take a sample now (also called by the periodic timer)
+    void sample();
+
+    Status status() const;
+
+private:
+    HeapMonitor();
+    ~HeapMonitor() = default;
+    HeapMonitor(const HeapMonitor &) = delete;
+    HeapMonitor &operator=(const HeapMonitor &) = delete;
+
+    struct Sample
+    {
+        uint32_t atMs;
+        uint32_t freeBytes;
+        uint32_t largestBlock;
+    };
+
+    int32_t trendPerHour() const;
+    void checkAlerts(const Sample &s, uint8_t fragPct);
+
+    Sample history_[HISTORY];
+    uint8_t head_;  // next write position
+    uint8_t count_; // valid samples
+    uint8_t peakFragPct_;
+    bool fragAlert_;
+    bool largestAlert_;
+    bool trendAlert_;
+    TimerWheel::TimerId timer_;
+};
@@ -0,0 +1,193 @@
+/**
+ * @file linkMonitor.cpp
+ * @brief RSSI/disconnect history and adaptive WiFi power-save policy.
+ */
+
+#include "linkMonitor.h"
+
+#include <WiFi.h>
+#include "Logger.h"
+#include "ws.h"
+#include "system.h"
+#include "trace.h"
+
+constexpr size_t LinkMonitor::RSSI_HISTORY;
+constexpr size_t LinkMonitor::DISCONNECT_HISTORY;
+constexpr uint32_t LinkMonitor::SAMPLE_INTERVAL_MS;
+constexpr uint32_t LinkMonitor::ACTIVE_HOLD_MS;
+
+LinkMonitor &LinkMonitor::instance()
+{
+    static LinkMonitor inst;
+    return inst;
+}
+
+LinkMonitor::LinkMonitor()
+    : samples_(), sampleHead_(0), sampleCount_(0), lastSampleMs_(0),
+      disconnects_(), disconnectHead_(0), disconnectCount_(0),
+      policy_(PowerPolicy::Auto), appliedPs_(WIFI_PS_MIN_MODEM), psKnown_(false),
+      psSinceMs_(0), psSwitches_(0), msAwake_(0), msModemSleep_(0)
+{
+}
+
+void LinkMonitor::loop()
+{
+    TRACE_SCOPE("link");
+    const uint64_t now = System::instance().monotonicMs();
+    const bool staUp = (WiFi.getMode() & WIFI_MODE_STA) && WiFi.status() == WL_CONNECTED;
+
+    if (staUp && now - lastSampleMs_ >= SAMPLE_INTERVAL_MS)
+    {
+        lastSampleMs_ = now;
+        Sample &s = samples_[sampleHead_];
+        s.atMs = (uint32_t)now;
+        s.rssi = (int8_t)WiFi.RSSI();
+        s.channel = (uint8_t)WiFi.channel();
+        sampleHead_ = (sampleHead_ + 1) % RSSI_HISTORY;
+        if (sampleCount_ < RSSI_HISTORY)
+            sampleCount_++;
+    }
+
+    if (!staUp)
+        return;
+
+    wifi_ps_type_t wanted;
+    switch (policy_)
+    {
+    case PowerPolicy::AlwaysOn:
+        wanted = WIFI_PS_NONE;
+        break;
+    case PowerPolicy::AlwaysSave:
+        wanted = WIFI_PS_MIN_MODEM;
+        break;
+    default:
+    {
+        const uint64_t last = Ws::instance().lastActivityMs();
+        wanted = (last != 0 && now - last < ACTIVE_HOLD_MS) ? WIFI_PS_NONE : WIFI_PS_MIN_MODEM;
+        break;
+    }
+    }
+
+    if (!psKnown_ || wanted != appliedPs_)
+        applyPowerSave(wanted, now);
+}
+
+void LinkMonitor::applyPowerSave(wifi_ps_type_t ps, uint64_t now)
+{
+    esp_err_t err = esp_wifi_set_ps(ps);
+    if (err != ESP_OK)
+    {
+        Logger::instance().warn(String("LinkMonitor: esp_wifi_set_ps failed: ") + String((int)err));
+        return;
+    }
+
+    if (psKnown_)
+    {
+        if (appliedPs_ == WIFI_PS_NONE)
+            msAwake_ += (uint32_t)(now - psSinceMs_);
+        else
+            msModemSleep_ += (uint32_t)(now - psSinceMs_);
+        psSwitches_++;
+    }
+    appliedPs_ = ps;
+    psKnown_ = true;
+    psSinceMs_ = now;
+    Logger::instance().debug(String("LinkMonitor: power save -> ") + powerSaveToString(ps));
+}
+
+void LinkMonitor::recordDisconnect(uint8_t reason)
+{
+    DisconnectRecord &r = disconnects_[disconnectHead_];
+    r.atMs = (uint32_t)System::instance().monotonicMs();
+    r.reason = reason;
+    disconnectHead_ = (disconnectHead_ + 1) % DISCONNECT_HISTORY;
+    if (disconnectCount_ < DISCONNECT_HISTORY)
+        disconnectCount_++;
+}
+
+size_t LinkMonitor::samples(Sample *out, size_t max) const
+{
+    size_t n = min(max, sampleCount_);
+    size_t start = (sampleHead_ + RSSI_HISTORY - sampleCount_) % RSSI_HISTORY;
+    // Skip the oldest ones if the caller wants fewer than we have
+    start = (start + sampleCount_ - n) % RSSI_HISTORY;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = samples_[(start + i) % RSSI_HISTORY];
+    return n;
+}
+
+size_t LinkMonitor::disconnects(DisconnectRecord *out, size_t max) const
+{
+    size_t n = min(max, disconnectCount_);
+    size_t start = (disconnectHead_ + DISCONNECT_HISTORY - n) % DISCONNECT_HISTORY;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = disconnects_[(start + i) % DISCONNECT_HISTORY];
+    return n;
+}
+
+LinkMonitor::RssiStats LinkMonitor::rssiStats() const
+{
+    RssiStats st;
+    if (sampleCount_ == 0)
+        return st;
+
+    int32_t sum = 0;
+    st.min = 127;
+    st.max = -128;
+    for (size_t i = 0; i < sampleCount_; ++i)
+    {
+        int8_t r = samples_[i].rssi;
+        sum += r;
+        if (r < st.min)
+            st.min = r;
+        if (r > st.max)
+            st.max = r;
+    }
+    st.count = (uint16_t)sampleCount_;
+    st.avg = (int8_t)(sum / (int32_t)sampleCount_);
+    return st;
+}
+
+void LinkMonitor::setPolicy(PowerPolicy policy)
+{
+    policy_ = policy;
+    Logger::instance().info(String("LinkMonitor: power policy ") + policyToString(policy));
+}
+
+uint32_t LinkMonitor::msAwake() const
+{
+    return msAwake_ + ((psKnown_ && appliedPs_ == WIFI_PS_NONE) ? (uint32_t)(System::instance().monotonicMs() - psSinceMs_) : 0);
+}
+
+uint32_t LinkMonitor::msModemSleep() const
+{
+    return msModemSleep_ + ((psKnown_ && appliedPs_ != WIFI_PS_NONE) ? (uint32_t)(System::instance().monotonicMs() - psSinceMs_) : 0);
+}
+
+const char *LinkMonitor::policyToString(PowerPolicy p)
+{
+    switch (p)
+    {
+    case PowerPolicy::AlwaysOn:
+        return "on";
+    case PowerPolicy::AlwaysSave:
+        return "save";
+    default:
+        return "auto";
+    }
+}
+
+const char *LinkMonitor::powerSaveToString(wifi_ps_type_t ps)
+{
+    switch (ps)
+    {
+    case WIFI_PS_NONE:
+        return "none";
+    case WIFI_PS_MIN_MODEM:
+        return "min-modem";
+    case WIFI_PS_MAX_MODEM:
+        return "max-modem";
+    default:
+        return "?";
+    }
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <Arduino.h>
+#include <esp_wifi.h>
+
+/**
+ * @file linkMonitor.h
+ * @brief Singleton that records station link quality and picks the radio power-save mode.
+ *
+ * Link history:
+ *  - RSSI/channel of the connected AP is sampled every SAMPLE_INTERVAL_MS into a ring
+ *    buffer (RSSI_HISTORY samples, oldest overwritten).
+ *  - Disconnect and failed-attempt reasons (wifi_err_reason_t, or NetworkController's
+ *    REASON_CONNECT_TIMEOUT / REASON_LOST_IP) are recorded by NetworkController into
+ *    a second ring.
+ *  - Per-frame TX retry counts are not exposed by the Arduino/IDF WiFi API, so they
+ *    are not part of the history.
+ *
+ * Power-save policy (Auto):
+ *  - WIFI_PS_NONE while an HTTP client was active within ACTIVE_HOLD_MS (lowest latency
+ *    for the dashboard and API polling),
+ *  - WIFI_PS_MIN_MODEM otherwise (modem sleeps between DTIM beacons, lower current).
+ * AlwaysOn / AlwaysSave pin the mode. The mode is applied only when the station is up
+ * and only on changes; time spent in each mode is accounted.
+ *
+ * Call loop() from the main loop.
+ */
+class LinkMonitor
+{
+public:
+    static LinkMonitor &instance();
+
+    enum class PowerPolicy : uint8_t
+    {
+        Auto,
+        AlwaysOn,
+        AlwaysSave
+    };
+
+    struct Sample
+    {
+        uint32_t atMs;
+        int8_t rssi;
+        uint8_t channel;
+    };
+
+    struct DisconnectRecord
+    {
+        uint32_t atMs;
+        uint8_t reason;
+    };
+
+    struct RssiStats
+    {
+        int8_t min = 0;
+        int8_t max = 0;
+        int8_t avg = 0;
+        uint16_t count = 0;
+    };
+
+    static constexpr size_t RSSI_HISTORY = 60;
+    static constexpr size_t DISCONNECT_HISTORY = 16;
+    static constexpr uint32_t SAMPLE_INTERVAL_MS = 5000;
+    static constexpr uint32_t ACTIVE_HOLD_MS = 30000;
+
+    void loop();
+
+    // Called by NetworkController for every link loss or failed attempt.
+    void recordDisconnect(uint8_t reason);
+
+    // Copy samples (oldest first) into out; returns the number copied.
+    size_t samples(Sample *out, size_t max) const;
+    size_t disconnects(DisconnectRecord *out, size_t max) const;
+    RssiStats rssiStats() const;
+
+    void setPolicy(PowerPolicy policy);
+    PowerPolicy policy() const { return policy_; }
+    wifi_ps_type_t powerSave() const { return appliedPs_; }
+    uint32_t powerSaveSwitches() const { return psSwitches_; }
+    // ms spent with the radio always on / in modem sleep since boot
+    uint32_t msAwake() const;
+    uint32_t msModemSleep() const;
+
+    static const char *policyToString(PowerPolicy p);
+    static const char *powerSaveToString(wifi_ps_type_t ps);
+
+private:
+    LinkMonitor();
+    ~LinkMonitor() = default;
+    LinkMonitor(const LinkMonitor &) = delete;
+    LinkMonitor &operator=(const LinkMonitor &) = delete;
+
+    void applyPowerSave(wifi_ps_type_t ps, uint64_t now);
+
+    Sample samples_[RSSI_HISTORY];
+    size_t sampleHead_;
+    size_t sampleCount_;
+    uint64_t lastSampleMs_;
+
+    DisconnectRecord disconnects_[DISCONNECT_HISTORY];
+    size_t disconnectHead_;
+    size_t disconnectCount_;
+
+    PowerPolicy policy_;
+    wifi_ps_type_t appliedPs_;
+    bool psKnown_;
+    uint64_t psSinceMs_;
+    uint32_t psSwitches_;
+    uint32_t msAwake_;
+    uint32_t msModemSleep_;
+};
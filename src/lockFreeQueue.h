@@ -0,0 +1,224 @@
+#pragma once
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <type_traits>
+
+/**
+ * @file lockFreeQueue.h
+ * @brief Fixed-capacity lock-free ring queues for passing messages between tasks.
+ *
+ *  - SpscQueue<T, N>: one producer task, one consumer task. Each side owns one index,
+ *    so push/pop are a load, a copy and a release store.
+ *  - MpscQueue<T, N>: any number of producer tasks (or cores), one consumer. Every slot
+ *    carries a sequence number (Vyukov's bounded queue): producers claim a slot with a
+ *    CAS on the tail and publish it by bumping the slot's sequence, so a producer that
+ *    is preempted mid-copy only delays the consumer at that slot, never corrupts it.
+ *  - Message<Kind, PayloadSize>: a typed envelope (kind, length, timestamp, inline
+ *    payload) for queues that carry several kinds of message.
+ *
+ * Neither queue allocates or blocks: push() fails when full and pop() fails when empty,
+ * so both are safe from any task at any priority. MpscQueue::push() never waits for
+ * another producer: its CAS loop only retries when a concurrent push claimed the same
+ * tail first, and a slot still held by a preempted producer from the previous lap makes
+ * it return false as if full (pop() likewise returns false until that slot is
+ * published). N must be a power of two; T must be trivially copyable, since slots are
+ * copied by value. Indices that are written by different sides sit on separate cache
+ * lines so the two cores do not fight over one line.
+ *
+ * This header does not depend on Arduino and builds on the host as well.
+ */
+
+#if defined(ESP_PLATFORM)
+constexpr size_t LOCKFREE_CACHE_LINE = 32; // ESP32-S3 data cache line
+#else
+constexpr size_t LOCKFREE_CACHE_LINE = 64;
+#endif
+
+template <typename T, size_t N>
+class SpscQueue
+{
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscQueue capacity must be a power of two");
+    static_assert(std::is_trivially_copyable<T>::value, "SpscQueue elements must be trivially copyable");
+
+public:
+    SpscQueue() : head_(0), tail_(0) {}
+
+    SpscQueue(const SpscQueue &) = delete;
+    SpscQueue &operator=(const SpscQueue &) = delete;
+
+    static constexpr size_t capacity() { return N; }
+
+    // Producer side. Returns false when full.
+    bool push(const T &item)
+    {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_.load(std::memory_order_acquire) >= N)
+            return false;
+        slots_[tail & (N - 1)] = item;
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side. Returns false when empty.
+    bool pop(T &out)
+    {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire))
+            return false;
+        out = slots_[head & (N - 1)];
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Approximate from either side; exact from the consumer when nothing is pushed concurrently
+    size_t size() const
+    {
+        return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+    }
+    bool empty() const { return size() == 0; }
+
+private:
+    alignas(LOCKFREE_CACHE_LINE) std::atomic<size_t> head_; // consumer
+    alignas(LOCKFREE_CACHE_LINE) std::atomic<size_t> tail_; // producer
+    alignas(LOCKFREE_CACHE_LINE) T slots_[N];
+};
+
+template <typename T, size_t N>
+class MpscQueue
+{
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "MpscQueue capacity must be a power of two");
+    static_assert(std::is_trivially_copyable<T>::value, "MpscQueue elements must be trivially copyable");
+
+public:
+    MpscQueue() : head_(0), tail_(0)
+    {
+        for (size_t i = 0; i < N; ++i)
+            slots_[i].seq.store(i, std::memory_order_relaxed);
+    }
+
+    MpscQueue(const MpscQueue &) = delete;
+    MpscQueue &operator=(const MpscQueue &) = delete;
+
+    static constexpr size_t capacity() { return N; }
+
+    // Any task. Returns false when full.
+    bool push(const T &item)
+    {
+        size_t pos = tail_.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            Slot &slot = slots_[pos & (N - 1)];
+            const size_t seq = slot.seq.load(std::memory_order_acquire);
+            const intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+            if (diff == 0)
+            {
+                // Slot is free for this lap: claim it
+                if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    slot.value = item;
+                    slot.seq.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+                // pos was reloaded by the failed CAS
+            }
+            else if (diff < 0)
+            {
+                return false; // the consumer has not freed this slot yet: full
+            }
+            else
+            {
+                pos = tail_.load(std::memory_order_relaxed); // another producer got there first
+            }
+        }
+    }
+
+    // Consumer task only. Returns false when empty (or the next slot is still being written).
+    bool pop(T &out)
+    {
+        const size_t pos = head_.load(std::memory_order_relaxed);
+        Slot &slot = slots_[pos & (N - 1)];
+        if (slot.seq.load(std::memory_order_acquire) != pos + 1)
+            return false;
+        out = slot.value;
+        slot.seq.store(pos + N, std::memory_order_release);
+        head_.store(pos + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Approximate; includes slots that are claimed but not yet published
+    size_t size() const
+    {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        const size_t head = head_.load(std::memory_order_relaxed);
+        return tail - head > N ? N : tail - head;
+    }
+    bool empty() const { return size() == 0; }
+
+private:
+    struct Slot
+    {
+        std::atomic<size_t> seq;
+        T value;
+    };
+
+    alignas(LOCKFREE_CACHE_LINE) std::atomic<size_t> head_; // consumer
+    alignas(LOCKFREE_CACHE_LINE) std::atomic<size_t> tail_; // producers
+    alignas(LOCKFREE_CACHE_LINE) Slot slots_[N];
+};
+
+/**
+ * Typed envelope: `kind` says how to read the payload, `length` how much of it is used.
+ * put()/get() copy a trivially copyable struct in and out; putText()/text() carry a
+ * NUL-terminated string (truncated to fit).
+ */
+template <typename Kind, size_t PayloadSize>
+struct Message
+{
+    static_assert(PayloadSize > 0 && PayloadSize <= UINT16_MAX, "Message payload size out of range");
+
+    Kind kind;
+    uint16_t length;
+    uint32_t timestampMs; // low 32 bits of the sender's monotonic clock
+    uint8_t payload[PayloadSize];
+
+    static constexpr size_t payloadSize() { return PayloadSize; }
+
+    template <typename T>
+    bool put(Kind k, const T &value)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "Message payloads must be trivially copyable");
+        static_assert(sizeof(T) <= PayloadSize, "Message payload too large");
+        kind = k;
+        length = (uint16_t)sizeof(T);
+        memcpy(payload, &value, sizeof(T));
+        return true;
+    }
+
+    template <typename T>
+    bool get(T &value) const
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "Message payloads must be trivially copyable");
+        if (length != sizeof(T))
+            return false;
+        memcpy(&value, payload, sizeof(T));
+        return true;
+    }
+
+    // Returns false if the text had to be truncated
+    bool putText(Kind k, const char *text)
+    {
+        kind = k;
+        const size_t n = text ? strlen(text) : 0;
+        const size_t copied = n < PayloadSize ? n : PayloadSize - 1;
+        if (copied)
+            memcpy(payload, text, copied);
+        payload[copied] = '\0';
+        length = (uint16_t)(copied + 1);
+        return copied == n;
+    }
+
+    const char *text() const { return reinterpret_cast<const char *>(payload); }
+};
@@ -2,7 +2,9 @@
  * @file main.cpp
  * @brief Main entry point for the Diesel Heater Controller ESP32 application.
  *
- * Initializes system components, handles provisioning, and runs the main loop for console and LED control.
+ * Initializes system components and handles provisioning in setup(), then splits the work
+ * across pinned tasks (see taskLayout.h): the control loop on core 1, networking, web,
+ * console and timers in the service task on core 0, and the display in loop().
  */
 
 #include <Arduino.h>
@@ -10,22 +12,166 @@
 #include <ArduinoOTA.h>
 
 #include "Logger.h"
-#include "OnBoardLed.h"
-#include "System.h"
+#include "onBoardLed.h"
+#include "system.h"
 #include "config.h"
 #include "console.h"
 #include "fileSystem.h"
 #include "networkController.h"
+#include "linkMonitor.h"
+#include "timeSync.h"
+#include "powerManager.h"
+#include "crashLog.h"
+#include "supervisor.h"
+#include "heapMonitor.h"
+#include "bufferAllocator.h"
+#include "trace.h"
+#include "controlLoop.h"
+#include "taskLayout.h"
 #include "otaManager.h"
 #include "provisioning.h"
+#include "provisioningBundle.h"
 #include "ws.h"
+#include "webApi.h"
 #include "displayManager.h"
 
+namespace
+{
+  // Heartbeats for the modules driven by the service task and loop(); beaten right after each returns
+  constexpr uint32_t LOOP_DEADLINE_MS = 5000;
+  Supervisor::ModuleId hbTimers, hbDisplay, hbProvisioning, hbNetwork, hbTime, hbConsole, hbWeb, hbOta;
+
+  void registerHeartbeats()
+  {
+    Supervisor &sup = Supervisor::instance();
+    hbTimers = sup.registerModule("timers", LOOP_DEADLINE_MS);
+    hbDisplay = sup.registerModule("display", LOOP_DEADLINE_MS);
+    hbProvisioning = sup.registerModule("provisioning", LOOP_DEADLINE_MS);
+    hbNetwork = sup.registerModule("network", LOOP_DEADLINE_MS);
+    hbTime = sup.registerModule("time", LOOP_DEADLINE_MS);
+    hbConsole = sup.registerModule("console", LOOP_DEADLINE_MS);
+    hbWeb = sup.registerModule("web", LOOP_DEADLINE_MS);
+    hbOta = sup.registerModule("ota", LOOP_DEADLINE_MS);
+  }
+
+  // Everything that used to run in loop() except the display; pinned away from the control core
+  void serviceTask(void * /*arg*/)
+  {
+    Supervisor &sup = Supervisor::instance();
+    // Serial output is printed from here from now on; other tasks queue their lines
+    Logger::instance().attachWriter();
+    for (;;)
+    {
+      // Sleep until the next timer is due; PowerManager bounds the wait (and may light-sleep)
+      PowerManager::instance().idle(System::instance().msUntilNextTimer());
+      System::instance().runTimers();
+      sup.heartbeat(hbTimers);
+
+      Provisioning::instance().checkFactoryResetButton();
+      Provisioning::instance().provisioningLoop();
+      sup.heartbeat(hbProvisioning);
+      NetworkController::instance().loop();
+      LinkMonitor::instance().loop();
+      sup.heartbeat(hbNetwork);
+      TimeSync::instance().loop();
+      sup.heartbeat(hbTime);
+      ArduinoOTA.handle();
+      Console::instance().consoleLoop();
+      Config::instance().poll();
+      sup.heartbeat(hbConsole);
+      Ws::instance().wsLoop();
+      sup.heartbeat(hbWeb);
+      OtaManager::instance().loop();
+      sup.heartbeat(hbOta);
+      Logger::instance().flush();
+    }
+  }
+
+  void startTasks()
+  {
+    // Heater control registers its steps before this point
+    ControlLoop::instance().start();
+
+    if (xTaskCreatePinnedToCore(serviceTask, "service", TaskLayout::SERVICE_STACK, nullptr,
+                                TaskLayout::SERVICE_PRIORITY, nullptr, TaskLayout::SERVICE_CORE) != pdPASS)
+    {
+      // Without it nothing beats the service heartbeats, so the watchdog resets the unit
+      Logger::instance().error("Failed to start service task");
+    }
+  }
+
+  // LED and display for the station state (normal operation)
+  void showWifiState(NetworkController::WifiState state)
+  {
+    switch (state)
+    {
+    case NetworkController::WifiState::Connected:
+      OnBoardLed::instance().startBlink("#00FF00", 5, 1000, 2000);
+      DisplayManager::instance().showStatus("WiFi Connected", "Normal mode");
+      break;
+    case NetworkController::WifiState::Backoff:
+      OnBoardLed::instance().startBlink("#FF0000", 75, 500, 500);
+      DisplayManager::instance().showStatus("WiFi failed", "Retrying...");
+      break;
+    case NetworkController::WifiState::Scanning:
+    case NetworkController::WifiState::Connecting:
+      OnBoardLed::instance().startBlink("#0000FF", 5, 250, 750);
+      DisplayManager::instance().showStatus("WiFi", "Connecting...");
+      break;
+    default:
+      break;
+    }
+  }
+
+  /**
+   * Web API, network ambient screen and the background station. Runs from setup() on a
+   * provisioned device, or from the service task right after first-boot provisioning
+   * handed over (the station is then already connected and is kept as is).
+   */
+  void startNormalOperation()
+  {
+    // Web server for the /api endpoints (display snapshot etc.)
+    Ws::instance().begin(80);
+    WebApi::instance().registerRoutes();
+
+    DisplayManager::instance().addAmbient("network", [](DisplayManager::ScreenText &t)
+                                          {
+                                            t.set(0, "Network");
+                                            t.set(1, WiFi.SSID());
+                                            t.set(2, NetworkController::instance().ipAddress().toString());
+                                            t.set(3, String("RSSI ") + String(WiFi.RSSI()) + " dBm"); });
+
+    // Connection runs in the background; reflect its state on LED and display.
+    NetworkController &nc = NetworkController::instance();
+    nc.onStateChange(showWifiState);
+
+    if (nc.isConnected())
+    {
+      showWifiState(nc.state());
+    }
+    else if (!nc.startStation())
+    {
+      Logger::instance().warn("No WiFi network configured, entering error state");
+      OnBoardLed::instance().startBlink("#FF0000", 75, 500, 500);
+      DisplayManager::instance().showStatus("WiFi failed", "Check network");
+    }
+  }
+}
+
 void setup()
 {
+  // Capture the previous run's crash context before anything logs over it.
+  CrashLog::instance().begin();
+
   // Initialize logger and system clock early so other components can use timestamps/uptime.
   System::instance().init();
   Logger::instance().init(115200);
+  BufferAllocator::instance().begin();
+  if (Trace::compiledIn())
+    Trace::instance().begin();
+  TimeSync::instance().begin();
+  PowerManager::instance().begin();
+  HeapMonitor::instance().begin();
   OtaManager::instance().begin(true);
 
   // Initialize display (I2C pins moved to config.h)
@@ -46,6 +192,12 @@ void setup()
     Logger::instance().error("Filesystem mount failed");
     DisplayManager::instance().showError("FS mount failed");
   }
+  else
+  {
+    CrashLog::instance().persist();
+    // A signed bundle dropped on the file system provisions the unit before the portal is considered
+    ProvisioningBundle::instance().applyDroppedFile();
+  }
 
   if (initSuccess && !Provisioning::instance().isProvisioned())
   {
@@ -56,6 +208,8 @@ void setup()
     {
       // Provisioning::start() will update the display with the AP SSID and URL.
       OnBoardLed::instance().startBlink("#FFFF00", 5, 250, 250);
+      // Once credentials work the portal closes and normal operation starts without a reboot
+      Provisioning::instance().onProvisioned(startNormalOperation);
     }
     else
     {
@@ -67,21 +221,7 @@ void setup()
   else if (initSuccess)
   {
     Logger::instance().info("Device provisioned, starting normal operation");
-
-    if (NetworkController::instance().connectToWiFi())
-    {
-      Logger::instance().info("Connected to WiFi network");
-      ArduinoOTA.begin();
-      OnBoardLed::instance().startBlink("#00FF00", 5, 1000, 2000);
-
-      DisplayManager::instance().showStatus("WiFi Connected", "Normal mode");
-    }
-    else
-    {
-      Logger::instance().warn("Failed to connect to WiFi network, entering error state");
-      OnBoardLed::instance().startBlink("#FF0000", 75, 500, 500);
-      DisplayManager::instance().showStatus("WiFi failed", "Check network");
-    }
+    startNormalOperation();
   }
   else
   {
@@ -89,21 +229,20 @@ void setup()
     OnBoardLed::instance().startBlink("#FF0000", 75, 500, 500);
     DisplayManager::instance().showError("Init failed");
   }
+
+  // Watchdog last, so slow setup steps are not counted against the loop deadlines
+  registerHeartbeats();
+  Supervisor::instance().begin();
+
+  // From here on setup() no longer owns everything: see taskLayout.h
+  startTasks();
 }
 
 void loop()
 {
-  delay(10);
-
-  // Drive the non-blocking splash screen state if active
+  // loopTask (core 1, below the control task) only renders; other tasks reach the
+  // display through DisplayManager's command queue
   DisplayManager::instance().run();
-
-  Provisioning::instance().checkFactoryResetButton();
-  Provisioning::instance().provisioningLoop();
-  ArduinoOTA.handle();
-  OnBoardLed::instance().blinkLoop();
-  Console::instance().consoleLoop();
-  Config::instance().poll();
-  Ws::instance().wsLoop();
-  OtaManager::instance().loop();
+  Supervisor::instance().heartbeat(hbDisplay);
+  vTaskDelay(pdMS_TO_TICKS(TaskLayout::DISPLAY_PERIOD_MS));
 }
@@ -0,0 +1,86 @@
+/**
+ * @file memoryAccounting.cpp
+ * @brief Per-module allocation accounting.
+ */
+
+#include "memoryAccounting.h"
+
+#include <string.h>
+
+constexpr MemoryAccounting::ModuleId MemoryAccounting::INVALID_MODULE;
+constexpr uint8_t MemoryAccounting::MAX_MODULES;
+
+MemoryAccounting &MemoryAccounting::instance()
+{
+    static MemoryAccounting inst;
+    return inst;
+}
+
+MemoryAccounting::MemoryAccounting()
+    : modules_(), count_(0)
+{
+}
+
+MemoryAccounting::ModuleId MemoryAccounting::registerModule(const char *name)
+{
+    std::lock_guard<std::mutex> lock(registryMutex_);
+    const uint8_t n = count_.load(std::memory_order_relaxed);
+    for (uint8_t i = 0; i < n; ++i)
+    {
+        if (strcmp(modules_[i].name, name) == 0)
+            return i;
+    }
+    if (n >= MAX_MODULES)
+        return INVALID_MODULE;
+    modules_[n].name = name;
+    count_.store(n + 1, std::memory_order_release);
+    return n;
+}
+
+void MemoryAccounting::add(ModuleId id, size_t bytes, bool psram)
+{
+    if (id >= count_.load(std::memory_order_acquire))
+        return;
+    Module &m = modules_[id];
+    std::atomic<uint32_t> &cur = psram ? m.psramBytes : m.bytes;
+    std::atomic<uint32_t> &peakOf = psram ? m.psramPeakBytes : m.peakBytes;
+    const uint32_t now = cur.fetch_add((uint32_t)bytes, std::memory_order_relaxed) + (uint32_t)bytes;
+    m.allocs.fetch_add(1, std::memory_order_relaxed);
+    uint32_t peak = peakOf.load(std::memory_order_relaxed);
+    while (now > peak && !peakOf.compare_exchange_weak(peak, now, std::memory_order_relaxed))
+    {
+    }
+}
+
+void MemoryAccounting::remove(ModuleId id, size_t bytes, bool psram)
+{
+    if (id >= count_.load(std::memory_order_acquire))
+        return;
+    Module &m = modules_[id];
+    (psram ? m.psramBytes : m.bytes).fetch_sub((uint32_t)bytes, std::memory_order_relaxed);
+}
+
+void MemoryAccounting::failed(ModuleId id)
+{
+    if (id >= count_.load(std::memory_order_acquire))
+        return;
+    modules_[id].failures.fetch_add(1, std::memory_order_relaxed);
+}
+
+size_t MemoryAccounting::stats(ModuleStats *out, size_t max) const
+{
+    const uint8_t n = count_.load(std::memory_order_acquire);
+    size_t i = 0;
+    for (; i < n && i < max; ++i)
+    {
+        const Module &m = modules_[i];
+        out[i].name = m.name;
+        out[i].bytes = m.bytes.load(std::memory_order_relaxed);
+        out[i].peakBytes = m.peakBytes.load(std::memory_order_relaxed);
+        out[i].psramBytes = m.psramBytes.load(std::memory_order_relaxed);
+        out[i].psramPeakBytes = m.psramPeakBytes.load(std::memory_order_relaxed);
+        out[i].allocs = m.allocs.load(std::memory_order_relaxed);
+        out[i].failures = m.failures.load(std::memory_order_relaxed);
+    }
+    return i;
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @file memoryAccounting.h
+ * @brief Per-module accounting of the bytes held through FixedBlockPool and BufferAllocator.
+ *
+ * Modules register a name once and are charged for every block they hold, internal
+ * SRAM and PSRAM separately, so the console's "heap" command can show who holds what.
+ * add()/remove()/failed() are lock-free and safe from any task; registerModule() takes
+ * a mutex and is meant for start-up or a function-local static.
+ *
+ * This header does not depend on Arduino or FreeRTOS and builds on the host as well.
+ */
+class MemoryAccounting
+{
+public:
+    using ModuleId = uint8_t;
+    static constexpr ModuleId INVALID_MODULE = 0xFF;
+    static constexpr uint8_t MAX_MODULES = 16;
+
+    struct ModuleStats
+    {
+        const char *name;
+        uint32_t bytes; // currently held, internal SRAM
+        uint32_t peakBytes;
+        uint32_t psramBytes; // currently held, PSRAM
+        uint32_t psramPeakBytes;
+        uint32_t allocs; // since boot
+        uint32_t failures;
+    };
+
+    static MemoryAccounting &instance();
+
+    // Returns the existing id when `name` is already registered; INVALID_MODULE if full
+    ModuleId registerModule(const char *name);
+
+    void add(ModuleId id, size_t bytes, bool psram = false);
+    void remove(ModuleId id, size_t bytes, bool psram = false);
+    void failed(ModuleId id);
+
+    size_t stats(ModuleStats *out, size_t max) const;
+
+private:
+    MemoryAccounting();
+    ~MemoryAccounting() = default;
+    MemoryAccounting(const MemoryAccounting &) = delete;
+    MemoryAccounting &operator=(const MemoryAccounting &) = delete;
+
+    struct Module
+    {
+        const char *name = nullptr;
+        std::atomic<uint32_t> bytes{0};
+        std::atomic<uint32_t> peakBytes{0};
+        std::atomic<uint32_t> psramBytes{0};
+        std::atomic<uint32_t> psramPeakBytes{0};
+        std::atomic<uint32_t> allocs{0};
+        std::atomic<uint32_t> failures{0};
+    };
+
+    Module modules_[MAX_MODULES];
+    std::atomic<uint8_t> count_;
+    std::mutex registryMutex_;
+};
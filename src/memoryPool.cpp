@@ -0,0 +1,177 @@
+/**
+ * @file memoryPool.cpp
+ * @brief Fixed-block pools and the pooled JSON allocator.
+ */
+
+#include "memoryPool.h"
+
+#include <stdlib.h>
+#include "Logger.h"
+#include "bufferAllocator.h"
+
+constexpr size_t PooledJsonAllocator::JSON_BLOCK_SIZE;
+constexpr size_t PooledJsonAllocator::JSON_BLOCKS;
+
+FixedBlockPool *FixedBlockPool::head_ = nullptr;
+
+namespace
+{
+    portMUX_TYPE registryMux = portMUX_INITIALIZER_UNLOCKED;
+
+    constexpr size_t BLOCK_ALIGN = 8;
+}
+
+// ---- FixedBlockPool ----
+
+FixedBlockPool::FixedBlockPool(const char *name, size_t blockSize, size_t blockCount, MemoryAccounting::ModuleId owner)
+    : name_(name),
+      blockSize_((max(blockSize, sizeof(void *)) + BLOCK_ALIGN - 1) & ~(BLOCK_ALIGN - 1)),
+      blockCount_(blockCount), owner_(owner), arena_(nullptr), freeList_(nullptr),
+      inUse_(0), peakInUse_(0), failures_(0), mux_(portMUX_INITIALIZER_UNLOCKED), next_(nullptr)
+{
+    arena_ = static_cast<uint8_t *>(malloc(blockSize_ * blockCount_));
+    if (!arena_)
+    {
+        blockCount_ = 0;
+        Logger::instance().error(String("MemoryPool: no memory for pool '") + name_ + "'");
+    }
+
+    // Thread every block onto the free list, lowest address first
+    for (size_t i = blockCount_; i-- > 0;)
+    {
+        void *block = arena_ + i * blockSize_;
+        *static_cast<void **>(block) = freeList_;
+        freeList_ = block;
+    }
+
+    portENTER_CRITICAL(&registryMux);
+    next_ = head_;
+    head_ = this;
+    portEXIT_CRITICAL(&registryMux);
+}
+
+FixedBlockPool::~FixedBlockPool()
+{
+    portENTER_CRITICAL(&registryMux);
+    for (FixedBlockPool **p = &head_; *p; p = &(*p)->next_)
+    {
+        if (*p == this)
+        {
+            *p = next_;
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&registryMux);
+    free(arena_);
+}
+
+void *FixedBlockPool::allocate(MemoryAccounting::ModuleId who)
+{
+    if (who == MemoryAccounting::INVALID_MODULE)
+        who = owner_;
+
+    portENTER_CRITICAL(&mux_);
+    void *block = freeList_;
+    if (block)
+    {
+        freeList_ = *static_cast<void **>(block);
+        if (++inUse_ > peakInUse_)
+            peakInUse_ = inUse_;
+    }
+    else
+    {
+        failures_++;
+    }
+    portEXIT_CRITICAL(&mux_);
+
+    if (block)
+        MemoryAccounting::instance().add(who, blockSize_);
+    return block;
+}
+
+void FixedBlockPool::release(void *block, MemoryAccounting::ModuleId who)
+{
+    if (!block)
+        return;
+    if (who == MemoryAccounting::INVALID_MODULE)
+        who = owner_;
+
+    portENTER_CRITICAL(&mux_);
+    *static_cast<void **>(block) = freeList_;
+    freeList_ = block;
+    inUse_--;
+    portEXIT_CRITICAL(&mux_);
+
+    MemoryAccounting::instance().remove(who, blockSize_);
+}
+
+bool FixedBlockPool::owns(const void *p) const
+{
+    const uint8_t *b = static_cast<const uint8_t *>(p);
+    return arena_ && b >= arena_ && b < arena_ + blockSize_ * blockCount_;
+}
+
+size_t FixedBlockPool::list(const FixedBlockPool **out, size_t max)
+{
+    size_t n = 0;
+    portENTER_CRITICAL(&registryMux);
+    for (const FixedBlockPool *p = head_; p && n < max; p = p->next_)
+        out[n++] = p;
+    portEXIT_CRITICAL(&registryMux);
+    return n;
+}
+
+// ---- PooledJsonAllocator ----
+
+FixedBlockPool &PooledJsonAllocator::pool()
+{
+    static FixedBlockPool jsonPool("json", JSON_BLOCK_SIZE, JSON_BLOCKS,
+                                   MemoryAccounting::instance().registerModule("json"));
+    return jsonPool;
+}
+
+MemoryAccounting::ModuleId PooledJsonAllocator::module() const
+{
+    if (who_ != MemoryAccounting::INVALID_MODULE)
+        return who_;
+    static const MemoryAccounting::ModuleId json = MemoryAccounting::instance().registerModule("json");
+    return json;
+}
+
+void *PooledJsonAllocator::allocate(size_t size)
+{
+    if (size <= JSON_BLOCK_SIZE)
+    {
+        void *block = pool().allocate(module());
+        if (block)
+            return block;
+    }
+    return BufferAllocator::instance().allocate(size, BufferAllocator::Placement::Large, module());
+}
+
+void PooledJsonAllocator::deallocate(void *p)
+{
+    if (!p)
+        return;
+    if (pool().owns(p))
+        pool().release(p, module());
+    else
+        BufferAllocator::instance().release(p);
+}
+
+void *PooledJsonAllocator::reallocate(void *p, size_t size)
+{
+    // ArduinoJson only shrinks (shrinkToFit); a pool block already fits
+    if (!p)
+        return allocate(size);
+    if (pool().owns(p) && size <= JSON_BLOCK_SIZE)
+        return p;
+
+    void *q = allocate(size);
+    if (!q)
+        return nullptr;
+    const size_t oldSize = pool().owns(p) ? JSON_BLOCK_SIZE : BufferAllocator::sizeOf(p);
+    memcpy(q, p, min(oldSize, size));
+    deallocate(p);
+    return q;
+}
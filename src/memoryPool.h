@@ -0,0 +1,97 @@
+#pragma once
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <atomic>
+#include "freertos/FreeRTOS.h"
+#include "memoryAccounting.h"
+
+/**
+ * @file memoryPool.h
+ * @brief Fixed-block pools and a pooled JSON allocator.
+ *
+ * Long uptimes fragment the heap when buffers of the same few sizes are malloc'ed and
+ * freed over and over between longer-lived allocations. A FixedBlockPool takes one
+ * arena at construction and hands out equally sized blocks from a free list, so its
+ * users never touch the heap again: allocate()/release() are O(1) under a short
+ * critical section and safe from any task.
+ *
+ * Pool blocks in use are charged to their module in MemoryAccounting
+ * (memoryAccounting.h), like BufferAllocator's heap blocks.
+ *
+ * PooledJsonDocument is an ArduinoJson document whose buffer comes from the shared
+ * JSON pool (JSON_BLOCK_SIZE blocks). Larger documents, or any while the pool is
+ * exhausted, fall back to BufferAllocator (Placement::Large, so PSRAM when fitted)
+ * and are accounted the same way:
+ *
+ *   PooledJsonDocument doc(2048, PooledJsonAllocator(moduleId));
+ */
+
+class FixedBlockPool
+{
+public:
+    // Takes blockSize * blockCount bytes from the heap once; check valid() afterwards
+    FixedBlockPool(const char *name, size_t blockSize, size_t blockCount,
+                   MemoryAccounting::ModuleId owner = MemoryAccounting::INVALID_MODULE);
+    ~FixedBlockPool();
+
+    FixedBlockPool(const FixedBlockPool &) = delete;
+    FixedBlockPool &operator=(const FixedBlockPool &) = delete;
+
+    // nullptr when exhausted; `who` is charged for the block (default: the pool's owner)
+    void *allocate(MemoryAccounting::ModuleId who = MemoryAccounting::INVALID_MODULE);
+    void release(void *block, MemoryAccounting::ModuleId who = MemoryAccounting::INVALID_MODULE);
+    bool owns(const void *p) const;
+
+    bool valid() const { return arena_ != nullptr; }
+    const char *name() const { return name_; }
+    size_t blockSize() const { return blockSize_; }
+    size_t blockCount() const { return blockCount_; }
+    size_t inUse() const { return inUse_; }
+    size_t peakInUse() const { return peakInUse_; }
+    uint32_t failures() const { return failures_; }
+
+    // All live pools, for reporting
+    static size_t list(const FixedBlockPool **out, size_t max);
+
+private:
+    const char *name_;
+    size_t blockSize_;
+    size_t blockCount_;
+    MemoryAccounting::ModuleId owner_;
+    uint8_t *arena_;
+    void *freeList_; // next pointer stored in the first word of each free block
+    size_t inUse_;
+    size_t peakInUse_;
+    uint32_t failures_;
+    mutable portMUX_TYPE mux_;
+
+    FixedBlockPool *next_;
+    static FixedBlockPool *head_;
+};
+
+/**
+ * ArduinoJson allocator over the shared JSON pool. Stateful only for accounting:
+ * the module id rides along in the document.
+ */
+class PooledJsonAllocator
+{
+public:
+    static constexpr size_t JSON_BLOCK_SIZE = 4096;
+    static constexpr size_t JSON_BLOCKS = 2;
+
+    explicit PooledJsonAllocator(MemoryAccounting::ModuleId who = MemoryAccounting::INVALID_MODULE) : who_(who) {}
+
+    void *allocate(size_t size);
+    void deallocate(void *p);
+    void *reallocate(void *p, size_t size);
+
+    static FixedBlockPool &pool();
+
+private:
+    MemoryAccounting::ModuleId module() const;
+
+    MemoryAccounting::ModuleId who_;
+};
+
+using PooledJsonDocument = BasicJsonDocument<PooledJsonAllocator>;
@@ -3,7 +3,33 @@
 #include <WiFi.h>
 #include "config.h"
 #include "Logger.h"
-#include "System.h"
+#include "system.h"
+#include "linkMonitor.h"
+#include "esp_random.h"
+#include "trace.h"
+#include <Preferences.h>
+#include <esp_netif.h>
+#include <esp_netif_net_stack.h>
+#include "lwip/dhcp.h"
+#include "lwip/prot/dhcp.h"
+
+#include <algorithm>
+
+constexpr uint32_t NetworkController::CONNECT_TIMEOUT_MS;
+constexpr uint32_t NetworkController::FAST_BOOT_TIMEOUT_MS;
+constexpr uint32_t NetworkController::SCAN_TIMEOUT_MS;
+constexpr uint32_t NetworkController::SCAN_CACHE_TTL_MS;
+constexpr uint32_t NetworkController::BACKOFF_BASE_MS;
+constexpr uint32_t NetworkController::BACKOFF_MAX_MS;
+constexpr uint8_t NetworkController::LEASE_REUSE_MAX_BOOTS;
+constexpr uint8_t NetworkController::REASON_CONNECT_TIMEOUT;
+constexpr uint8_t NetworkController::REASON_LOST_IP;
+
+namespace
+{
+    constexpr const char *PREFS_NAMESPACE = "wifi";
+    constexpr const char *PREFS_CACHE_KEY = "fastboot";
+}
 
 NetworkController &NetworkController::instance()
 {
@@ -12,12 +38,46 @@ NetworkController &NetworkController::instance()
 }
 
 NetworkController::NetworkController()
+    : eventsRegistered_(false), pendingEvents_(0), pendingReason_(0),
+      state_(WifiState::Idle), stateSinceMs_(0),
+      candidateIdx_(0), connectedIdx_(0), usedBssid_(false),
+      attemptStartMs_(0), backoffUntilMs_(0), failedRounds_(0),
+      linkLost_(false), lostAtMs_(0),
+      fastBootAttempt_(false), leaseApplied_(false), leaseTimer_(0), bootConnected_(false), cache_(),
+      leaseAcquiredMonoUs_(0),
+      trialActive_(false), stateBeforeTrial_(WifiState::Idle),
+      scanInProgress_(false), haveScan_(false), scanStartMs_(0), scanDoneMs_(0)
 {
     // start with WiFi off until explicitly requested
     WiFi.mode(WIFI_MODE_NULL);
     WiFi.disconnect(true);
 }
 
+/**
+ * WiFi event handler. Runs on the WiFi/event task: only record what happened.
+ */
+void NetworkController::onWiFiEvent(arduino_event_id_t event, arduino_event_info_t info)
+{
+    switch (event)
+    {
+    case ARDUINO_EVENT_WIFI_STA_GOT_IP:
+        pendingEvents_.fetch_or(EVT_GOT_IP);
+        break;
+    case ARDUINO_EVENT_WIFI_STA_DISCONNECTED:
+        // Our own WiFi.begin()/disconnect() leaving the AP is not a failure
+        if (info.wifi_sta_disconnected.reason == WIFI_REASON_ASSOC_LEAVE)
+            break;
+        pendingReason_.store(info.wifi_sta_disconnected.reason);
+        pendingEvents_.fetch_or(EVT_DISCONNECTED);
+        break;
+    case ARDUINO_EVENT_WIFI_STA_LOST_IP:
+        pendingEvents_.fetch_or(EVT_LOST_IP);
+        break;
+    default:
+        break;
+    }
+}
+
 /**
  * Start soft AP with given SSID.
  */
@@ -25,8 +85,8 @@ void NetworkController::startAPMode(const String &name)
 {
     Logger::instance().info(String("Starting AP mode: ") + name);
 
-    // Ensure WiFi is in AP mode
-    WiFi.mode(WIFI_MODE_AP);
+    // Add AP to whatever is running (AP+STA keeps the station link)
+    WiFi.mode((wifi_mode_t)(WiFi.getMode() | WIFI_MODE_AP));
 
     // Start soft AP (open network). Add password or config as needed later.
     bool ok = WiFi.softAP(name.c_str());
@@ -51,8 +111,7 @@ void NetworkController::stopAPMode()
     if (mode & WIFI_MODE_AP)
     {
         Logger::instance().info("Stopping AP mode");
-        WiFi.softAPdisconnect(true); // disconnect clients and stop AP
-        WiFi.mode(WIFI_MODE_NULL);   // turn off WiFi or caller can set desired mode later
+        WiFi.softAPdisconnect(true); // disconnect clients and clear the AP bit (STA stays)
         delay(50);                   // give stack a moment to settle
         Logger::instance().info(String("AP stopped, mode=") + String((int)WiFi.getMode()));
     }
@@ -63,62 +122,597 @@ void NetworkController::stopAPMode()
 }
 
 /**
- * Start STA mode and attempt to connect using credentials from Config.
+ * Start the background station state machine using the networks stored in Config.
  */
-bool NetworkController::connectToWiFi()
+bool NetworkController::startStation()
 {
-    String ssid = Config::instance().getSsid();
-    String pass = Config::instance().getPassword();
-
-    if (ssid.length() == 0)
+    std::vector<Config::WifiNetwork> networks = Config::instance().getNetworks();
+    if (networks.empty())
     {
         Logger::instance().warn("No SSID configured; cannot start STA mode");
         return false;
     }
 
-    Logger::instance().info(String("Connecting to WiFi SSID=\"") + ssid + "\"");
+    registerEvents();
 
-    // Configure STA mode and attempt connection
-    WiFi.mode(WIFI_MODE_STA);
-    WiFi.disconnect(true);
-    delay(100);
+    candidates_.clear();
+    for (const auto &n : networks)
+    {
+        Candidate c;
+        c.ssid = n.ssid;
+        c.password = n.password;
+        candidates_.push_back(c);
+    }
+
+    WiFi.mode((wifi_mode_t)(WiFi.getMode() | WIFI_MODE_STA));
+
+    failedRounds_ = 0;
+    linkLost_ = false;
+
+    // Fast boot: go straight to the network that worked last time.
+    if (!bootConnected_ && loadFastBootCache(cache_))
+    {
+        metrics_.previousBootToIpMs = cache_.lastBootToIpMs;
+        for (size_t i = 0; i < candidates_.size(); ++i)
+        {
+            if (candidates_[i].ssid == cache_.ssid)
+            {
+                std::swap(candidates_[0], candidates_[i]);
+                memcpy(candidates_[0].bssid, cache_.bssid, sizeof(cache_.bssid));
+                candidates_[0].channel = cache_.channel;
+                candidates_[0].haveBssid = true;
+                fastBootAttempt_ = true;
+                break;
+            }
+        }
+    }
 
-    if (pass.length() > 0)
-        WiFi.begin(ssid.c_str(), pass.c_str());
+    if (fastBootAttempt_)
+    {
+        candidateIdx_ = 0;
+        connectCandidate(System::instance().monotonicMs());
+    }
     else
-        WiFi.begin(ssid.c_str());
+    {
+        beginRound(System::instance().monotonicMs());
+    }
+    return true;
+}
+
+void NetworkController::registerEvents()
+{
+    if (eventsRegistered_)
+        return;
+    WiFi.onEvent([this](arduino_event_id_t event, arduino_event_info_t info)
+                 { this->onWiFiEvent(event, info); });
+    // We drive reconnects ourselves; keep the SDK from racing us or writing NVS.
+    WiFi.persistent(false);
+    WiFi.setAutoReconnect(false);
+    eventsRegistered_ = true;
+}
+
+bool NetworkController::beginTrial(const String &ssid, const String &password, TrialCallback cb)
+{
+    if (trialActive_ || ssid.length() == 0)
+        return false;
+
+    registerEvents();
+    WiFi.mode((wifi_mode_t)(WiFi.getMode() | WIFI_MODE_STA));
 
-    const unsigned long timeoutMs = 15000; // total wait time
-    unsigned long start = millis();
-    while (WiFi.status() != WL_CONNECTED && (millis() - start) < timeoutMs)
+    Candidate c;
+    c.ssid = ssid;
+    c.password = password;
+    for (const auto &r : scanResults_)
     {
-        delay(200);
+        if (r.ssid == ssid)
+        {
+            memcpy(c.bssid, r.bssid, sizeof(c.bssid));
+            c.channel = r.channel;
+            c.haveBssid = true;
+            break;
+        }
     }
 
-    if (WiFi.status() == WL_CONNECTED)
+    Logger::instance().info(String("WiFi: trying \"") + ssid + "\"");
+    savedCandidates_ = candidates_;
+    stateBeforeTrial_ = state_;
+    candidates_.assign(1, c);
+    candidateIdx_ = 0;
+    fastBootAttempt_ = false;
+    trialActive_ = true;
+    trialCallback_ = cb;
+    connectCandidate(System::instance().monotonicMs());
+    return true;
+}
+
+/**
+ * End a credential trial. On success keep the new network first and the previous
+ * ones as fallbacks; on failure go back to the previous networks.
+ */
+void NetworkController::finishTrial(bool ok, uint64_t now)
+{
+    trialActive_ = false;
+    TrialCallback cb = trialCallback_;
+    trialCallback_ = nullptr;
+
+    if (ok)
     {
-        IPAddress ip = WiFi.localIP();
-        Logger::instance().info(String("WiFi connected, IP=") + ip.toString());
-        return true;
+        for (const auto &c : savedCandidates_)
+        {
+            if (c.ssid != candidates_[0].ssid)
+                candidates_.push_back(c);
+        }
+        Logger::instance().info(String("WiFi: trial on \"") + candidates_[0].ssid + "\" succeeded");
+        saveFastBootCache(false);
     }
     else
     {
-        Logger::instance().warn("WiFi connect timed out");
+        Logger::instance().warn(String("WiFi: trial on \"") + candidates_[0].ssid + "\" failed");
+        candidates_ = savedCandidates_;
+        // state_ is Connecting here unless disconnectFromWiFi() ended the trial; resume
+        // only a station that was running before it, leave an idle one idle
+        if (stateBeforeTrial_ != WifiState::Idle && state_ != WifiState::Idle && !candidates_.empty())
+        {
+            failedRounds_ = 0;
+            beginRound(now);
+        }
+        else if (state_ != WifiState::Idle)
+        {
+            WiFi.disconnect();
+            setState(WifiState::Idle, now);
+        }
+    }
+    savedCandidates_.clear();
+
+    if (cb)
+        cb(ok);
+}
+
+bool NetworkController::loadFastBootCache(FastBootCache &cache)
+{
+    Preferences prefs;
+    if (!prefs.begin(PREFS_NAMESPACE, true))
+        return false;
+    size_t n = prefs.getBytes(PREFS_CACHE_KEY, &cache, sizeof(cache));
+    prefs.end();
+    if (n != sizeof(cache) || cache.version != FAST_BOOT_CACHE_VERSION || cache.channel == 0)
         return false;
+    cache.ssid[sizeof(cache.ssid) - 1] = '\0';
+    return true;
+}
+
+/**
+ * Record the current association and lease. Written once per boot (first IP), plus
+ * dateLease() when the clock became valid only later, so NVS sees at most two small
+ * writes per power cycle.
+ */
+void NetworkController::saveFastBootCache(bool leaseReused)
+{
+    const Candidate &c = candidates_[candidateIdx_];
+    FastBootCache fresh = {};
+    fresh.version = FAST_BOOT_CACHE_VERSION;
+    strncpy(fresh.ssid, c.ssid.c_str(), sizeof(fresh.ssid) - 1);
+    memcpy(fresh.bssid, c.bssid, sizeof(fresh.bssid));
+    fresh.channel = c.channel;
+    fresh.ip = (uint32_t)WiFi.localIP();
+    fresh.gateway = (uint32_t)WiFi.gatewayIP();
+    fresh.netmask = (uint32_t)WiFi.subnetMask();
+    fresh.dns = (uint32_t)WiFi.dnsIP();
+    fresh.leaseUses = leaseReused ? (uint8_t)(cache_.leaseUses + 1) : 0;
+    fresh.lastBootToIpMs = metrics_.bootToIpMs;
+    fresh.leaseTimeS = leaseReused ? cache_.leaseTimeS : dhcpLeaseTimeS();
+    fresh.leaseStartS = leaseReused ? cache_.leaseStartS : 0;
+    if (!leaseReused && fresh.leaseTimeS != 0)
+    {
+        // Obtained just now; without a valid clock it is dated once TimeSync has one
+        const System &sys = System::instance();
+        if (sys.timeValid())
+            fresh.leaseStartS = (uint32_t)(sys.now() / 1000000);
+        else
+            leaseAcquiredMonoUs_ = sys.monotonicUs();
+    }
+
+    Preferences prefs;
+    if (!prefs.begin(PREFS_NAMESPACE, false))
+    {
+        Logger::instance().warn("WiFi: cannot open NVS for fast-boot cache");
+        return;
+    }
+    prefs.putBytes(PREFS_CACHE_KEY, &fresh, sizeof(fresh));
+    prefs.end();
+    cache_ = fresh;
+}
+
+/**
+ * Give this boot's lease its start time once the wall clock is valid (a second, last
+ * cache write for the boot). Without it the lease could not be reused after a reset.
+ */
+void NetworkController::dateLease()
+{
+    const System &sys = System::instance();
+    cache_.leaseStartS = (uint32_t)(sys.nowAt(leaseAcquiredMonoUs_) / 1000000);
+    leaseAcquiredMonoUs_ = 0;
+
+    Preferences prefs;
+    if (!prefs.begin(PREFS_NAMESPACE, false))
+        return;
+    prefs.putBytes(PREFS_CACHE_KEY, &cache_, sizeof(cache_));
+    prefs.end();
+}
+
+/**
+ * Seconds until T1 (half the lease, when a DHCP client renews) of the cached lease;
+ * 0 when it must not be reused.
+ */
+uint32_t NetworkController::cachedLeaseRemainingS() const
+{
+    if (cache_.ip == 0 || cache_.leaseUses >= LEASE_REUSE_MAX_BOOTS || cache_.leaseTimeS == 0 ||
+        cache_.leaseStartS == 0)
+        return 0;
+    // After a power cycle the clock is only a lower bound: the lease's age is unknown
+    const System &sys = System::instance();
+    if (!sys.timeValid())
+        return 0;
+    const int64_t nowS = sys.now() / 1000000;
+    const int64_t t1S = (int64_t)cache_.leaseStartS + cache_.leaseTimeS / 2;
+    if (nowS < (int64_t)cache_.leaseStartS || nowS >= t1S)
+        return 0;
+    return (uint32_t)(t1S - nowS);
+}
+
+/**
+ * Lease time of the station's bound DHCP lease, in seconds (0 = none). esp_netif has
+ * no getter for the client's lease, so it is read from lwIP's DHCP state.
+ */
+uint32_t NetworkController::dhcpLeaseTimeS()
+{
+    esp_netif_t *sta = esp_netif_get_handle_from_ifkey("WIFI_STA_DEF");
+    struct netif *nif = sta ? static_cast<struct netif *>(esp_netif_get_netif_impl(sta)) : nullptr;
+    const struct dhcp *dhcp = nif ? netif_dhcp_data(nif) : nullptr;
+    return (dhcp && dhcp->state == DHCP_STATE_BOUND) ? dhcp->offered_t0_lease : 0;
+}
+
+/**
+ * Stop using the cached lease: back to DHCP. On a live link lwIP starts a DHCP
+ * exchange right away (the address may change).
+ */
+void NetworkController::dropLease()
+{
+    System::instance().timers().cancel(leaseTimer_);
+    leaseTimer_ = 0;
+    WiFi.config(IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0));
+    leaseApplied_ = false;
+}
+
+void NetworkController::clearFastBootCache()
+{
+    Preferences prefs;
+    if (prefs.begin(PREFS_NAMESPACE, false))
+    {
+        prefs.remove(PREFS_CACHE_KEY);
+        prefs.end();
+    }
+    cache_ = FastBootCache();
+    leaseAcquiredMonoUs_ = 0;
+}
+
+void NetworkController::onStateChange(StateCallback cb)
+{
+    stateCallback_ = cb;
+}
+
+const char *NetworkController::stateToString(WifiState s)
+{
+    switch (s)
+    {
+    case WifiState::Idle:
+        return "idle";
+    case WifiState::Scanning:
+        return "scanning";
+    case WifiState::Connecting:
+        return "connecting";
+    case WifiState::Connected:
+        return "connected";
+    case WifiState::Backoff:
+        return "backoff";
+    default:
+        return "unknown";
+    }
+}
+
+void NetworkController::setState(WifiState s, uint64_t now)
+{
+    stateSinceMs_ = now;
+    if (s == state_)
+        return;
+    state_ = s;
+    Logger::instance().debug(String("WiFi: state ") + stateToString(s));
+    if (stateCallback_)
+        stateCallback_(s);
+}
+
+void NetworkController::loop()
+{
+    TRACE_SCOPE("network");
+    const uint32_t events = pendingEvents_.exchange(0);
+    const uint64_t now = System::instance().monotonicMs();
+
+    pollScan(now);
+
+    switch (state_)
+    {
+    case WifiState::Idle:
+        break;
+
+    case WifiState::Scanning:
+        // pollScan() finishes or times out the scan; then rank what we have
+        // (config order if nothing was found)
+        if (scanInProgress_)
+            break;
+        rankCandidates();
+        candidateIdx_ = 0;
+        connectCandidate(now);
+        break;
+
+    case WifiState::Connecting:
+        if (events & EVT_GOT_IP)
+            onConnected(now);
+        else if (events & EVT_DISCONNECTED)
+            onAttemptFailed(now, pendingReason_.load());
+        else if ((now - stateSinceMs_) >= (fastBootAttempt_ ? FAST_BOOT_TIMEOUT_MS : CONNECT_TIMEOUT_MS))
+            onAttemptFailed(now, REASON_CONNECT_TIMEOUT);
+        break;
+
+    case WifiState::Connected:
+        if (leaseAcquiredMonoUs_ != 0 && System::instance().timeValid())
+            dateLease();
+        if (events & (EVT_DISCONNECTED | EVT_LOST_IP))
+        {
+            metrics_.disconnects++;
+            metrics_.lastDisconnectReason = (events & EVT_DISCONNECTED) ? pendingReason_.load() : REASON_LOST_IP;
+            LinkMonitor::instance().recordDisconnect(metrics_.lastDisconnectReason);
+            linkLost_ = true;
+            lostAtMs_ = now;
+            Logger::instance().warn(String("WiFi: link lost (reason ") + String(metrics_.lastDisconnectReason) +
+                                    "), reconnecting");
+            // Fast path: straight back to the network we just had
+            candidateIdx_ = connectedIdx_;
+            connectCandidate(now);
+        }
+        break;
+
+    case WifiState::Backoff:
+        if (now >= backoffUntilMs_)
+            beginRound(now);
+        break;
     }
 }
 
+/**
+ * Start a connection round over all candidates. With more than one stored
+ * network they are ranked by RSSI first, from the scan cache if it is fresh,
+ * otherwise after a background scan.
+ */
+void NetworkController::beginRound(uint64_t now)
+{
+    candidateIdx_ = 0;
+    if (candidates_.size() > 1)
+    {
+        if (!scanInProgress_ && scanResultsFresh())
+        {
+            rankCandidates();
+        }
+        else if (scanInProgress_ || launchScan(now))
+        {
+            Logger::instance().debug("WiFi: scanning to rank stored networks");
+            setState(WifiState::Scanning, now);
+            return;
+        }
+    }
+    connectCandidate(now);
+}
+
+/**
+ * Rank candidates by the RSSI of their SSID in the scan cache and remember its
+ * BSSID/channel for a direct connect. Networks not seen keep their configured
+ * order at the end.
+ */
+void NetworkController::rankCandidates()
+{
+    if (scanResults_.empty())
+        return;
+
+    for (auto &c : candidates_)
+    {
+        c.rssi = RSSI_UNSEEN;
+        for (const auto &r : scanResults_)
+        {
+            if (c.ssid == r.ssid)
+            {
+                c.rssi = r.rssi;
+                memcpy(c.bssid, r.bssid, sizeof(c.bssid));
+                c.channel = r.channel;
+                c.haveBssid = true;
+                break;
+            }
+        }
+    }
+
+    std::stable_sort(candidates_.begin(), candidates_.end(),
+                     [](const Candidate &a, const Candidate &b)
+                     { return a.rssi > b.rssi; });
+}
+
+void NetworkController::connectCandidate(uint64_t now)
+{
+    Candidate &c = candidates_[candidateIdx_];
+
+    // A reason left from an earlier attempt must not be reported for this one
+    pendingEvents_.store(0);
+    pendingReason_.store(0);
+    metrics_.attempts++;
+    attemptStartMs_ = now;
+    usedBssid_ = c.haveBssid;
+
+    const char *pass = c.password.length() > 0 ? c.password.c_str() : nullptr;
+
+    // Reuse the cached lease as a static configuration to skip DHCP on fast boot while
+    // it is still valid (until T1); otherwise make sure DHCP is enabled.
+    const uint32_t leaseLeftS = fastBootAttempt_ ? cachedLeaseRemainingS() : 0;
+    if (leaseLeftS > 0)
+    {
+        WiFi.config(IPAddress(cache_.ip), IPAddress(cache_.gateway), IPAddress(cache_.netmask), IPAddress(cache_.dns));
+        leaseApplied_ = true;
+        TimerWheel &timers = System::instance().timers();
+        timers.cancel(leaseTimer_);
+        leaseTimer_ = timers.schedule((uint32_t)min<uint64_t>((uint64_t)leaseLeftS * 1000, UINT32_MAX),
+                                      [this]
+                                      {
+                                          leaseTimer_ = 0;
+                                          Logger::instance().info("WiFi: cached lease reached its renewal time, switching to DHCP");
+                                          dropLease();
+                                      });
+    }
+    else if (leaseApplied_)
+    {
+        dropLease();
+    }
+    if (usedBssid_)
+    {
+        char bssid[18];
+        snprintf(bssid, sizeof(bssid), "%02X:%02X:%02X:%02X:%02X:%02X",
+                 c.bssid[0], c.bssid[1], c.bssid[2], c.bssid[3], c.bssid[4], c.bssid[5]);
+        Logger::instance().info(String("Connecting to WiFi SSID=\"") + c.ssid + "\" BSSID=" + bssid +
+                                " CH=" + String(c.channel));
+        WiFi.begin(c.ssid.c_str(), pass, c.channel, c.bssid);
+    }
+    else
+    {
+        Logger::instance().info(String("Connecting to WiFi SSID=\"") + c.ssid + "\"");
+        WiFi.begin(c.ssid.c_str(), pass);
+    }
+    setState(WifiState::Connecting, now);
+}
+
+void NetworkController::onConnected(uint64_t now)
+{
+    Candidate &c = candidates_[candidateIdx_];
+    const uint8_t *bssid = WiFi.BSSID();
+    if (bssid)
+    {
+        memcpy(c.bssid, bssid, sizeof(c.bssid));
+        c.channel = (uint8_t)WiFi.channel();
+        c.haveBssid = true;
+    }
+    connectedIdx_ = candidateIdx_;
+
+    metrics_.successes++;
+    metrics_.lastConnectMs = (uint32_t)(now - attemptStartMs_);
+    if (metrics_.bootToIpMs == 0)
+        metrics_.bootToIpMs = (uint32_t)now;
+    if (linkLost_)
+    {
+        metrics_.lastRecoveryMs = (uint32_t)(now - lostAtMs_);
+        linkLost_ = false;
+    }
+    failedRounds_ = 0;
+
+    Logger::instance().info(String("WiFi connected, IP=") + WiFi.localIP().toString() +
+                            " in " + String(metrics_.lastConnectMs) + " ms");
+
+    if (!bootConnected_)
+    {
+        bootConnected_ = true;
+        metrics_.fastBoot = fastBootAttempt_;
+        metrics_.leaseReused = fastBootAttempt_ && leaseApplied_;
+        Logger::instance().info(String("WiFi: boot to IP ") + String(metrics_.bootToIpMs) + " ms (" +
+                                (metrics_.leaseReused ? "cached channel+lease" : metrics_.fastBoot ? "cached channel" : "scan+DHCP") +
+                                ", previous boot " + String(metrics_.previousBootToIpMs) + " ms)");
+        saveFastBootCache(metrics_.leaseReused);
+    }
+    fastBootAttempt_ = false;
+
+    setState(WifiState::Connected, now);
+    if (trialActive_)
+        finishTrial(true, now);
+}
+
+void NetworkController::onAttemptFailed(uint64_t now, uint8_t reason)
+{
+    metrics_.failures++;
+    metrics_.lastDisconnectReason = reason;
+    LinkMonitor::instance().recordDisconnect(metrics_.lastDisconnectReason);
+
+    Candidate &c = candidates_[candidateIdx_];
+    Logger::instance().warn(String("WiFi: attempt on \"") + c.ssid + "\" failed (reason " +
+                            String(metrics_.lastDisconnectReason) + ")");
+
+    // Fast boot failed: the cached AP/lease is stale. Forget it and do a full round.
+    if (fastBootAttempt_)
+    {
+        fastBootAttempt_ = false;
+        c.haveBssid = false;
+        clearFastBootCache();
+        Logger::instance().info("WiFi: fast-boot attempt failed, falling back to full scan");
+        beginRound(now);
+        return;
+    }
+
+    // A stale BSSID/channel (AP moved or replaced): retry the same SSID with a driver scan.
+    if (usedBssid_)
+    {
+        c.haveBssid = false;
+        connectCandidate(now);
+        return;
+    }
+
+    if (trialActive_)
+    {
+        finishTrial(false, now);
+        return;
+    }
+
+    if (++candidateIdx_ < candidates_.size())
+    {
+        connectCandidate(now);
+        return;
+    }
+
+    enterBackoff(now);
+}
+
+void NetworkController::enterBackoff(uint64_t now)
+{
+    WiFi.disconnect();
+
+    uint32_t delayMs = BACKOFF_BASE_MS << min<uint8_t>(failedRounds_, 6);
+    if (delayMs > BACKOFF_MAX_MS)
+        delayMs = BACKOFF_MAX_MS;
+    // +-25% jitter so a fleet rebooting together does not retry in lockstep
+    delayMs = delayMs - delayMs / 4 + esp_random() % (delayMs / 2 + 1);
+    if (failedRounds_ < 255)
+        failedRounds_++;
+
+    backoffUntilMs_ = now + delayMs;
+    Logger::instance().warn(String("WiFi: all networks failed, retrying in ") + String(delayMs) + " ms");
+    setState(WifiState::Backoff, now);
+}
+
 /**
  * Disconnect from WiFi station (if connected) and clear WiFi mode.
  */
 void NetworkController::disconnectFromWiFi()
 {
+    const uint64_t now = System::instance().monotonicMs();
+    setState(WifiState::Idle, now);
+    if (trialActive_)
+        finishTrial(false, now);
+
     // If connected as STA or STA mode active, disconnect
     if (WiFi.status() == WL_CONNECTED || (WiFi.getMode() & WIFI_MODE_STA))
     {
         Logger::instance().info("Disconnecting from WiFi (STA)");
-        WiFi.disconnect(true); // erase credentials if true, disconnect clients if AP
-        WiFi.mode(WIFI_MODE_NULL);
+        WiFi.disconnect(true); // wifioff: clears the STA bit only, a running AP stays up
         delay(50);
         Logger::instance().info(String("Disconnected, status=") + String(WiFi.status()));
     }
@@ -128,40 +722,121 @@ void NetworkController::disconnectFromWiFi()
     }
 }
 
+bool NetworkController::startScan(bool force)
+{
+    if (scanInProgress_)
+        return true;
+    if (!force && scanResultsFresh())
+        return false;
+    if (state_ == WifiState::Connecting)
+    {
+        Logger::instance().debug("WiFi: scan deferred, connection attempt in progress");
+        return false;
+    }
+    return launchScan(System::instance().monotonicMs());
+}
+
+bool NetworkController::scanResultsFresh() const
+{
+    return scanAgeMs() < SCAN_CACHE_TTL_MS;
+}
+
+uint32_t NetworkController::scanAgeMs() const
+{
+    return haveScan_ ? (uint32_t)min<uint64_t>(System::instance().monotonicMs() - scanDoneMs_, UINT32_MAX - 1) : UINT32_MAX;
+}
+
+bool NetworkController::launchScan(uint64_t now)
+{
+    if (WiFi.scanNetworks(true) == WIFI_SCAN_FAILED)
+    {
+        Logger::instance().warn("WiFi: could not start scan");
+        return false;
+    }
+    scanInProgress_ = true;
+    scanStartMs_ = now;
+    return true;
+}
+
 /**
- * Scan for WiFi networks and return list of SSID strings.
- *
- * This is a blocking call (WiFi.scanNetworks()) and can take a couple of seconds.
- * Use asynchronous scan variants if you need non-blocking behaviour.
+ * Collect the results of a running background scan, or abandon it after SCAN_TIMEOUT_MS.
+ * The driver's result list is freed right away; only the deduplicated cache is kept.
  */
-std::vector<String> NetworkController::scanNetworks()
+void NetworkController::pollScan(uint64_t now)
 {
-    Logger::instance().info("Scanning for WiFi networks...");
-    int n = WiFi.scanNetworks();
-    std::vector<String> ssids;
-    if (n <= 0)
+    if (!scanInProgress_)
+        return;
+
+    int16_t found = WiFi.scanComplete();
+    if (found == WIFI_SCAN_RUNNING)
     {
-        Logger::instance().info("No WiFi networks found");
-        return ssids;
+        if (now - scanStartMs_ < SCAN_TIMEOUT_MS)
+            return;
+        Logger::instance().warn("WiFi: scan timed out");
+    }
+    else if (found >= 0)
+    {
+        harvestScan(found, now);
+    }
+    else
+    {
+        Logger::instance().warn("WiFi: scan failed");
     }
 
-    ssids.reserve((size_t)n);
-    for (int i = 0; i < n; ++i)
+    WiFi.scanDelete();
+    scanInProgress_ = false;
+}
+
+void NetworkController::harvestScan(int16_t found, uint64_t now)
+{
+    scanResults_.clear();
+    scanResults_.reserve((size_t)found);
+
+    for (int16_t i = 0; i < found; ++i)
     {
-        String s = WiFi.SSID(i);
-        ssids.push_back(s);
+        String ssid = WiFi.SSID(i);
+        if (ssid.length() == 0)
+            continue; // hidden network
 
-        // detailed debug log
-        Logger::instance().debug(String("Found: ") + s +
-                                 " RSSI=" + String(WiFi.RSSI(i)) +
-                                 " CH=" + String(WiFi.channel(i)) +
-                                 " ENC=" + String(WiFi.encryptionType(i)));
+        ScanResult *entry = nullptr;
+        for (auto &r : scanResults_)
+        {
+            if (r.ssid == ssid)
+            {
+                entry = &r;
+                break;
+            }
+        }
+
+        int32_t rssi = WiFi.RSSI(i);
+        if (!entry)
+        {
+            scanResults_.emplace_back();
+            entry = &scanResults_.back();
+            entry->ssid = ssid;
+        }
+        else if (rssi <= entry->rssi)
+        {
+            entry->apCount++;
+            continue;
+        }
+
+        entry->apCount++;
+        entry->rssi = rssi;
+        memcpy(entry->bssid, WiFi.BSSID(i), sizeof(entry->bssid));
+        entry->channel = (uint8_t)WiFi.channel(i);
+        entry->encryption = WiFi.encryptionType(i);
     }
 
-    // free scan results
-    WiFi.scanDelete();
+    std::sort(scanResults_.begin(), scanResults_.end(),
+              [](const ScanResult &a, const ScanResult &b)
+              { return a.rssi > b.rssi; });
 
-    return ssids;
+    haveScan_ = true;
+    scanDoneMs_ = now;
+    Logger::instance().debug(String("WiFi: scan found ") + String(found) + " BSSIDs, " +
+                             String((unsigned)scanResults_.size()) + " networks in " +
+                             String((unsigned long)(now - scanStartMs_)) + " ms");
 }
 
 /**
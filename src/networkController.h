@@ -2,7 +2,10 @@
 
 #include <Arduino.h>
 #include <WiFi.h>
+#include <atomic>
+#include <functional>
 #include <vector>
+#include "timerWheel.h"
 
 /**
  * @class NetworkController
@@ -10,17 +13,93 @@
  *
  * Responsibilities:
  *  - Start/stop a soft Access Point (AP) for provisioning.
- *  - Connect/disconnect in Station (STA) mode using stored credentials.
- *  - Provide the current IP address and perform network scans.
+ *  - Keep the station (STA) connected to the best known network, in the background.
+ *  - Provide the current IP address and run background network scans.
+ *
+ * Station state machine (driven by ESP WiFi events, advanced from loop()):
+ *
+ *   Idle -> [Scanning] -> Connecting -> Connected
+ *                            |   ^          |
+ *                            v   |          | link lost: fast reconnect via cached BSSID/channel
+ *                          Backoff <--------+ (after all candidates failed)
+ *
+ *  - With several stored networks a scan ranks them by RSSI first.
+ *  - Each attempt first uses the cached BSSID/channel (skips the driver's scan);
+ *    if that fails the same network is retried without them.
+ *  - When every candidate failed, retries back off exponentially (1 s .. 60 s, +-25% jitter).
+ *
+ * Scanning is asynchronous and shared: results are cached (deduplicated by SSID, strongest
+ * BSSID kept) for SCAN_CACHE_TTL_MS and used both for ranking stored networks and for
+ * callers such as the /api/scan endpoint.
+ *
+ * Fast boot: the last successful SSID, BSSID, channel and DHCP lease are kept in NVS.
+ * On boot the cached network is tried first with a direct connect and the cached lease
+ * applied as static IP (skipping scan and DHCP); if that attempt fails the cache is
+ * dropped and a normal round (scan + DHCP) follows. The lease is stored with its
+ * lifetime and the wall-clock time it was obtained, and is only reused while the clock
+ * is trustworthy (System::timeValid()) and the lease has not reached T1 (half its
+ * lifetime, when a DHCP client would renew); at T1 a running connection switches back
+ * to DHCP. It is reused for at most LEASE_REUSE_MAX_BOOTS boots in any case.
+ *
+ * AP and STA are independent: startAPMode()/stopAPMode() and startStation()/disconnectFromWiFi()
+ * only toggle their own bit of the WiFi mode, so a provisioning AP can run next to a live
+ * station link (AP+STA; the AP then shares the station's channel). beginTrial() tests new
+ * credentials on the live station and switches to them on success, without a reboot.
  *
  * Notes:
- *  - Not thread-safe; call from the main task / same context that manages network state.
+ *  - Not thread-safe; call from the service task (see taskLayout.h).
+ *    WiFi event callbacks only set atomic flags that loop() consumes.
  *  - Methods are idempotent where practical (stopAPMode/disconnectFromWiFi can be called repeatedly).
  *  - Use ipAddress() to determine when to start services that require a usable IP (e.g. mDNS).
  */
 class NetworkController
 {
 public:
+    enum class WifiState : uint8_t
+    {
+        Idle,
+        Scanning,
+        Connecting,
+        Connected,
+        Backoff
+    };
+
+    // lastDisconnectReason values for losses the driver gives no reason for
+    // (wifi_err_reason_t codes stay below 220)
+    static constexpr uint8_t REASON_CONNECT_TIMEOUT = 254; ///< attempt got no IP in time
+    static constexpr uint8_t REASON_LOST_IP = 255;         ///< IP lost while still associated
+
+    struct ConnectionMetrics
+    {
+        uint32_t attempts = 0;          ///< association attempts started
+        uint32_t successes = 0;         ///< attempts that reached GOT_IP
+        uint32_t failures = 0;          ///< attempts that failed or timed out
+        uint32_t disconnects = 0;       ///< link losses while connected
+        uint32_t bootToIpMs = 0;        ///< ms since boot at the first IP (0 = not yet)
+        uint32_t lastConnectMs = 0;     ///< attempt start -> IP for the latest success
+        uint32_t lastRecoveryMs = 0;    ///< link loss -> IP for the latest reconnect
+        uint8_t lastDisconnectReason = 0; ///< wifi_err_reason_t or REASON_* of the latest disconnect
+        bool fastBoot = false;          ///< boot connection used the cached BSSID/channel
+        bool leaseReused = false;       ///< boot connection used the cached lease (no DHCP)
+        uint32_t previousBootToIpMs = 0; ///< bootToIpMs recorded by the previous boot
+    };
+
+    /**
+     * @brief One network seen by a scan (strongest BSSID of that SSID).
+     */
+    struct ScanResult
+    {
+        String ssid;
+        uint8_t bssid[6] = {0};
+        int32_t rssi = 0;
+        uint8_t channel = 0;
+        wifi_auth_mode_t encryption = WIFI_AUTH_OPEN;
+        uint8_t apCount = 0; ///< number of BSSIDs advertising this SSID
+    };
+
+    using StateCallback = std::function<void(WifiState state)>;
+    using TrialCallback = std::function<void(bool ok)>;
+
     // Access singleton instance
     static NetworkController &instance();
 
@@ -34,8 +113,9 @@ public:
      * @brief Start Access Point mode (used for provisioning).
      * @param name SSID to advertise for the AP (e.g. "Heater-XXXX").
      *
-     * This configures the WiFi hardware into AP mode and starts a soft AP. If AP is already
-     * running this call will attempt to reconfigure it to the requested name.
+     * Adds the AP bit to the current WiFi mode (a running station stays connected) and
+     * starts a soft AP. If AP is already running this call will attempt to reconfigure
+     * it to the requested name.
      */
     void startAPMode(const String &name);
 
@@ -43,36 +123,77 @@ public:
      * @brief Stop the soft AP if running.
      *
      * Safe to call repeatedly. This will disconnect any connected clients and clear
-     * the AP mode bit; the function leaves WiFi in WIFI_MODE_NULL.
+     * the AP mode bit only; the station (if any) is left untouched.
      */
     void stopAPMode();
 
     /**
-     * @brief Start Station (STA) mode and attempt to connect using configured credentials.
-     * @return true if connection succeeded, false otherwise.
+     * @brief Start keeping the station connected using the networks stored in Config.
+     * @return false if no network is configured, true once the state machine is running.
      *
-     * This method reads SSID/password from the Config singleton and attempts to connect.
-     * It blocks for a short, bounded timeout while waiting for association.
+     * Non-blocking: progress is reported through onStateChange() and state().
      */
-    bool connectToWiFi();
+    bool startStation();
 
     /**
      * @brief Disconnect from WiFi station (if connected) and clear WiFi mode.
      *
-     * Safe to call repeatedly. This will disconnect the STA interface and set WiFi mode
-     * to WIFI_MODE_NULL. It does not modify stored credentials unless WiFi.disconnect(true)
-     * is explicitly used in the implementation.
+     * Safe to call repeatedly. Stops the station state machine (failing a running trial),
+     * disconnects the STA interface and clears the STA mode bit; a running AP stays up.
+     * Stored credentials are untouched.
      */
     void disconnectFromWiFi();
 
     /**
-     * @brief Scan for available WiFi networks (blocking).
-     * @return Vector of SSID strings found by the scan. Empty vector if none found or on error.
+     * @brief Try a network live before committing it.
+     * @param cb Called from loop() with the outcome.
+     * @return false if another trial is already running.
      *
-     * Note: WiFi.scanNetworks() is a blocking call and may take a couple of seconds.
-     * Consider calling this from a background task if you need non-blocking behavior.
+     * The station leaves its current network and connects to ssid. On success it stays
+     * there (previously stored networks remain as fallbacks); the caller decides whether
+     * to persist the credentials. On failure the previous networks are reconnected.
+     * Works with or without a running station (e.g. from AP-only provisioning).
+     */
+    bool beginTrial(const String &ssid, const String &password, TrialCallback cb);
+    bool trialActive() const { return trialActive_; }
+
+    /**
+     * @brief Advance the station state machine. Call from loop().
      */
-    std::vector<String> scanNetworks();
+    void loop();
+
+    WifiState state() const { return state_; }
+    bool isConnected() const { return state_ == WifiState::Connected; }
+    const ConnectionMetrics &metrics() const { return metrics_; }
+    static const char *stateToString(WifiState s);
+
+    /**
+     * @brief Register a callback invoked from loop() on every state transition.
+     */
+    void onStateChange(StateCallback cb);
+
+    /**
+     * @brief Start a background scan unless cached results are still fresh.
+     * @param force Rescan even if the cache has not expired.
+     * @return true if a scan is running after the call.
+     *
+     * Refused while a connection attempt is in progress (scanning would disturb it);
+     * the cached results stay available in that case.
+     */
+    bool startScan(bool force = false);
+
+    /**
+     * @brief Cached scan results, one entry per SSID, strongest first.
+     */
+    const std::vector<ScanResult> &scanResults() const { return scanResults_; }
+
+    bool scanInProgress() const { return scanInProgress_; }
+    bool scanResultsFresh() const;
+
+    /**
+     * @brief Age of the cached scan results in ms (UINT32_MAX if there are none).
+     */
+    uint32_t scanAgeMs() const;
 
     /**
      * @brief Return the current IP address for the active interface.
@@ -88,4 +209,109 @@ private:
     // Private ctor for singleton
     NetworkController();
     ~NetworkController() = default;
-};
\ No newline at end of file
+
+    static constexpr uint32_t CONNECT_TIMEOUT_MS = 10000;
+    static constexpr uint32_t FAST_BOOT_TIMEOUT_MS = 4000; // cached AP should answer quickly
+    static constexpr uint32_t SCAN_TIMEOUT_MS = 8000;
+    static constexpr uint32_t SCAN_CACHE_TTL_MS = 30000;
+    static constexpr uint32_t BACKOFF_BASE_MS = 1000;
+    static constexpr uint32_t BACKOFF_MAX_MS = 60000;
+    static constexpr int32_t RSSI_UNSEEN = -127;
+    static constexpr uint8_t LEASE_REUSE_MAX_BOOTS = 8;
+
+    // Event bits set from the WiFi event task, consumed by loop()
+    static constexpr uint32_t EVT_GOT_IP = 1u << 0;
+    static constexpr uint32_t EVT_DISCONNECTED = 1u << 1;
+    static constexpr uint32_t EVT_LOST_IP = 1u << 2;
+
+    struct Candidate
+    {
+        String ssid;
+        String password;
+        int32_t rssi = RSSI_UNSEEN;
+        uint8_t bssid[6] = {0};
+        uint8_t channel = 0;
+        bool haveBssid = false; // bssid/channel usable for a direct connect
+    };
+
+    // Persisted in NVS (namespace "wifi") so it survives power cycles
+    struct FastBootCache
+    {
+        uint8_t version;
+        char ssid[33];
+        uint8_t bssid[6];
+        uint8_t channel;
+        uint32_t ip;
+        uint32_t gateway;
+        uint32_t netmask;
+        uint32_t dns;
+        uint8_t leaseUses;       // boots that reused this lease without DHCP
+        uint32_t lastBootToIpMs; // time-to-IP of the boot that wrote the cache
+        uint32_t leaseTimeS;     // DHCP lease time (0 = unknown)
+        uint32_t leaseStartS;    // Unix time the lease was obtained (0 = clock was not valid)
+    };
+    static constexpr uint8_t FAST_BOOT_CACHE_VERSION = 2;
+
+    void registerEvents();
+    void finishTrial(bool ok, uint64_t now);
+
+    bool loadFastBootCache(FastBootCache &cache);
+    void saveFastBootCache(bool leaseReused);
+    void clearFastBootCache();
+    void dateLease();
+    uint32_t cachedLeaseRemainingS() const;
+    static uint32_t dhcpLeaseTimeS();
+    void dropLease();
+
+    void onWiFiEvent(arduino_event_id_t event, arduino_event_info_t info);
+    void setState(WifiState s, uint64_t now);
+    void beginRound(uint64_t now);
+    bool launchScan(uint64_t now);
+    void pollScan(uint64_t now);
+    void harvestScan(int16_t found, uint64_t now);
+    void rankCandidates();
+    void connectCandidate(uint64_t now);
+    void onConnected(uint64_t now);
+    void onAttemptFailed(uint64_t now, uint8_t reason);
+    void enterBackoff(uint64_t now);
+
+    bool eventsRegistered_;
+    std::atomic<uint32_t> pendingEvents_;
+    std::atomic<uint8_t> pendingReason_;
+
+    WifiState state_;
+    uint64_t stateSinceMs_;
+    StateCallback stateCallback_;
+
+    std::vector<Candidate> candidates_;
+    size_t candidateIdx_;
+    size_t connectedIdx_;
+    bool usedBssid_;
+    uint64_t attemptStartMs_;
+    uint64_t backoffUntilMs_;
+    uint8_t failedRounds_;
+    bool linkLost_;
+    uint64_t lostAtMs_;
+
+    // Fast-boot attempt in progress (first attempt after boot using the NVS cache)
+    bool fastBootAttempt_;
+    bool leaseApplied_;
+    TimerWheel::TimerId leaseTimer_; // T1 of the applied lease (System::timers())
+    bool bootConnected_;
+    FastBootCache cache_;
+    int64_t leaseAcquiredMonoUs_; // this boot's DHCP lease, until dated by dateLease() (0 = none)
+
+    ConnectionMetrics metrics_;
+
+    // Credential trial (beginTrial): candidates and station state to restore if it fails
+    bool trialActive_;
+    WifiState stateBeforeTrial_;
+    TrialCallback trialCallback_;
+    std::vector<Candidate> savedCandidates_;
+
+    std::vector<ScanResult> scanResults_;
+    bool scanInProgress_;
+    bool haveScan_;
+    uint64_t scanStartMs_;
+    uint64_t scanDoneMs_;
+};
@@ -1,4 +1,5 @@
-#include "OnBoardLed.h"
+#include "onBoardLed.h"
+#include "system.h"
 
 OnBoardLed &OnBoardLed::instance()
 {
@@ -9,7 +10,7 @@ OnBoardLed &OnBoardLed::instance()
 OnBoardLed::OnBoardLed()
     : strip(NUM_PIXELS, LED_PIN, NEO_GRB + NEO_KHZ800),
       isBlinking(false),
-      lastToggle(0),
+      blinkTimer(0),
       onDuration(500),
       offDuration(500),
       isOn(false),
@@ -106,7 +107,11 @@ bool OnBoardLed::startBlink(const String &hexColor, uint8_t intensity, uint32_t
     offDuration = offMs;
     isBlinking = true;
     isOn = true;
-    lastToggle = millis();
+
+    TimerWheel &timers = System::instance().timers();
+    timers.cancel(blinkTimer);
+    blinkTimer = timers.schedule(onDuration, [this]
+                                 { toggleBlink(); });
 
     applyColor();
     return true;
@@ -115,36 +120,32 @@ bool OnBoardLed::startBlink(const String &hexColor, uint8_t intensity, uint32_t
 void OnBoardLed::stopBlink()
 {
     isBlinking = false;
+    System::instance().timers().cancel(blinkTimer);
+    blinkTimer = 0;
     // leave LED showing steady color at currentBrightness
     isOn = true;
     applyColor();
 }
 
-void OnBoardLed::blinkLoop()
+void OnBoardLed::toggleBlink()
 {
+    blinkTimer = 0;
     if (!isBlinking)
         return;
 
-    unsigned long now = millis();
     if (isOn)
     {
-        if ((now - lastToggle) >= onDuration)
-        {
-            // turn off
-            strip.setPixelColor(0, 0);
-            strip.show();
-            isOn = false;
-            lastToggle = now;
-        }
+        // turn off
+        strip.setPixelColor(0, 0);
+        strip.show();
+        isOn = false;
     }
     else
     {
-        if ((now - lastToggle) >= offDuration)
-        {
-            // turn on
-            applyColor();
-            isOn = true;
-            lastToggle = now;
-        }
+        // turn on
+        applyColor();
+        isOn = true;
     }
-}
\ No newline at end of file
+    blinkTimer = System::instance().timers().schedule(isOn ? onDuration : offDuration, [this]
+                                                      { toggleBlink(); });
+}
@@ -2,13 +2,14 @@
 
 #include <Arduino.h>
 #include <Adafruit_NeoPixel.h>
+#include "timerWheel.h"
 
 /**
  * @file OnBoardLed.h
  * @brief Singleton controller for the on-board NeoPixel LED.
  *
  * Use OnBoardLed::instance() to access the single instance.
- * Call blinkLoop() from your main loop to drive non-blocking blinking.
+ * Blinking is driven by System::timers() (service task), so no per-loop polling is needed.
  */
 class OnBoardLed
 {
@@ -40,9 +41,6 @@ public:
     // Stop blinking and restore current color/intensity
     void stopBlink();
 
-    // Call from loop() to drive blinking
-    void blinkLoop();
-
 private:
     OnBoardLed();
     ~OnBoardLed() = default;
@@ -53,7 +51,7 @@ private:
     Adafruit_NeoPixel strip;
 
     volatile bool isBlinking;
-    volatile unsigned long lastToggle;
+    TimerWheel::TimerId blinkTimer; // pending on/off toggle, 0 if none
     volatile uint32_t onDuration;
     volatile uint32_t offDuration;
     volatile bool isOn;
@@ -65,4 +63,5 @@ private:
     static uint32_t colorFromRGB(uint8_t r, uint8_t g, uint8_t b);
     static bool parseHexColor(const String &hex, uint8_t &r, uint8_t &g, uint8_t &b);
     void applyColor();
+    void toggleBlink();
 };
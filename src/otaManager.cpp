@@ -3,8 +3,13 @@
 #include <ArduinoOTA.h>
 #include "Logger.h"
 #include "networkController.h"
-#include "System.h"
+#include "system.h"
 #include "config.h"
+#include "powerManager.h"
+#include "supervisor.h"
+#include "trace.h"
+
+constexpr uint32_t OtaManager::START_RETRY_MS;
 
 /*
  * otaManager.cpp
@@ -13,8 +18,9 @@
  * - startArduinoOta() configures ArduinoOTA callbacks (start/end/progress/error)
  *   and calls ArduinoOTA.begin() once the device has a valid IP address.
  * - begin() will defer startup if NetworkController::ipAddress() returns 0.0.0.0.
- * - loop() periodically retries deferred start (throttled to once per second)
- *   and calls ArduinoOTA.handle() when running.
+ * - a deferred start is retried once per second from a System::timers() periodic
+ *   timer, which cancels itself once ArduinoOTA is up.
+ * - loop() calls ArduinoOTA.handle() when running.
  */
 
 OtaManager &OtaManager::instance()
@@ -27,7 +33,7 @@ OtaManager::OtaManager()
     : arduinoOtaEnabled_(false),
       running_(false),
       pendingStart_(false),
-      lastStartAttemptMs_(0)
+      retryTimer_(0)
 {
 }
 
@@ -55,29 +61,32 @@ void OtaManager::begin(bool enableArduinoOta)
     else
     {
         pendingStart_ = true;
-        lastStartAttemptMs_ = 0;
+        if (!System::instance().timers().isPending(retryTimer_))
+            retryTimer_ = System::instance().timers().schedulePeriodic(START_RETRY_MS, [this]
+                                                                       { retryStart(); });
         Logger::instance().info("OtaManager: deferred ArduinoOTA until network available");
     }
 }
 
-void OtaManager::loop()
+void OtaManager::retryStart()
 {
-    // If starting was deferred, attempt to start periodically (throttled).
-    if (pendingStart_)
+    if (!pendingStart_)
+    {
+        System::instance().timers().cancel(retryTimer_);
+        return;
+    }
+    IPAddress ip = NetworkController::instance().ipAddress();
+    if (ip != IPAddress(0, 0, 0, 0))
     {
-        unsigned long now = millis();
-        if (now - lastStartAttemptMs_ >= 1000)
-        {
-            lastStartAttemptMs_ = now;
-            IPAddress ip = NetworkController::instance().ipAddress();
-            if (ip != IPAddress(0, 0, 0, 0))
-            {
-                pendingStart_ = false;
-                startArduinoOta();
-            }
-        }
+        pendingStart_ = false;
+        System::instance().timers().cancel(retryTimer_);
+        startArduinoOta();
     }
+}
 
+void OtaManager::loop()
+{
+    TRACE_SCOPE("ota");
     // Process ArduinoOTA events if running.
     if (running_ && arduinoOtaEnabled_)
     {
@@ -92,6 +101,8 @@ void OtaManager::stop()
         stopArduinoOta();
     }
     pendingStart_ = false;
+    System::instance().timers().cancel(retryTimer_);
+    retryTimer_ = 0;
     running_ = false;
 }
 
@@ -116,7 +127,11 @@ void OtaManager::startArduinoOta()
     }
 
     ArduinoOTA.onStart([]()
-                       { Logger::instance().info("ArduinoOTA: start"); });
+                       {
+                           Logger::instance().info("ArduinoOTA: start");
+                           PowerManager::instance().acquire(PowerManager::WakeLock::Ota);
+                           // The transfer runs inside handle() and blocks loop() until done
+                           Supervisor::instance().pause(true); });
 
     ArduinoOTA.onEnd([]()
                      {
@@ -135,6 +150,8 @@ void OtaManager::startArduinoOta()
 
     ArduinoOTA.onError([](ota_error_t error)
                        {
+                           PowerManager::instance().release(PowerManager::WakeLock::Ota);
+                           Supervisor::instance().pause(false);
                            switch (error)
                            {
                            case OTA_AUTH_ERROR:
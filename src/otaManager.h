@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Arduino.h>
+#include "timerWheel.h"
 
 /**
  * @file otaManager.h
@@ -13,8 +14,8 @@
  *
  * Usage:
  *  - Call `OtaManager::instance().begin(true)` once at startup (or after network is up).
- *  - Call `OtaManager::instance().loop()` from the main loop() to process OTA events
- *    and to attempt deferred startup when an IP becomes available.
+ *  - Call `OtaManager::instance().loop()` from the main loop() to process OTA events.
+ *    Deferred startup is retried by a System::timers() timer once an IP is available.
  *  - Call `OtaManager::instance().stop()` to stop processing OTA events (no formal
  *    ArduinoOTA::end() exists on all cores; stop means ceasing to call handle()).
  *
@@ -36,7 +37,7 @@ public:
      *
      * If `enableArduinoOta` is true and the device already has a valid IP address,
      * the ArduinoOTA subsystem is configured and started immediately. If no IP is
-     * available yet, the start is deferred and attempted from `loop()`. This prevents
+     * available yet, the start is deferred and retried once per second. This prevents
      * attempting ArduinoOTA before the network stack is ready.
      *
      * @param enableArduinoOta Enable ArduinoOTA (mDNS/IDE OTA). Default true.
@@ -46,9 +47,8 @@ public:
     /**
      * @brief Per-loop processing.
      *
-     * Call from the application's `loop()` to:
-     *  - attempt deferred startup (if IP was not present at `begin()` time),
-     *  - call `ArduinoOTA.handle()` when the manager is running.
+     * Call from the application's `loop()` to call `ArduinoOTA.handle()` when the
+     * manager is running.
      */
     void loop();
 
@@ -75,10 +75,12 @@ private:
     // Internal helpers to start/stop ArduinoOTA behavior.
     void startArduinoOta();
     void stopArduinoOta();
+    void retryStart();
 
     // Configuration flags/state
     bool arduinoOtaEnabled_;           ///< true if ArduinoOTA was requested
     bool running_;                     ///< true if ArduinoOTA is currently being handled
     bool pendingStart_;                ///< true if begin() deferred start due to no IP
-    unsigned long lastStartAttemptMs_; ///< throttle deferred start attempts
+    TimerWheel::TimerId retryTimer_;   ///< periodic deferred-start attempt (System::timers())
+    static constexpr uint32_t START_RETRY_MS = 1000;
 };
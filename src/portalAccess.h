@@ -0,0 +1,37 @@
+#pragma once
+/**
+ * @file portalAccess.h
+ * @brief Gate for the provisioning portal's routes (pages, POST /save, status).
+ *
+ * The portal routes are registered on the same Ws server that serves normal operation,
+ * and that server also listens on the station interface. A request is only served
+ * while a portal is open (first boot or the temporary AP) and only when it arrived
+ * through the SoftAP, so nobody on the home network can push credentials.
+ */
+
+#include <Arduino.h>
+
+class PortalAccess
+{
+public:
+    enum class Mode : uint8_t
+    {
+        Closed,
+        FirstBoot, // Provisioning::start() .. stop()
+        Temporary  // Provisioning::startTemporaryAp() .. expiry / stopTemporaryAp()
+    };
+
+    void open(Mode mode) { mode_ = mode; }
+    void close() { mode_ = Mode::Closed; }
+    Mode mode() const { return mode_; }
+    bool isOpen() const { return mode_ != Mode::Closed; }
+
+    // `localIp`: the address the client connected to; `softApIp`: WiFi.softAPIP()
+    bool allows(const IPAddress &localIp, const IPAddress &softApIp) const
+    {
+        return isOpen() && (uint32_t)softApIp != 0 && (uint32_t)localIp == (uint32_t)softApIp;
+    }
+
+private:
+    Mode mode_ = Mode::Closed;
+};
@@ -0,0 +1,324 @@
+/**
+ * @file powerManager.cpp
+ * @brief Idle handling, light/deep sleep entry and per-state time accounting.
+ */
+
+#include "powerManager.h"
+
+#include <WiFi.h>
+#include <sys/time.h>
+#include "esp_attr.h"
+#include "esp_idf_version.h"
+#include "esp_pm.h"
+#include "driver/gpio.h"
+#include "driver/rtc_io.h"
+#include "driver/uart.h"
+#include "Logger.h"
+#include "system.h"
+#include "config.h"
+#include "ws.h"
+
+constexpr uint32_t PowerManager::ACTIVITY_HOLD_MS;
+constexpr uint32_t PowerManager::BUSY_MAX_DELAY_MS;
+constexpr uint32_t PowerManager::IDLE_MAX_DELAY_MS;
+constexpr uint32_t PowerManager::MIN_LIGHT_SLEEP_MS;
+
+namespace
+{
+    constexpr uint32_t RTC_MAGIC = 0x50574D47; // "PWMG"
+
+    // Kept in RTC slow memory across deep sleep; re-initialised after power loss
+    struct RtcPowerState
+    {
+        uint32_t magic;
+        uint32_t bootCount;
+        uint32_t deepSleepCount;
+        uint64_t activeMs;     // previous boots
+        uint64_t lightSleepMs; // previous boots
+        uint64_t deepSleepMs;
+        int64_t sleepEnterUs; // gettimeofday() at deep sleep entry, 0 = not sleeping
+        uint32_t autoIdleMs;
+        uint32_t autoSleepMs;
+    };
+    RTC_DATA_ATTR RtcPowerState rtcPower;
+
+    // gettimeofday() keeps counting on the RTC timer through deep sleep
+    int64_t rtcTimeUs()
+    {
+        struct timeval tv;
+        gettimeofday(&tv, nullptr);
+        return (int64_t)tv.tv_sec * 1000000LL + tv.tv_usec;
+    }
+}
+
+PowerManager &PowerManager::instance()
+{
+    static PowerManager inst;
+    return inst;
+}
+
+PowerManager::PowerManager()
+    : wakeLocks_(0), lastActivityMs_(0), idleSinceMs_(0), lightSleepUs_(0),
+      wakeCause_(ESP_SLEEP_WAKEUP_UNDEFINED), lastDeepSleepMs_(0), autoLightSleep_(false)
+{
+}
+
+void PowerManager::begin()
+{
+    wakeCause_ = esp_sleep_get_wakeup_cause();
+
+    if (rtcPower.magic != RTC_MAGIC)
+    {
+        memset(&rtcPower, 0, sizeof(rtcPower));
+        rtcPower.magic = RTC_MAGIC;
+    }
+    rtcPower.bootCount++;
+
+    if (System::instance().resetReasonCode() == ESP_RST_DEEPSLEEP && rtcPower.sleepEnterUs != 0)
+    {
+        const int64_t slept = rtcTimeUs() - rtcPower.sleepEnterUs;
+        if (slept > 0)
+        {
+            lastDeepSleepMs_ = (uint32_t)(slept / 1000);
+            rtcPower.deepSleepMs += lastDeepSleepMs_;
+        }
+    }
+    rtcPower.sleepEnterUs = 0;
+
+    // Woken by a person or the heater: do not go straight back to sleep
+    if (wakeCause_ == ESP_SLEEP_WAKEUP_EXT0 || wakeCause_ == ESP_SLEEP_WAKEUP_EXT1)
+        noteActivity();
+
+#if CONFIG_PM_ENABLE
+#if ESP_IDF_VERSION_MAJOR >= 5
+    esp_pm_config_t pm = {};
+#else
+    esp_pm_config_esp32s3_t pm = {};
+#endif
+    pm.max_freq_mhz = 240;
+    pm.min_freq_mhz = 80;
+    pm.light_sleep_enable = true;
+    esp_err_t err = esp_pm_configure(&pm);
+    if (err != ESP_OK)
+    {
+        // No tickless idle in this build: keep frequency scaling, sleep explicitly instead
+        pm.light_sleep_enable = false;
+        err = esp_pm_configure(&pm);
+    }
+    else
+    {
+        autoLightSleep_ = true;
+    }
+    if (err != ESP_OK)
+        Logger::instance().debug(String("PowerManager: esp_pm_configure failed: ") + String((int)err));
+#endif
+
+    configureLightSleepWake();
+
+    Logger::instance().info(String("PowerManager: boot #") + String(rtcPower.bootCount) + ", wake " +
+                            wakeCauseToString(wakeCause_) +
+                            (lastDeepSleepMs_ ? String(" after ") + String(lastDeepSleepMs_) + " ms deep sleep" : String("")) +
+                            ", auto light sleep " + (autoLightSleep_ ? "on" : "off"));
+}
+
+void PowerManager::configureLightSleepWake()
+{
+    // Level wake-ups stay armed for both automatic and explicit light sleep
+    gpio_wakeup_enable((gpio_num_t)BOOT_BUTTON_PIN, GPIO_INTR_LOW_LEVEL);
+    if (HEATER_UART_RX_PIN >= 0)
+        gpio_wakeup_enable((gpio_num_t)HEATER_UART_RX_PIN, GPIO_INTR_LOW_LEVEL);
+    esp_sleep_enable_gpio_wakeup();
+
+    // Console: wake after a few edges on UART0 RX
+    uart_set_wakeup_threshold(UART_NUM_0, 3);
+    esp_sleep_enable_uart_wakeup(UART_NUM_0);
+}
+
+void PowerManager::acquire(WakeLock lock)
+{
+    wakeLocks_ = wakeLocks_ | (uint8_t)lock;
+}
+
+void PowerManager::release(WakeLock lock)
+{
+    wakeLocks_ = wakeLocks_ & (uint8_t)~(uint8_t)lock;
+}
+
+void PowerManager::noteActivity()
+{
+    lastActivityMs_ = System::instance().monotonicMs();
+}
+
+bool PowerManager::idleAt(uint64_t nowMs) const
+{
+    if (wakeLocks_ != 0)
+        return false;
+    const uint64_t console = lastActivityMs_;
+    if (console != 0 && nowMs - console < ACTIVITY_HOLD_MS)
+        return false;
+    const uint64_t web = Ws::instance().lastActivityMs();
+    return web == 0 || nowMs - web >= ACTIVITY_HOLD_MS;
+}
+
+bool PowerManager::isIdle() const
+{
+    return idleAt(System::instance().monotonicMs());
+}
+
+void PowerManager::idle(uint32_t maxMs)
+{
+    const uint64_t now = System::instance().monotonicMs();
+    const bool idleNow = idleAt(now);
+    if (!idleNow)
+        idleSinceMs_ = 0;
+    else if (idleSinceMs_ == 0)
+        idleSinceMs_ = now;
+
+    if (idleNow && rtcPower.autoIdleMs != 0 && now - idleSinceMs_ >= rtcPower.autoIdleMs)
+        enterDeepSleep(rtcPower.autoSleepMs, "idle");
+
+    const uint32_t cap = idleNow ? IDLE_MAX_DELAY_MS : BUSY_MAX_DELAY_MS;
+    const uint32_t waitMs = maxMs < cap ? maxMs : cap;
+    if (waitMs == 0)
+        return;
+
+    // Explicit light sleep drops the radio, so only use it when WiFi is off anyway;
+    // otherwise delay() blocks the task and esp_pm (if enabled) sleeps automatically.
+    if (idleNow && !autoLightSleep_ && waitMs >= MIN_LIGHT_SLEEP_MS && WiFi.getMode() == WIFI_MODE_NULL)
+        lightSleep(waitMs);
+    else
+        delay(waitMs);
+}
+
+void PowerManager::lightSleep(uint32_t ms)
+{
+    Serial.flush();
+    esp_sleep_enable_timer_wakeup((uint64_t)ms * 1000ULL);
+
+    const int64_t t0 = System::instance().monotonicUs();
+    esp_light_sleep_start();
+    lightSleepUs_ += (uint64_t)(System::instance().monotonicUs() - t0);
+
+    const esp_sleep_wakeup_cause_t cause = esp_sleep_get_wakeup_cause();
+    if (cause == ESP_SLEEP_WAKEUP_GPIO || cause == ESP_SLEEP_WAKEUP_UART)
+        noteActivity();
+}
+
+void PowerManager::enterDeepSleep(uint32_t durationMs, const char *reason)
+{
+    Logger::instance().info(String("PowerManager: deep sleep (") + reason + "), " +
+                            (durationMs ? String(durationMs / 1000) + " s" : String("until woken")));
+
+    // Flush anything the next boot needs
+    Config::instance().forcePersist();
+
+    rtcPower.activeMs = msIn(State::Active);
+    rtcPower.lightSleepMs += lightSleepUs_ / 1000;
+    lightSleepUs_ = 0;
+    rtcPower.deepSleepCount++;
+
+    WiFi.disconnect(true);
+    WiFi.mode(WIFI_OFF);
+
+    esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_ALL);
+    if (durationMs)
+        esp_sleep_enable_timer_wakeup((uint64_t)durationMs * 1000ULL);
+
+    // BOOT button: active low, keep the RTC pull-up powered
+    esp_sleep_pd_config(ESP_PD_DOMAIN_RTC_PERIPH, ESP_PD_OPTION_ON);
+    rtc_gpio_pullup_en((gpio_num_t)BOOT_BUTTON_PIN);
+    rtc_gpio_pulldown_dis((gpio_num_t)BOOT_BUTTON_PIN);
+    esp_sleep_enable_ext0_wakeup((gpio_num_t)BOOT_BUTTON_PIN, 0);
+
+    // Heater UART: a start bit pulls RX low (the first frame is lost)
+    const int rxPin = HEATER_UART_RX_PIN;
+    if (rxPin >= 0 && esp_sleep_is_valid_wakeup_gpio((gpio_num_t)rxPin))
+        esp_sleep_enable_ext1_wakeup(1ULL << (rxPin & 63), ESP_EXT1_WAKEUP_ALL_LOW);
+
+    Serial.flush();
+    rtcPower.sleepEnterUs = rtcTimeUs();
+    esp_deep_sleep_start();
+}
+
+void PowerManager::setAutoDeepSleep(uint32_t idleMs, uint32_t sleepMs)
+{
+    rtcPower.autoIdleMs = idleMs;
+    rtcPower.autoSleepMs = sleepMs;
+    idleSinceMs_ = 0;
+    if (idleMs)
+        Logger::instance().info(String("PowerManager: auto deep sleep after ") + String(idleMs / 1000) + " s idle, for " +
+                                String(sleepMs / 1000) + " s");
+    else
+        Logger::instance().info("PowerManager: auto deep sleep off");
+}
+
+uint32_t PowerManager::autoDeepSleepIdleMs() const
+{
+    return rtcPower.autoIdleMs;
+}
+
+uint32_t PowerManager::autoDeepSleepMs() const
+{
+    return rtcPower.autoSleepMs;
+}
+
+uint64_t PowerManager::msIn(State state) const
+{
+    switch (state)
+    {
+    case State::LightSleep:
+        return rtcPower.lightSleepMs + lightSleepUs_ / 1000;
+    case State::DeepSleep:
+        return rtcPower.deepSleepMs;
+    default:
+    {
+        const uint64_t up = System::instance().getUptime();
+        const uint64_t slept = lightSleepUs_ / 1000;
+        return rtcPower.activeMs + (up > slept ? up - slept : 0);
+    }
+    }
+}
+
+uint32_t PowerManager::bootCount() const
+{
+    return rtcPower.bootCount;
+}
+
+uint32_t PowerManager::deepSleepCount() const
+{
+    return rtcPower.deepSleepCount;
+}
+
+const char *PowerManager::stateToString(State s)
+{
+    switch (s)
+    {
+    case State::LightSleep:
+        return "light-sleep";
+    case State::DeepSleep:
+        return "deep-sleep";
+    default:
+        return "active";
+    }
+}
+
+const char *PowerManager::wakeCauseToString(esp_sleep_wakeup_cause_t cause)
+{
+    switch (cause)
+    {
+    case ESP_SLEEP_WAKEUP_EXT0:
+        return "button";
+    case ESP_SLEEP_WAKEUP_EXT1:
+        return "heater-uart";
+    case ESP_SLEEP_WAKEUP_TIMER:
+        return "timer";
+    case ESP_SLEEP_WAKEUP_GPIO:
+        return "gpio";
+    case ESP_SLEEP_WAKEUP_UART:
+        return "uart";
+    case ESP_SLEEP_WAKEUP_UNDEFINED:
+        return "reset";
+    default:
+        return "other";
+    }
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <Arduino.h>
+#include "esp_sleep.h"
+
+/**
+ * @file powerManager.h
+ * @brief Singleton that idles the service loop and drives light/deep sleep with wake sources.
+ *
+ * Power states:
+ *  - Active: running. When esp_pm supports it (CONFIG_PM_ENABLE with tickless idle) the CPU
+ *    is frequency-scaled and the chip enters automatic light sleep whenever all tasks are
+ *    blocked, keeping the WiFi association through modem sleep (see LinkMonitor).
+ *  - LightSleep: explicit esp_light_sleep_start() while the radio is off. Wakes on the next
+ *    timer, the BOOT button, console UART or heater UART activity (the waking UART bytes
+ *    are lost).
+ *  - DeepSleep: enterDeepSleep(). Wakes on a timer, the BOOT button (ext0) or heater UART RX
+ *    going low (ext1). Counters and the sleep start time live in RTC memory, so the next
+ *    boot accounts the time slept and TimeSync keeps the wall clock.
+ *
+ * The device is idle when no wake lock is held and nobody used the console or the web
+ * server for ACTIVITY_HOLD_MS. idle() replaces the service loop's delay: it waits up to the next
+ * System timer, capped at BUSY_MAX_DELAY_MS while busy and IDLE_MAX_DELAY_MS while idle.
+ * With setAutoDeepSleep() the device deep-sleeps after a stretch of idleness and wakes
+ * periodically (or early on button / heater UART).
+ *
+ * Explicit light sleep halts both cores, including the control task; it only happens
+ * while no wake lock is held (the heater holds WakeLock::Heater while it runs).
+ *
+ * Service task only, except acquire()/release()/noteActivity() which only touch flags.
+ */
+class PowerManager
+{
+public:
+    // Reasons to stay out of sleep (bit flags)
+    enum class WakeLock : uint8_t
+    {
+        Heater = 1 << 0,       // heater running or controller busy
+        Provisioning = 1 << 1, // provisioning / temporary AP up
+        Ota = 1 << 2,          // firmware update in progress
+        User = 1 << 3          // held from the console ("power stay on")
+    };
+
+    enum class State : uint8_t
+    {
+        Active,
+        LightSleep,
+        DeepSleep
+    };
+
+    static PowerManager &instance();
+
+    // Call early in setup(): restores RTC state, accounts the last deep sleep, configures esp_pm
+    void begin();
+
+    // Wait for at most maxMs (typically System::msUntilNextTimer()); may light- or deep-sleep
+    void idle(uint32_t maxMs);
+
+    void acquire(WakeLock lock);
+    void release(WakeLock lock);
+    uint8_t wakeLocks() const { return wakeLocks_; }
+
+    // Record user activity (console input etc.) that should keep the device awake
+    void noteActivity();
+    bool isIdle() const;
+
+    // Enter deep sleep; durationMs 0 = until button / heater UART. Does not return.
+    void enterDeepSleep(uint32_t durationMs, const char *reason);
+
+    // Deep sleep for sleepMs after idleMs of idleness; idleMs 0 disables. Kept across deep sleep.
+    void setAutoDeepSleep(uint32_t idleMs, uint32_t sleepMs);
+    uint32_t autoDeepSleepIdleMs() const;
+    uint32_t autoDeepSleepMs() const;
+
+    // Time spent in each state since power-on (Active includes automatic light sleep)
+    uint64_t msIn(State state) const;
+    uint32_t bootCount() const;
+    uint32_t deepSleepCount() const;
+    uint32_t lastDeepSleepMs() const { return lastDeepSleepMs_; }
+    esp_sleep_wakeup_cause_t wakeCause() const { return wakeCause_; }
+    bool autoLightSleep() const { return autoLightSleep_; }
+
+    static const char *stateToString(State s);
+    static const char *wakeCauseToString(esp_sleep_wakeup_cause_t cause);
+
+    static constexpr uint32_t ACTIVITY_HOLD_MS = 60000;
+    static constexpr uint32_t BUSY_MAX_DELAY_MS = 10;
+    static constexpr uint32_t IDLE_MAX_DELAY_MS = 100;
+    static constexpr uint32_t MIN_LIGHT_SLEEP_MS = 20; // shorter waits are not worth the wake-up cost
+
+private:
+    PowerManager();
+    ~PowerManager() = default;
+    PowerManager(const PowerManager &) = delete;
+    PowerManager &operator=(const PowerManager &) = delete;
+
+    bool idleAt(uint64_t nowMs) const;
+    void lightSleep(uint32_t ms);
+    void configureLightSleepWake();
+
+    volatile uint8_t wakeLocks_;
+    volatile uint64_t lastActivityMs_; // System::monotonicMs(), 0 = none
+    uint64_t idleSinceMs_;             // 0 = not idle
+    uint64_t lightSleepUs_;            // this boot
+    esp_sleep_wakeup_cause_t wakeCause_;
+    uint32_t lastDeepSleepMs_;
+    bool autoLightSleep_;
+};
@@ -1,18 +1,47 @@
 #include "provisioning.h"
 
-#include <DNSServer.h>
+#include <ArduinoJson.h>
 #include "Logger.h"
 #include "networkController.h"
-#include "System.h"
+#include "system.h"
 #include "esp_system.h"
 #include "multicaseDns.h"
 #include "ws.h"
+#include "webApi.h"
 #include "onBoardLed.h"
 #include "displayManager.h"
+#include "powerManager.h"
+#include "captiveDns.h"
+#include "bleProvisioning.h"
+#include "provisioningPage.h"
+#include "esp_random.h"
 
-constexpr uint16_t Provisioning::DNS_PORT;
 constexpr uint32_t Provisioning::FACTORY_RESET_HOLD_MS;
-constexpr int Provisioning::BOOT_BUTTON_PIN;
+constexpr uint32_t Provisioning::TEMP_AP_DEFAULT_MS;
+constexpr uint32_t Provisioning::HANDOFF_DELAY_MS;
+constexpr uint32_t Provisioning::BUNDLE_HANDOFF_MS;
+
+namespace
+{
+    // BLE proof-of-possession code; no 0/O or 1/I so it reads unambiguously off the display
+    String makePop()
+    {
+        static const char alphabet[] = "ABCDEFGHJKLMNPQRSTUVWXYZ23456789";
+        char code[9];
+        for (size_t i = 0; i < 8; ++i)
+            code[i] = alphabet[esp_random() % (sizeof(alphabet) - 1)];
+        code[8] = '\0';
+        return String(code);
+    }
+
+    // Second status line while waiting for credentials
+    String waitingLine()
+    {
+        if (BleProvisioning::instance().running())
+            return String("BLE code ") + BleProvisioning::instance().pop();
+        return "AP mode started";
+    }
+}
 
 Provisioning &Provisioning::instance()
 {
@@ -82,47 +111,22 @@ bool Provisioning::start()
     MulticaseDns::instance().addService("http", "tcp", 80);
     MulticaseDns::instance().addServiceTxt("http", "tcp", "path", "/index.html");
 
-    // Captive DNS
-    dnsServer_.start(DNS_PORT, "*", ip);
+    // Captive DNS (own task)
+    CaptiveDns::instance().start(ip);
 
     // Web server
     Ws::instance().begin(80);
+    WebApi::instance().registerRoutes();
 
-    // Captive-portal probes: return quickly to avoid error noise
-    Ws::instance().onRaw("/connecttest.txt", HTTP_GET, [](WebServer &srv)
-                         { srv.send(200, "text/plain", "OK"); });
-    Ws::instance().onRaw("/generate_204", HTTP_GET, [](WebServer &srv)
-                         { srv.send(204, "text/plain", ""); });
-    Ws::instance().onRaw("/hotspot-detect.html", HTTP_GET, [](WebServer &srv)
-                         { srv.send(200, "text/html", "<html><body>OK</body></html>"); });
-
-    // Static content
-    Ws::instance().serveStatic("/", "/provisioning/index.html");
-    Ws::instance().serveStatic("/*", "/provisioning/*");
-
-    // Handle provisioning POST; send response, then tear down after
-    Ws::instance().onRaw("/save", HTTP_POST, [this](WebServer &srv)
-                         {
-                             String ssid = srv.arg("ssid");
-                             String password = srv.arg("password");
-                             String deviceName = srv.arg("deviceName");
-
-                             if (ssid.length() == 0)
-                             {
-                                 srv.send(400, "text/plain", "Missing ssid");
-                                 return;
-                             }
-
-                             this->provision(ssid, password, deviceName);
-                             srv.send(200, "text/plain", "Saved. Rebooting...");
-
-                             // Defer teardown to avoid tearing down server mid-response.
-                             // Set a flag and handle in provisioningLoop().
-                             pendingReboot_ = true;
-                             rebootAtMs_ = millis() + 500; // 0.5s delay
-                         });
+    registerPortalRoutes();
 
+    // BLE next to the portal, same name as the AP; the code on the display is the PoP
+    if (BleProvisioning::compiledIn() && BleProvisioning::instance().start(apName, makePop()))
+        DisplayManager::instance().showStatus("Provisioning", waitingLine());
+
+    access_.open(PortalAccess::Mode::FirstBoot);
     Logger::instance().info(String("Provisioning: AP running, IP=") + ip.toString());
+    PowerManager::instance().acquire(PowerManager::WakeLock::Provisioning);
 
     // Show AP name and the provisioning URL on the display if available.
     // Keep the top two lines for the generic provisioning message and
@@ -132,6 +136,247 @@ bool Provisioning::start()
     return true;
 }
 
+/**
+ * Captive-portal probes, static pages and /save. Registered once per portal on the
+ * shared Ws server and only answered through the SoftAP while that portal is open
+ * (see PortalAccess); the temporary AP retires them again when it closes.
+ */
+void Provisioning::registerPortalRoutes()
+{
+    if (portalRoutesRegistered_)
+        return;
+    portalRoutesRegistered_ = true;
+
+    // Captive-portal probes: return quickly to avoid error noise
+    portalRoute("/connecttest.txt", HTTP_GET, [](WebServer &srv)
+                { srv.send(200, "text/plain", "OK"); });
+    portalRoute("/generate_204", HTTP_GET, [](WebServer &srv)
+                { srv.send(204, "text/plain", ""); });
+    portalRoute("/hotspot-detect.html", HTTP_GET, [](WebServer &srv)
+                { srv.send(200, "text/html", "<html><body>OK</body></html>"); });
+
+    // The page (web/provisioning, built by scripts/build_web.py) is one gzipped response from
+    // flash. Its URI does not change with the firmware: no-cache, revalidated by ETag (304)
+    for (const char *uri : {"/", "/index.html"})
+        portalRoutes_.push_back(Ws::instance().serveEmbedded(uri, "text/html; charset=utf-8", ProvisioningPage::GZ,
+                                                             ProvisioningPage::GZ_SIZE, ProvisioningPage::ETAG, 0,
+                                                             [this](WebServer &srv)
+                                                             { return portalRequestAllowed(srv); }));
+
+    // Credentials are tried live; the page follows the trial through /api/provision/status
+    portalRoute("/save", HTTP_POST, [this](WebServer &srv)
+                {
+                    String ssid = srv.arg("ssid");
+                    String password = srv.arg("password");
+                    String deviceName = srv.arg("deviceName");
+
+                    if (ssid.length() == 0)
+                    {
+                        srv.send(400, "text/plain", "Missing ssid");
+                        return;
+                    }
+                    if (!this->tryCredentials(ssid, password, deviceName))
+                    {
+                        srv.send(409, "text/plain", "A connection test is already running");
+                        return;
+                    }
+                    srv.send(202, "application/json", this->statusJson()); });
+
+    portalRoute("/api/provision/status", HTTP_GET, [this](WebServer &srv)
+                {
+                    srv.sendHeader("Cache-Control", "no-store");
+                    srv.send(200, "application/json", this->statusJson()); });
+}
+
+// Register one portal route behind the PortalAccess check
+void Provisioning::portalRoute(const char *uri, HTTPMethod method, std::function<void(WebServer &)> handler)
+{
+    portalRoutes_.push_back(Ws::instance().onRaw(uri, method, [this, handler](WebServer &srv)
+                                                 {
+                                                     if (!portalRequestAllowed(srv))
+                                                     {
+                                                         Logger::instance().warn(String("Provisioning: refused ") + srv.uri() +
+                                                                                 " from " + srv.client().remoteIP().toString());
+                                                         srv.send(403, "text/plain", "Forbidden");
+                                                         return;
+                                                     }
+                                                     handler(srv); }));
+}
+
+bool Provisioning::portalRequestAllowed(WebServer &srv) const
+{
+    return access_.allows(srv.client().localIP(), WiFi.softAPIP());
+}
+
+void Provisioning::unregisterPortalRoutes()
+{
+    for (Ws::RouteId id : portalRoutes_)
+        Ws::instance().removeRoute(id);
+    portalRoutes_.clear();
+    portalRoutesRegistered_ = false;
+}
+
+bool Provisioning::startTemporaryAp(uint32_t durationMs)
+{
+    if (!isProvisioned())
+    {
+        Logger::instance().warn("Provisioning: not provisioned; use start() instead of a temporary AP");
+        return false;
+    }
+
+    const String apName = String("Heater-") + macSuffixHex();
+    TimerWheel &timers = System::instance().timers();
+    timers.cancel(tempApTimer_);
+    tempApTimer_ = timers.schedule(durationMs, [this]
+                                   {
+                                       tempApTimer_ = 0;
+                                       stopTemporaryAp(); });
+    if (temporaryApActive())
+    {
+        Logger::instance().info("Provisioning: temporary AP extended");
+        return true;
+    }
+
+    NetworkController::instance().startAPMode(apName);
+    IPAddress ip = WiFi.softAPIP();
+    if (ip == IPAddress(0, 0, 0, 0))
+    {
+        Logger::instance().error("Provisioning: failed to start temporary AP");
+        return false;
+    }
+
+    CaptiveDns::instance().start(ip);
+    Ws::instance().begin(80);
+    registerPortalRoutes();
+    access_.open(PortalAccess::Mode::Temporary);
+    PowerManager::instance().acquire(PowerManager::WakeLock::Provisioning);
+
+    Logger::instance().info(String("Provisioning: temporary AP '") + apName + "' up for " +
+                            String(durationMs / 1000) + " s, IP=" + ip.toString());
+    DisplayManager::instance().post(DisplayManager::Severity::Info, apName, String("http://") + ip.toString(), durationMs);
+    return true;
+}
+
+void Provisioning::stopTemporaryAp()
+{
+    if (!temporaryApActive())
+        return;
+    // Close the gate first: the server keeps running for normal operation
+    access_.close();
+    unregisterPortalRoutes();
+    PowerManager::instance().release(PowerManager::WakeLock::Provisioning);
+    System::instance().timers().cancel(tempApTimer_);
+    tempApTimer_ = 0;
+    CaptiveDns::instance().stop();
+    NetworkController::instance().stopAPMode();
+    Logger::instance().info("Provisioning: temporary AP stopped");
+}
+
+/**
+ * Try new credentials on the live station (AP+STA; the AP follows the station's
+ * channel while it associates). Nothing is persisted until the device got an IP.
+ */
+bool Provisioning::tryCredentials(const String &ssid, const String &password, const String &deviceName)
+{
+    if (phase_ == Phase::Testing || handoffTimer_ != 0)
+        return false;
+
+    const bool started = NetworkController::instance().beginTrial(ssid, password, [this, ssid, password, deviceName](bool ok)
+                                                                  { onTrialResult(ok, ssid, password, deviceName); });
+    if (!started)
+    {
+        Logger::instance().warn("Provisioning: a WiFi trial is already running");
+        return false;
+    }
+
+    phase_ = Phase::Testing;
+    trialSsid_ = ssid;
+    trialStartMs_ = System::instance().monotonicMs();
+    trialMs_ = 0;
+    failReason_ = 0;
+    DisplayManager::instance().showStatus("Testing WiFi", ssid);
+    return true;
+}
+
+void Provisioning::onTrialResult(bool ok, const String &ssid, const String &password, const String &deviceName)
+{
+    trialMs_ = (uint32_t)(System::instance().monotonicMs() - trialStartMs_);
+    const bool firstBoot = !isProvisioned();
+
+    if (!ok)
+    {
+        phase_ = Phase::Failed;
+        failReason_ = NetworkController::instance().metrics().lastDisconnectReason;
+        Logger::instance().warn(String("Provisioning: \"") + ssid + "\" failed after " + String(trialMs_) +
+                                " ms (reason " + String(failReason_) + "); portal stays up");
+        // First boot: drop the station again so the AP is back on its own channel
+        if (firstBoot)
+        {
+            NetworkController::instance().disconnectFromWiFi();
+            DisplayManager::instance().showStatus("Provisioning", waitingLine());
+        }
+        DisplayManager::instance().post(DisplayManager::Severity::Warning, "WiFi trial failed", ssid, 5000);
+        return;
+    }
+
+    phase_ = Phase::Connected;
+    Logger::instance().info(String("Provisioning: \"") + ssid + "\" connected in " + String(trialMs_) + " ms, IP=" +
+                            WiFi.localIP().toString());
+
+    if (!firstBoot)
+    {
+        // Temporary AP on a provisioned device: the new network becomes the primary one
+        Config::instance().promoteNetwork(ssid, password);
+        if (deviceName.length() > 0)
+            Config::instance().setDeviceName(deviceName);
+        Config::instance().forcePersist();
+        DisplayManager::instance().post(DisplayManager::Severity::Info, "WiFi switched", ssid, 5000);
+        return;
+    }
+
+    provision(ssid, password, deviceName);
+    DisplayManager::instance().showStatus("WiFi connected", WiFi.localIP().toString());
+
+    // Leave the portal up long enough for the page to poll the result and new address
+    System::instance().timers().cancel(handoffTimer_);
+    handoffTimer_ = System::instance().timers().schedule(HANDOFF_DELAY_MS, [this]
+                                                         {
+                                                             handoffTimer_ = 0;
+                                                             handOff(); });
+}
+
+void Provisioning::adoptConfiguration()
+{
+    if (access_.mode() != PortalAccess::Mode::FirstBoot || !isProvisioned() || phase_ == Phase::Testing ||
+        handoffTimer_ != 0)
+        return;
+    Logger::instance().info("Provisioning: configuration received as a bundle; closing the portal");
+    DisplayManager::instance().showStatus("Bundle applied", Config::instance().getSsid());
+    handoffTimer_ = System::instance().timers().schedule(BUNDLE_HANDOFF_MS, [this]
+                                                         {
+                                                             handoffTimer_ = 0;
+                                                             handOff(); });
+}
+
+/**
+ * Tear the portal down (Ws, DNS, mDNS, AP; the station stays connected) and hand over
+ * to normal operation in-process. Falls back to a reboot without an onProvisioned() hook.
+ */
+void Provisioning::handOff()
+{
+    stop();
+    phase_ = Phase::Idle;
+
+    if (!provisionedCallback_)
+    {
+        Logger::instance().info("Provisioning: no handoff registered, rebooting");
+        System::instance().reboot();
+        return;
+    }
+    Logger::instance().info("Provisioning: portal closed, starting normal operation");
+    provisionedCallback_();
+}
+
 void Provisioning::provision(const String &ssid, const String &password, const String &deviceName)
 {
     if (ssid.length() == 0)
@@ -155,48 +400,40 @@ void Provisioning::provision(const String &ssid, const String &password, const S
 
 void Provisioning::provisioningLoop()
 {
-    // Always monitor factory reset button
+    // Always monitor factory reset button; captive DNS answers on its own task
     checkFactoryResetButton();
-
-    // Process captive DNS only while not provisioned
-    if (!isProvisioned())
-    {
-        dnsServer_.processNextRequest();
-    }
-
-    // If a reboot was requested, perform it after delay
-    if (pendingReboot_ && millis() >= rebootAtMs_)
-    {
-        pendingReboot_ = false;
-        stop();
-        System::instance().reboot();
-    }
+    BleProvisioning::instance().loop();
 }
 
 void Provisioning::stop()
 {
     Logger::instance().info("Provisioning: stopping");
+    access_.close();
+    PowerManager::instance().release(PowerManager::WakeLock::Provisioning);
 
-    // Stop services first
+    // Stop services first (portal routes go with the server)
     Ws::instance().stop();
-    dnsServer_.stop();
+    portalRoutesRegistered_ = false;
+    portalRoutes_.clear();
+    CaptiveDns::instance().stop();
     MulticaseDns::instance().stop();
+    BleProvisioning::instance().stop();
 
-    // Tear down AP, then switch to STA (avoid WIFI_MODE_NULL which can trigger netstack issues)
+    // Tear down AP, then switch to STA (avoid WIFI_MODE_NULL which can trigger netstack issues);
+    // a connected station is left alone
     NetworkController::instance().stopAPMode();
     WiFi.softAPdisconnect(true);
     WiFi.mode(WIFI_STA);
 
     delay(20);
 
-    IPAddress ip = NetworkController::instance().ipAddress();
-    if (ip == IPAddress(0, 0, 0, 0))
+    if (WiFi.getMode() & WIFI_MODE_AP)
     {
-        Logger::instance().debug("Provisioning: soft AP stopped");
+        Logger::instance().warn(String("Provisioning: soft AP still present, IP=") + WiFi.softAPIP().toString());
     }
     else
     {
-        Logger::instance().warn(String("Provisioning: soft AP still present, IP=") + ip.toString());
+        Logger::instance().debug("Provisioning: soft AP stopped");
     }
 }
 
@@ -221,6 +458,7 @@ void Provisioning::reset()
 
     Config::instance().setSsid(String());
     Config::instance().setPassword(String());
+    Config::instance().clearNetworks();
     Config::instance().setDeviceName(Config::DEFAULT_DEVICE_NAME);
     Config::instance().forcePersist();
 
@@ -235,7 +473,7 @@ void Provisioning::checkFactoryResetButton()
     {
         // Button just pressed
         buttonPressed_ = true;
-        buttonPressStartMs_ = millis();
+        buttonPressStartMs_ = System::instance().monotonicMs();
         Logger::instance().debug("Provisioning: boot button pressed, hold for factory reset");
     }
     else if (!currentState && buttonPressed_)
@@ -247,7 +485,7 @@ void Provisioning::checkFactoryResetButton()
     else if (currentState && buttonPressed_)
     {
         // Button still held - check if 10s elapsed
-        uint32_t elapsed = millis() - buttonPressStartMs_;
+        uint64_t elapsed = System::instance().monotonicMs() - buttonPressStartMs_;
         if (elapsed >= FACTORY_RESET_HOLD_MS)
         {
             Logger::instance().warn("Provisioning: factory reset triggered");
@@ -264,4 +502,50 @@ String Provisioning::macSuffixHex() const
     char buf[5];
     snprintf(buf, sizeof(buf), "%02X%02X", mac[4], mac[5]);
     return String(buf);
-}
\ No newline at end of file
+}
+
+const char *Provisioning::phaseToString(Phase p)
+{
+    switch (p)
+    {
+    case Phase::Idle:
+        return "idle";
+    case Phase::Testing:
+        return "testing";
+    case Phase::Connected:
+        return "connected";
+    case Phase::Failed:
+        return "failed";
+    }
+    return "unknown";
+}
+
+String Provisioning::statusJson() const
+{
+    StaticJsonDocument<384> doc;
+    doc["phase"] = phaseToString(phase_);
+    if (trialSsid_.length() > 0)
+        doc["ssid"] = trialSsid_;
+    switch (phase_)
+    {
+    case Phase::Testing:
+        doc["elapsedMs"] = (uint32_t)(System::instance().monotonicMs() - trialStartMs_);
+        doc["state"] = NetworkController::stateToString(NetworkController::instance().state());
+        break;
+    case Phase::Connected:
+        doc["elapsedMs"] = trialMs_;
+        doc["ip"] = WiFi.localIP().toString();
+        doc["hostname"] = Config::instance().getDeviceName();
+        doc["handoffMs"] = HANDOFF_DELAY_MS;
+        break;
+    case Phase::Failed:
+        doc["elapsedMs"] = trialMs_;
+        doc["reason"] = failReason_;
+        break;
+    default:
+        break;
+    }
+    String body;
+    serializeJson(doc, body);
+    return body;
+}
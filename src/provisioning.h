@@ -1,9 +1,13 @@
 #pragma once
 
 #include <Arduino.h>
-#include <DNSServer.h>
+#include <functional>
 #include "fileSystem.h"
 #include "config.h"
+#include "timerWheel.h"
+#include "portalAccess.h"
+#include "ws.h"
+#include <vector>
 
 class Provisioning
 {
@@ -17,24 +21,78 @@ public:
     void reset();
     void checkFactoryResetButton();
 
+    // Temporary provisioning AP next to the running station (AP+STA) on a provisioned
+    // device. Credentials saved through it are tried live and adopted without a reboot.
+    bool startTemporaryAp(uint32_t durationMs = TEMP_AP_DEFAULT_MS);
+    void stopTemporaryAp();
+    bool temporaryApActive() const { return access_.mode() == PortalAccess::Mode::Temporary; }
+
+    static constexpr uint32_t TEMP_AP_DEFAULT_MS = 10UL * 60UL * 1000UL;
+
+    /**
+     * Progress of the credentials submitted through the portal or BLE:
+     *   Idle -> Testing -> Connected -> (HANDOFF_DELAY_MS) portal torn down, onProvisioned()
+     *              |
+     *              +-> Failed (station dropped, portal stays up for another try)
+     * Served as JSON at GET /api/provision/status so the page can follow it.
+     */
+    enum class Phase : uint8_t
+    {
+        Idle,
+        Testing,
+        Connected,
+        Failed
+    };
+
+    // Called (service task) once first-boot provisioning succeeded and the portal is
+    // gone: bring up normal operation. Without one the device reboots instead.
+    void onProvisioned(std::function<void()> cb) { provisionedCallback_ = cb; }
+
+    Phase phase() const { return phase_; }
+    uint8_t failReason() const { return failReason_; }
+    static const char *phaseToString(Phase p);
+    String statusJson() const;
+
+    // Start a live trial of new credentials (portal /save, BLE). False while one runs.
+    bool tryCredentials(const String &ssid, const String &password, const String &deviceName);
+
+    // Configuration arrived complete (signed bundle): on first boot, close the portal
+    // and start normal operation with it. No-op otherwise.
+    void adoptConfiguration();
+
+    static constexpr uint32_t HANDOFF_DELAY_MS = 8000;
+    static constexpr uint32_t BUNDLE_HANDOFF_MS = 1000; // lets the HTTP/console reply go out first
+
 private:
     Provisioning();
     ~Provisioning();
 
     String macSuffixHex() const;
+    void registerPortalRoutes();
+    void unregisterPortalRoutes();
+    void portalRoute(const char *uri, HTTPMethod method, std::function<void(WebServer &)> handler);
+    bool portalRequestAllowed(WebServer &srv) const;
+    void onTrialResult(bool ok, const String &ssid, const String &password, const String &deviceName);
+    void handOff();
 
     uint32_t configCbId_;
 
-    DNSServer dnsServer_;
-    static constexpr uint16_t DNS_PORT = 53;
-
     // Factory reset state tracking
     bool buttonPressed_;
-    uint32_t buttonPressStartMs_;
+    uint64_t buttonPressStartMs_;
     static constexpr uint32_t FACTORY_RESET_HOLD_MS = 10000;
-    static constexpr int BOOT_BUTTON_PIN = 0;
 
-    // Reboot scheduling after successful POST /save
-    bool pendingReboot_ = false;
-    uint32_t rebootAtMs_ = 0;
+    // Live trial of the credentials from POST /save, and the deferred handoff after it
+    Phase phase_ = Phase::Idle;
+    String trialSsid_;
+    uint64_t trialStartMs_ = 0;
+    uint32_t trialMs_ = 0;      // duration of the last finished trial
+    uint8_t failReason_ = 0;    // wifi_err_reason_t of a failed trial
+    TimerWheel::TimerId handoffTimer_ = 0;
+    std::function<void()> provisionedCallback_;
+
+    PortalAccess access_; // which portal is open; portal routes refuse requests otherwise
+    bool portalRoutesRegistered_ = false;
+    std::vector<Ws::RouteId> portalRoutes_;
+    TimerWheel::TimerId tempApTimer_ = 0; // expiry of the temporary AP
 };
\ No newline at end of file
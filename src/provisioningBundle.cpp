@@ -0,0 +1,279 @@
+/**
+ * @file provisioningBundle.cpp
+ * @brief Signature check, validation and atomic apply of signed provisioning bundles.
+ */
+
+#include "provisioningBundle.h"
+
+#include <ArduinoJson.h>
+#include <LittleFS.h>
+#include <memory>
+#include <new>
+#include "esp_system.h"
+#include "mbedtls/base64.h"
+#include "mbedtls/md.h"
+#include "mbedtls/pk.h"
+#include "Logger.h"
+#include "config.h"
+#include "fileSystem.h"
+#include "memoryPool.h"
+#include "provisioning.h"
+#include "bundleKey.h"
+
+constexpr const char *ProvisioningBundle::DROP_PATH;
+constexpr size_t ProvisioningBundle::MAX_PAYLOAD;
+constexpr size_t ProvisioningBundle::MAX_SIGNATURE;
+
+namespace
+{
+    constexpr size_t MAX_SSID = 32;
+    constexpr size_t MIN_PASSPHRASE = 8;
+    constexpr size_t MAX_PASSPHRASE = 64;
+    constexpr size_t MAX_DEVICE_NAME = 32;
+
+    MemoryAccounting::ModuleId jsonModule()
+    {
+        static const MemoryAccounting::ModuleId id = MemoryAccounting::instance().registerModule("bundle");
+        return id;
+    }
+
+    bool decodeBase64(const String &in, uint8_t *out, size_t outSize, size_t &outLen)
+    {
+        return in.length() > 0 &&
+               mbedtls_base64_decode(out, outSize, &outLen, reinterpret_cast<const unsigned char *>(in.c_str()),
+                                     in.length()) == 0;
+    }
+
+    bool validDeviceName(const String &name)
+    {
+        if (name.length() == 0 || name.length() > MAX_DEVICE_NAME)
+            return false;
+        for (size_t i = 0; i < name.length(); ++i)
+        {
+            const char c = name.charAt(i);
+            if (!isalnum((unsigned char)c) && c != '-' && c != '_')
+                return false;
+        }
+        return true;
+    }
+}
+
+ProvisioningBundle &ProvisioningBundle::instance()
+{
+    static ProvisioningBundle inst;
+    return inst;
+}
+
+ProvisioningBundle::ProvisioningBundle()
+    : lastResult_(Result::Malformed), lastDetail_(), attempted_(false)
+{
+}
+
+const char *ProvisioningBundle::resultToString(Result r)
+{
+    switch (r)
+    {
+    case Result::Applied:
+        return "applied";
+    case Result::Malformed:
+        return "malformed";
+    case Result::NoKey:
+        return "no key";
+    case Result::BadSignature:
+        return "bad signature";
+    case Result::WrongDevice:
+        return "wrong device";
+    case Result::Stale:
+        return "stale";
+    case Result::Invalid:
+        return "invalid";
+    case Result::StoreFailed:
+        return "store failed";
+    }
+    return "unknown";
+}
+
+bool ProvisioningBundle::keyCompiledIn()
+{
+    return sizeof(BUNDLE_PUBLIC_KEY_PEM) > 1;
+}
+
+String ProvisioningBundle::deviceId() const
+{
+    uint8_t mac[6];
+    esp_read_mac(mac, ESP_MAC_WIFI_STA);
+    char buf[13];
+    snprintf(buf, sizeof(buf), "%02X%02X%02X%02X%02X%02X", mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+    return String(buf);
+}
+
+String ProvisioningBundle::expandName(const String &tmpl, const String &deviceId)
+{
+    String name = tmpl;
+    name.replace("{mac4}", deviceId.substring(deviceId.length() >= 4 ? deviceId.length() - 4 : 0));
+    name.replace("{mac}", deviceId);
+    return name;
+}
+
+/**
+ * ECDSA/SHA-256 check of `payload` against a PEM public key. `pemLen` includes the
+ * terminating NUL (mbedtls wants it for PEM input).
+ */
+bool ProvisioningBundle::verifySignature(const uint8_t *payload, size_t len, const uint8_t *sig, size_t sigLen,
+                                         const char *pem, size_t pemLen)
+{
+    uint8_t hash[32];
+    mbedtls_pk_context pk;
+    mbedtls_pk_init(&pk);
+    const bool ok = mbedtls_pk_parse_public_key(&pk, reinterpret_cast<const unsigned char *>(pem), pemLen) == 0 &&
+                    mbedtls_pk_can_do(&pk, MBEDTLS_PK_ECDSA) &&
+                    mbedtls_md(mbedtls_md_info_from_type(MBEDTLS_MD_SHA256), payload, len, hash) == 0 &&
+                    mbedtls_pk_verify(&pk, MBEDTLS_MD_SHA256, hash, sizeof(hash), sig, sigLen) == 0;
+    mbedtls_pk_free(&pk);
+    return ok;
+}
+
+ProvisioningBundle::Result ProvisioningBundle::applyEnvelope(const String &json)
+{
+    StaticJsonDocument<256> filter;
+    filter["payload"] = true;
+    filter["sig"] = true;
+    // Only the two fields are kept; their strings are copied into the document
+    PooledJsonDocument doc(JSON_OBJECT_SIZE(2) + json.length(), PooledJsonAllocator(jsonModule()));
+    if (deserializeJson(doc, json.c_str(), json.length(), DeserializationOption::Filter(filter)) ||
+        !doc["payload"].is<const char *>() || !doc["sig"].is<const char *>())
+        return finish(Result::Malformed, "expected {\"payload\": ..., \"sig\": ...}");
+    return apply(String(doc["payload"].as<const char *>()), String(doc["sig"].as<const char *>()));
+}
+
+ProvisioningBundle::Result ProvisioningBundle::apply(const String &payloadB64, const String &sigB64)
+{
+    if (!keyCompiledIn())
+        return finish(Result::NoKey, "no public key in bundleKey.h");
+
+    std::unique_ptr<uint8_t[]> payload(new (std::nothrow) uint8_t[MAX_PAYLOAD]);
+    uint8_t sig[MAX_SIGNATURE];
+    size_t payloadLen = 0;
+    size_t sigLen = 0;
+    if (!payload)
+        return finish(Result::Malformed, "out of memory");
+    if (!decodeBase64(payloadB64, payload.get(), MAX_PAYLOAD, payloadLen))
+        return finish(Result::Malformed, "payload is not base64 or larger than " + String(MAX_PAYLOAD) + " bytes");
+    if (!decodeBase64(sigB64, sig, sizeof(sig), sigLen))
+        return finish(Result::Malformed, "signature is not base64");
+
+    if (!verifySignature(payload.get(), payloadLen, sig, sigLen, BUNDLE_PUBLIC_KEY_PEM, sizeof(BUNDLE_PUBLIC_KEY_PEM)))
+        return finish(Result::BadSignature, "not signed with the fleet key");
+    return applyPayload(payload.get(), payloadLen);
+}
+
+/**
+ * Validate everything first, then build one config.json-shaped document and hand it to
+ * Config::applyAndPersist(): nothing changes unless every value is acceptable.
+ */
+ProvisioningBundle::Result ProvisioningBundle::applyPayload(const uint8_t *payload, size_t len)
+{
+    PooledJsonDocument in(MAX_PAYLOAD + 512, PooledJsonAllocator(jsonModule()));
+    if (deserializeJson(in, payload, len) || !in.is<JsonObject>())
+        return finish(Result::Malformed, "payload is not a JSON object");
+    if ((in["v"] | 0) != 1)
+        return finish(Result::Malformed, "unsupported bundle version");
+
+    const uint32_t seq = in["seq"] | (uint32_t)0;
+    const String device = in["device"] | "";
+    if (seq == 0 || device.length() == 0)
+        return finish(Result::Malformed, "seq and device are required");
+
+    const String id = deviceId();
+    if (device != "*" && !device.equalsIgnoreCase(id))
+        return finish(Result::WrongDevice, "bundle is for " + device + ", this is " + id);
+    if (seq <= Config::instance().getBundleSeq())
+        return finish(Result::Stale, "seq " + String(seq) + " not above applied " + String(Config::instance().getBundleSeq()));
+
+    JsonArrayConst networks = in["networks"].as<JsonArrayConst>();
+    if (networks.isNull() || networks.size() == 0 || networks.size() > 1u + Config::MAX_EXTRA_NETWORKS)
+        return finish(Result::Invalid, "networks: 1 to " + String(1 + Config::MAX_EXTRA_NETWORKS) + " entries");
+    for (JsonVariantConst n : networks)
+    {
+        const char *ssid = n["ssid"] | "";
+        const char *password = n["password"] | "";
+        const size_t ssidLen = strlen(ssid);
+        const size_t passwordLen = strlen(password);
+        if (ssidLen == 0 || ssidLen > MAX_SSID)
+            return finish(Result::Invalid, "networks: SSID of 1 to 32 bytes required");
+        if (passwordLen != 0 && (passwordLen < MIN_PASSPHRASE || passwordLen > MAX_PASSPHRASE))
+            return finish(Result::Invalid, String("networks: password for \"") + ssid + "\" must be empty or 8 to 64 characters");
+    }
+
+    String name;
+    if (in.containsKey("deviceName"))
+    {
+        name = expandName(in["deviceName"] | "", id);
+        if (!validDeviceName(name))
+            return finish(Result::Invalid, "deviceName \"" + name + "\": 1 to 32 letters, digits, '-' or '_'");
+    }
+
+    JsonObjectConst settings = in["settings"].as<JsonObjectConst>();
+    if (!settings.isNull() && settings.containsKey("displays") && !settings["displays"].is<JsonArrayConst>())
+        return finish(Result::Invalid, "settings.displays must be an array");
+
+    // config.json layout; keys that are absent keep their current values
+    PooledJsonDocument cfg(MAX_PAYLOAD + 512, PooledJsonAllocator(jsonModule()));
+    cfg["ssid"] = networks[0]["ssid"];
+    cfg["password"] = networks[0]["password"] | "";
+    JsonArray extras = cfg.createNestedArray("networks");
+    for (size_t i = 1; i < networks.size(); ++i)
+    {
+        JsonObject n = extras.createNestedObject();
+        n["ssid"] = networks[i]["ssid"];
+        n["password"] = networks[i]["password"] | "";
+    }
+    if (name.length() > 0)
+        cfg["deviceName"] = name;
+    if (!settings.isNull())
+    {
+        if (settings.containsKey("ntpServer"))
+            cfg["ntpServer"] = settings["ntpServer"];
+        if (settings.containsKey("displays"))
+            cfg["displays"] = settings["displays"];
+    }
+    cfg["bundleSeq"] = seq;
+    if (cfg.overflowed())
+        return finish(Result::Invalid, "bundle too large");
+
+    if (!Config::instance().applyAndPersist(cfg))
+        return finish(Result::StoreFailed, "config.json write failed; previous configuration kept");
+
+    finish(Result::Applied, "seq " + String(seq) + ", " + String(networks.size()) + " network(s)" +
+                                (name.length() > 0 ? ", name " + name : String()));
+    // First boot: close the portal and connect with the new configuration
+    Provisioning::instance().adoptConfiguration();
+    return Result::Applied;
+}
+
+void ProvisioningBundle::applyDroppedFile()
+{
+    FileSystem &fs = FileSystem::instance();
+    if (!fs.exists(DROP_PATH))
+        return;
+
+    Logger::instance().info(String("Bundle: found ") + DROP_PATH);
+    const Result r = applyEnvelope(fs.read(DROP_PATH));
+
+    // Out of the way either way, so it is not applied (or refused) again on every boot
+    const String done = String(DROP_PATH) + (r == Result::Applied ? ".applied" : ".rejected");
+    if (!LittleFS.rename(DROP_PATH, done.c_str()))
+        fs.remove(DROP_PATH);
+}
+
+ProvisioningBundle::Result ProvisioningBundle::finish(Result r, const String &detail)
+{
+    attempted_ = true;
+    lastResult_ = r;
+    lastDetail_ = detail;
+    if (r == Result::Applied)
+        Logger::instance().info(String("Bundle: applied (") + detail + ")");
+    else
+        Logger::instance().warn(String("Bundle: refused, ") + resultToString(r) + ": " + detail);
+    return r;
+}
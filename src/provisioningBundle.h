@@ -0,0 +1,85 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * @file provisioningBundle.h
+ * @brief Signed provisioning bundles: WiFi networks, device name and settings in one step.
+ *
+ * For provisioning many units without the portal. scripts/make_bundle.py signs one
+ * bundle per device (or one for the whole fleet) with the fleet's private key; the
+ * device checks it against the public key compiled in from bundleKey.h.
+ *
+ * A bundle is the envelope {"payload": base64, "sig": base64}. The payload is JSON:
+ *   {"v": 1, "seq": 7, "device": "A1B2C3D4E5F6" | "*",
+ *    "networks": [{"ssid": "...", "password": "..."}, ...],   primary first, 1..5
+ *    "deviceName": "heater-{mac4}",                              optional template
+ *    "settings": {"ntpServer": "...", "displays": [...]}}        optional
+ * and "sig" an ECDSA P-256 / SHA-256 signature (DER) over the payload bytes exactly as
+ * sent, so nothing has to be canonicalised. The name template knows {mac} (12 hex
+ * digits) and {mac4} (last 4, as in the AP name).
+ *
+ * Accepted through:
+ *  - the console:     bundle apply <payload> <sig>
+ *  - HTTP:            POST /api/bundle with the envelope as body
+ *  - a dropped file:  DROP_PATH on LittleFS, applied at boot and renamed afterwards
+ *
+ * A bundle is verified and validated completely before anything changes, then written
+ * with Config::applyAndPersist() (one config.json rename), so a unit ends up with
+ * either the old or the new configuration. "seq" must be higher than the last applied
+ * bundle's; a replayed or older bundle is refused. Service task only.
+ */
+class ProvisioningBundle
+{
+public:
+    static constexpr const char *DROP_PATH = "/bundle.json";
+    static constexpr size_t MAX_PAYLOAD = 1536;
+    static constexpr size_t MAX_SIGNATURE = 80; // DER ECDSA P-256: at most 72 bytes
+
+    enum class Result : uint8_t
+    {
+        Applied,
+        Malformed,    // not a bundle: envelope, base64 or payload JSON
+        NoKey,        // no public key compiled in
+        BadSignature, // not signed with the fleet key
+        WrongDevice,  // meant for another unit
+        Stale,        // seq not above the last applied bundle
+        Invalid,      // signed, but a value is out of range
+        StoreFailed   // config.json could not be written; nothing changed
+    };
+
+    static ProvisioningBundle &instance();
+    static const char *resultToString(Result r);
+    static bool keyCompiledIn();
+
+    Result applyEnvelope(const String &json);
+    Result apply(const String &payloadB64, const String &sigB64);
+
+    // Boot: apply DROP_PATH if present, then rename it to .applied / .rejected
+    void applyDroppedFile();
+
+    // 12 upper-case hex digits of the station MAC; what "device" must match
+    String deviceId() const;
+
+    bool attempted() const { return attempted_; }
+    Result lastResult() const { return lastResult_; }
+    const String &lastDetail() const { return lastDetail_; }
+
+    // Building blocks of apply(); no device state involved
+    static bool verifySignature(const uint8_t *payload, size_t len, const uint8_t *sig, size_t sigLen,
+                                const char *pem, size_t pemLen);
+    static String expandName(const String &tmpl, const String &deviceId);
+
+private:
+    ProvisioningBundle();
+    ~ProvisioningBundle() = default;
+    ProvisioningBundle(const ProvisioningBundle &) = delete;
+    ProvisioningBundle &operator=(const ProvisioningBundle &) = delete;
+
+    Result applyPayload(const uint8_t *payload, size_t len);
+    Result finish(Result r, const String &detail);
+
+    Result lastResult_;
+    String lastDetail_;
+    bool attempted_;
+};
@@ -0,0 +1,208 @@
+#pragma once
+
+/**
+ * @file provisioningPage.h
+ * @brief Provisioning page, gzipped. GENERATED by scripts/build_web.py from
+ *        web/provisioning/app.js, web/provisioning/index.html, web/provisioning/style.css; do not edit.
+ */
+
+#include <Arduino.h>
+
+namespace ProvisioningPage
+{
+    constexpr size_t RAW_SIZE = 7054;
+    constexpr size_t GZ_SIZE = 3017;
+    constexpr const char *ETAG = "\"5a3f9cf80d2ba4ff\"";
+
+    alignas(4) static const uint8_t GZ[GZ_SIZE] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0x59, 0xdd, 0x72, 0xdb, 0x36,
+    0x16, 0xbe, 0xef, 0x53, 0x30, 0x4a, 0x1b, 0x92, 0xb5, 0x44, 0x49, 0xf9, 0x71, 0x13, 0x49, 0xb4,
+    0x27, 0x75, 0x92, 0x6d, 0x76, 0xf2, 0xe3, 0x89, 0xdd, 0xed, 0xce, 0x64, 0x33, 0x1d, 0x98, 0x04,
+    0x2d, 0xd4, 0x14, 0xc1, 0x82, 0x90, 0x15, 0x57, 0xd5, 0xcd, 0xce, 0xce, 0xce, 0x3e, 0x41, 0x5e,
+    0x65, 0xef, 0xf7, 0x51, 0xf2, 0x24, 0xfb, 0x1d, 0x00, 0xa4, 0x48, 0xd9, 0x4e, 0x77, 0x6f, 0x2c,
+    0x12, 0x38, 0x00, 0xce, 0xcf, 0x77, 0xbe, 0x73, 0x40, 0xcf, 0xee, 0xa4, 0x32, 0xd1, 0x57, 0x25,
+    0xf7, 0xe6, 0x7a, 0x91, 0x1f, 0xcc, 0xdc, 0x5f, 0xce, 0xd2, 0x83, 0xd9, 0x82, 0x6b, 0xe6, 0x25,
+    0x73, 0xa6, 0x2a, 0xae, 0xe3, 0xde, 0x52, 0x67, 0x83, 0xc7, 0x3d, 0x37, 0x5a, 0xb0, 0x05, 0x8f,
+    0x7b, 0x97, 0x82, 0xaf, 0x4a, 0xa9, 0x74, 0xcf, 0x4b, 0x64, 0xa1, 0x79, 0x01, 0xa9, 0x95, 0x48,
+    0xf5, 0x3c, 0x4e, 0xf9, 0xa5, 0x48, 0xf8, 0xc0, 0xbc, 0xf4, 0x3d, 0x51, 0x08, 0x2d, 0x58, 0x3e,
+    0xa8, 0x12, 0x96, 0xf3, 0x78, 0x8c, 0x3d, 0xb4, 0xd0, 0x39, 0x3f, 0x38, 0x7a, 0xf6, 0xc3, 0xe0,
+    0x08, 0x0b, 0x95, 0xcc, 0xbd, 0x63, 0x25, 0x2f, 0x45, 0x25, 0x64, 0x21, 0x8a, 0xf3, 0xd9, 0xd0,
+    0xce, 0xcf, 0x72, 0x51, 0x5c, 0x78, 0x8a, 0xe7, 0x71, 0x4f, 0xe0, 0x80, 0x9e, 0x37, 0x57, 0x3c,
+    0x8b, 0x7b, 0x29, 0xd3, 0x6c, 0xd2, 0xc7, 0x2e, 0x95, 0xbe, 0x82, 0xd4, 0xfb, 0xb9, 0x48, 0x53,
+    0x5e, 0x7c, 0x58, 0xa7, 0xa2, 0x2a, 0x73, 0x76, 0x35, 0x29, 0x64, 0xc1, 0xef, 0x88, 0x05, 0x29,
+    0xc6, 0x0a, 0xbd, 0x39, 0x93, 0xe9, 0xd5, 0x3a, 0xc3, 0x31, 0x83, 0x8c, 0x2d, 0x44, 0x7e, 0x35,
+    0x79, 0xaa, 0xa0, 0x4c, 0xff, 0x07, 0x9e, 0x5f, 0x72, 0x2d, 0x12, 0xd6, 0xaf, 0x58, 0x51, 0x0d,
+    0x2a, 0xae, 0x44, 0x36, 0x5d, 0x30, 0x75, 0x2e, 0x8a, 0xc9, 0x98, 0x2f, 0xf0, 0xf8, 0xd1, 0xea,
+    0x3f, 0x79, 0x30, 0xe2, 0x8b, 0x4d, 0xce, 0xce, 0x78, 0xde, 0x1c, 0x71, 0x96, 0xcb, 0xe4, 0xc2,
+    0x49, 0x0f, 0xb4, 0x2c, 0x27, 0xa3, 0xe8, 0x11, 0x84, 0x44, 0x51, 0x2e, 0xf5, 0xda, 0xae, 0x1a,
+    0x8f, 0x46, 0xdf, 0x4c, 0x4b, 0x96, 0xa6, 0x30, 0xc8, 0x4e, 0x77, 0xe5, 0xef, 0x63, 0xe0, 0x4c,
+    0x7e, 0x1c, 0x54, 0xe2, 0x37, 0x92, 0x38, 0x93, 0x2a, 0xe5, 0x6a, 0x80, 0x91, 0xcd, 0xd9, 0x52,
+    0x6b, 0x59, 0xac, 0x5b, 0xd2, 0xa4, 0xcf, 0x76, 0xab, 0x7d, 0xbe, 0xf0, 0x30, 0xb2, 0x89, 0x28,
+    0x4a, 0x8d, 0x4a, 0x59, 0xce, 0x3f, 0x4e, 0x7f, 0x59, 0x56, 0x5a, 0x64, 0x57, 0x03, 0x17, 0x8e,
+    0x49, 0x55, 0x32, 0x84, 0xe1, 0x8c, 0xeb, 0x15, 0xe7, 0xc5, 0x94, 0xe5, 0xe2, 0xbc, 0x18, 0x08,
+    0xcd, 0x17, 0xd5, 0x24, 0xc1, 0x34, 0x57, 0x9b, 0x88, 0x5c, 0xec, 0x8e, 0x9a, 0x8c, 0xb6, 0x87,
+    0x4c, 0xad, 0x3e, 0xf4, 0xc0, 0x92, 0x8b, 0x73, 0x25, 0x97, 0x45, 0x6a, 0x1c, 0x3b, 0x4d, 0x64,
+    0x2e, 0xd5, 0xe4, 0xee, 0x68, 0x3f, 0x99, 0x6a, 0xfe, 0x51, 0x0f, 0x52, 0x9e, 0x48, 0xc5, 0x34,
+    0x22, 0x37, 0x81, 0x0c, 0x57, 0xd8, 0x90, 0x43, 0x35, 0x51, 0xe8, 0xb5, 0x13, 0xdd, 0xdf, 0xdf,
+    0x9f, 0x1a, 0xff, 0xc3, 0x54, 0x0e, 0xfd, 0x9f, 0x34, 0xae, 0xc0, 0xcb, 0x03, 0x18, 0x33, 0xda,
+    0xdc, 0x2d, 0xb8, 0xae, 0xd6, 0xb9, 0xa8, 0x20, 0x44, 0x41, 0xb5, 0x47, 0x75, 0x85, 0xae, 0x2b,
+    0x37, 0x2e, 0x3f, 0x7a, 0x95, 0xcc, 0x45, 0xea, 0xdd, 0x4d, 0x92, 0xc4, 0x44, 0x6c, 0xce, 0xc5,
+    0xf9, 0x5c, 0x4f, 0xc6, 0xe4, 0x6e, 0x79, 0xc9, 0x55, 0x96, 0xcb, 0xd5, 0xe0, 0x6a, 0xc2, 0x96,
+    0x5a, 0xda, 0x43, 0xbc, 0x5c, 0xfc, 0x3f, 0x2e, 0xeb, 0x78, 0x7d, 0xda, 0x04, 0x09, 0x01, 0x5a,
+    0xb4, 0x8f, 0xe7, 0x1c, 0x8e, 0x59, 0xaa, 0x0a, 0xe6, 0x96, 0x52, 0x18, 0xcf, 0xd6, 0xa7, 0x4d,
+    0x72, 0x06, 0xab, 0x92, 0xb9, 0xc8, 0xd3, 0x75, 0x77, 0xfd, 0xa8, 0x91, 0x89, 0x2a, 0x60, 0xab,
+    0xe5, 0xe8, 0xbb, 0x7c, 0x3f, 0x1b, 0x65, 0x99, 0x9b, 0x8f, 0x2a, 0x71, 0xde, 0xf6, 0xe5, 0x6a,
+    0x8e, 0x10, 0x0e, 0x8c, 0x9e, 0xf0, 0xd3, 0x4a, 0xb1, 0xb2, 0x46, 0x56, 0xce, 0x33, 0x4d, 0x60,
+    0xd9, 0xdc, 0xad, 0x34, 0x2f, 0xab, 0xb5, 0xd3, 0xde, 0x8d, 0x1b, 0x88, 0xda, 0x19, 0xf2, 0x82,
+    0xdb, 0xf1, 0xc9, 0x93, 0x27, 0xd7, 0xa2, 0x51, 0xcb, 0x44, 0x80, 0x61, 0x1d, 0xef, 0xd1, 0xc8,
+    0x06, 0x71, 0x65, 0x3d, 0x7c, 0x26, 0xf3, 0xb4, 0x2d, 0x78, 0xd1, 0x08, 0x3e, 0x6e, 0x6f, 0x70,
+    0x06, 0x84, 0xba, 0x89, 0x64, 0x34, 0xda, 0xe0, 0x5d, 0xad, 0x5d, 0x8c, 0x6c, 0x4e, 0x74, 0xac,
+    0xe6, 0xbc, 0x95, 0x81, 0xa4, 0x08, 0xc4, 0x5f, 0x88, 0x3c, 0xaf, 0x97, 0x98, 0x9c, 0xb2, 0xe9,
+    0xd5, 0x01, 0xa6, 0x45, 0xa3, 0x42, 0x1e, 0x0b, 0x03, 0x44, 0x23, 0xe2, 0xe1, 0x80, 0x6a, 0x33,
+    0x1b, 0x5a, 0x96, 0x98, 0x0d, 0x2d, 0xa7, 0x11, 0x1b, 0x80, 0xdf, 0x1e, 0x7c, 0x81, 0x7c, 0x30,
+    0x39, 0xab, 0x78, 0x42, 0x3b, 0x79, 0x22, 0x8d, 0x7b, 0x60, 0xbf, 0x65, 0x09, 0xba, 0x49, 0xc5,
+    0xa5, 0x97, 0x20, 0x9a, 0x55, 0xdc, 0xa3, 0xbd, 0x88, 0x80, 0x4a, 0x56, 0x1c, 0xfc, 0x24, 0x06,
+    0x2f, 0x84, 0x87, 0x48, 0xad, 0xa4, 0xba, 0xa8, 0x70, 0x1e, 0x0d, 0xce, 0x6c, 0x12, 0x7b, 0xc4,
+    0xac, 0x71, 0xcf, 0xbe, 0xf4, 0xcc, 0x6e, 0x8a, 0x83, 0x06, 0xf1, 0xec, 0x76, 0xa2, 0xfc, 0xeb,
+    0x1d, 0xbc, 0x33, 0x83, 0xb3, 0xa1, 0x15, 0x84, 0xb2, 0x38, 0xeb, 0x60, 0xb6, 0xcc, 0xcd, 0x0a,
+    0x02, 0x01, 0x0e, 0x1b, 0x2e, 0x41, 0xcc, 0xa5, 0xd5, 0x08, 0xc2, 0x27, 0x9a, 0x69, 0xde, 0x6c,
+    0x43, 0xf9, 0xd6, 0x3b, 0x38, 0xc1, 0x38, 0xd9, 0x10, 0x45, 0xd1, 0x6c, 0x58, 0x1e, 0xcc, 0x32,
+    0xa9, 0x16, 0x66, 0x41, 0x09, 0x03, 0x7b, 0x1e, 0x33, 0x36, 0xc5, 0xbd, 0x61, 0xc5, 0x2e, 0xb1,
+    0x14, 0x44, 0x3e, 0x97, 0x34, 0x29, 0x2b, 0xac, 0x9d, 0x19, 0x86, 0x73, 0xd6, 0x9c, 0x9c, 0xbc,
+    0x7c, 0x36, 0x33, 0x6c, 0x66, 0xcf, 0xab, 0x44, 0xda, 0x73, 0x9c, 0x6f, 0x9f, 0x29, 0xa1, 0x12,
+    0xb9, 0x28, 0x73, 0xae, 0x31, 0x26, 0xb3, 0xcc, 0x0d, 0xb1, 0x52, 0x68, 0xd0, 0xcc, 0x6f, 0x18,
+    0xa4, 0x14, 0xee, 0x81, 0xbd, 0x7f, 0x5d, 0x0a, 0xc5, 0xe1, 0xf9, 0xa1, 0x3d, 0xc0, 0x9e, 0x63,
+    0xb5, 0x5a, 0xa5, 0xef, 0xe4, 0xaa, 0xe7, 0xce, 0x3c, 0x86, 0x21, 0x70, 0x61, 0xda, 0x3a, 0xb7,
+    0x74, 0x43, 0xf5, 0xd9, 0xdb, 0x77, 0xeb, 0xd7, 0xe6, 0x7d, 0x67, 0xf7, 0x83, 0x67, 0xa6, 0xfe,
+    0x78, 0x6f, 0xb0, 0xaa, 0xb5, 0x9d, 0xad, 0x4a, 0x34, 0x58, 0x6f, 0xd8, 0x1e, 0xb9, 0x51, 0xff,
+    0xed, 0xc6, 0x9d, 0x80, 0x56, 0xcb, 0xb3, 0x85, 0x80, 0xd3, 0x00, 0xa0, 0x02, 0x48, 0x69, 0x05,
+    0x8e, 0x5c, 0x8e, 0x1f, 0x87, 0x9f, 0x2e, 0x90, 0x10, 0x85, 0x73, 0x84, 0xbf, 0x42, 0x21, 0x33,
+    0x25, 0xeb, 0x60, 0x26, 0xad, 0x23, 0x4c, 0xba, 0x50, 0x08, 0x84, 0x47, 0xc5, 0x6d, 0x40, 0xef,
+    0x84, 0xbb, 0x02, 0x96, 0x9d, 0xe0, 0x2f, 0x42, 0xea, 0x01, 0x85, 0x1a, 0xbf, 0x00, 0x58, 0x2e,
+    0x76, 0x25, 0x7f, 0x01, 0xe7, 0xf4, 0x0e, 0xfe, 0x8c, 0xbf, 0x24, 0xe9, 0xa0, 0x78, 0x93, 0x60,
+    0x6a, 0x6c, 0x72, 0x5a, 0xf3, 0xd4, 0x8a, 0x0c, 0x65, 0xde, 0x01, 0x37, 0x92, 0xce, 0xa1, 0x9d,
+    0x74, 0x73, 0x29, 0xd8, 0xab, 0x41, 0x69, 0xff, 0x3a, 0x1c, 0x02, 0x83, 0x4b, 0x83, 0xcd, 0xf2,
+    0x8b, 0x88, 0xd7, 0xea, 0xaa, 0xb1, 0xf9, 0x54, 0x5d, 0x79, 0xec, 0x9c, 0x89, 0x36, 0xda, 0xb7,
+    0xde, 0x4a, 0x94, 0x28, 0xf5, 0x01, 0xb8, 0xb8, 0xd2, 0xde, 0xd7, 0x71, 0x20, 0xd2, 0x30, 0x3e,
+    0x40, 0x83, 0xb2, 0x5c, 0x80, 0x9a, 0xa3, 0x73, 0xae, 0x9f, 0xe7, 0x9c, 0x1e, 0xbf, 0xbf, 0x7a,
+    0x99, 0xd2, 0xe4, 0xd4, 0x4a, 0x9e, 0x1c, 0x3d, 0x7d, 0xf3, 0xf3, 0xf1, 0xdb, 0x57, 0xaf, 0x7e,
+    0x7e, 0x7d, 0x12, 0x8f, 0x1f, 0x81, 0xaa, 0x5a, 0xe3, 0xaf, 0x9f, 0xfe, 0xd5, 0xcc, 0x61, 0x66,
+    0x34, 0x05, 0x5e, 0x3d, 0xca, 0x9e, 0x53, 0xb1, 0xe0, 0x2a, 0x06, 0xa5, 0x2d, 0x0b, 0x1b, 0x1f,
+    0x98, 0x59, 0x05, 0x0a, 0xe0, 0x0e, 0xd7, 0x76, 0x6d, 0x11, 0xd3, 0xdb, 0x41, 0x3c, 0x78, 0xf4,
+    0xe8, 0xf0, 0xe1, 0xc4, 0x3d, 0xef, 0x7f, 0x77, 0xf8, 0xa0, 0x7e, 0xfe, 0xee, 0xf1, 0xe1, 0xfd,
+    0xc9, 0x78, 0x0a, 0xeb, 0x96, 0xaa, 0xf0, 0x3f, 0x7f, 0xfa, 0xfb, 0xe7, 0x4f, 0xff, 0xf8, 0xfc,
+    0xe9, 0x9f, 0x9f, 0x3f, 0xfd, 0xcb, 0x8f, 0xaa, 0x1c, 0xb0, 0x0a, 0x46, 0xfd, 0x22, 0x8c, 0xc0,
+    0xc1, 0xcf, 0x8b, 0x34, 0x78, 0xd8, 0xf7, 0xff, 0xf3, 0x6f, 0x3f, 0x9c, 0x6e, 0xbe, 0x6a, 0x8e,
+    0x2c, 0x45, 0x72, 0x11, 0x20, 0x58, 0xfd, 0x1c, 0x87, 0x7e, 0x1d, 0xf8, 0x94, 0x59, 0x7e, 0x18,
+    0x5d, 0xb2, 0x7c, 0xc9, 0x63, 0x8c, 0x47, 0x34, 0x30, 0xc5, 0x84, 0xcd, 0x13, 0x4c, 0x59, 0x17,
+    0xc6, 0x77, 0xcc, 0x24, 0x47, 0xc1, 0xe1, 0x53, 0x91, 0x05, 0xad, 0xd7, 0x90, 0xa4, 0x5d, 0x52,
+    0x34, 0x5b, 0xf9, 0x3e, 0x98, 0x5b, 0x05, 0xd6, 0x2c, 0xa4, 0x9e, 0xcc, 0x3c, 0x88, 0x11, 0xab,
+    0x40, 0xc4, 0x14, 0x26, 0xc5, 0x8b, 0x90, 0xe7, 0x91, 0x89, 0xff, 0x2b, 0x14, 0xe1, 0x48, 0xcb,
+    0xf3, 0xf3, 0x9c, 0x43, 0x25, 0x9e, 0xfb, 0x7d, 0xf4, 0x5f, 0x71, 0x0c, 0x1d, 0xa7, 0xc1, 0xf6,
+    0xa0, 0xc3, 0xce, 0x41, 0x13, 0xbc, 0x6d, 0x53, 0xc9, 0x0f, 0xc3, 0x28, 0x43, 0xcc, 0xaa, 0xa0,
+    0x63, 0x6e, 0x35, 0x97, 0xab, 0x37, 0x8e, 0x25, 0x03, 0x2a, 0xf5, 0xb5, 0xa7, 0x97, 0x79, 0xdc,
+    0xe8, 0xe3, 0x02, 0x87, 0x73, 0x0d, 0x40, 0xe3, 0x1d, 0xb7, 0x4c, 0x97, 0x79, 0x44, 0x5d, 0xc7,
+    0x91, 0x6b, 0x37, 0x3b, 0xa6, 0x61, 0x07, 0xb2, 0xad, 0xbd, 0x75, 0x2e, 0xe2, 0x06, 0x3d, 0x89,
+    0xe2, 0x60, 0x4c, 0x07, 0xa0, 0xc0, 0xcf, 0x45, 0x73, 0x9a, 0xe1, 0x82, 0xdb, 0xe4, 0x88, 0xce,
+    0x21, 0x49, 0x32, 0x9d, 0xa3, 0x9b, 0x00, 0x39, 0x8d, 0xc5, 0xf9, 0x1f, 0x6d, 0x01, 0x11, 0xeb,
+    0x62, 0x72, 0x52, 0xec, 0xe3, 0xd5, 0x37, 0x63, 0xed, 0x5d, 0xdb, 0x2e, 0xf6, 0xff, 0xb6, 0x5c,
+    0x8f, 0x5f, 0x3c, 0x1a, 0xdf, 0xdf, 0x78, 0xfe, 0xc4, 0xf7, 0xc3, 0x3d, 0x83, 0x51, 0x12, 0x30,
+    0x38, 0xb5, 0x6b, 0xa9, 0x51, 0x8e, 0xeb, 0xb1, 0x3d, 0xdf, 0x4b, 0xbf, 0x5f, 0xf4, 0xa9, 0x67,
+    0x47, 0x86, 0xe7, 0x9e, 0xbf, 0x47, 0x33, 0xee, 0x6d, 0x8a, 0x72, 0xcc, 0xca, 0x12, 0x74, 0x12,
+    0x90, 0x31, 0x7d, 0x2c, 0x0f, 0xcd, 0x58, 0x9a, 0x3e, 0xbf, 0xc4, 0xd9, 0x14, 0x78, 0x5e, 0x70,
+    0x15, 0xf8, 0x09, 0xd0, 0x7b, 0xe1, 0xf7, 0x03, 0xe4, 0x5e, 0x1b, 0xa3, 0x21, 0x81, 0xad, 0x36,
+    0x1b, 0x90, 0xa8, 0x83, 0x14, 0x62, 0x93, 0xb6, 0x5d, 0xc0, 0x0c, 0xc5, 0xc9, 0x9e, 0x75, 0x44,
+    0xf8, 0x0a, 0x08, 0x3d, 0x9b, 0xcd, 0x57, 0xac, 0xba, 0x2a, 0x12, 0xaf, 0x41, 0x44, 0x2e, 0x59,
+    0xda, 0x20, 0x02, 0xad, 0x3d, 0xb8, 0x71, 0xde, 0x67, 0x1a, 0xfd, 0x69, 0x49, 0x11, 0xcc, 0x39,
+    0x53, 0x94, 0xa7, 0x72, 0xa9, 0x83, 0x26, 0x67, 0x1b, 0x84, 0x50, 0xf9, 0x33, 0xf0, 0xa8, 0x6b,
+    0x21, 0x3c, 0x0c, 0x9e, 0x71, 0x81, 0xc7, 0x56, 0x31, 0x5b, 0x31, 0xa1, 0xbd, 0x8c, 0xeb, 0x64,
+    0x1e, 0xf8, 0x43, 0x30, 0xfb, 0x90, 0x64, 0xfd, 0xbd, 0xfa, 0xa8, 0x43, 0xff, 0xd0, 0x3d, 0xc5,
+    0x63, 0xe3, 0xe0, 0xfe, 0x3a, 0x61, 0xc9, 0x9c, 0x4f, 0xfc, 0x42, 0x82, 0x2f, 0xa5, 0xe2, 0xfe,
+    0xc6, 0xd8, 0x7c, 0x07, 0x32, 0xe8, 0x70, 0x42, 0x3d, 0x57, 0x72, 0x05, 0x98, 0xad, 0xbc, 0xe7,
+    0x4a, 0x01, 0x76, 0xfe, 0x0f, 0xa7, 0xa7, 0xc7, 0x70, 0x32, 0x4d, 0x5b, 0x2a, 0xac, 0xb5, 0x23,
+    0xca, 0x75, 0xe7, 0xd3, 0xe4, 0x2f, 0x95, 0x2c, 0x82, 0x7a, 0x8e, 0xf0, 0x19, 0x07, 0x24, 0x11,
+    0xd5, 0x4d, 0xc3, 0xef, 0xbf, 0xbf, 0xff, 0x80, 0x9c, 0x11, 0x39, 0x1a, 0xc7, 0x20, 0x28, 0xe0,
+    0xf7, 0xc2, 0x38, 0x39, 0x8c, 0xd0, 0x51, 0xea, 0x20, 0x60, 0xfd, 0x33, 0x8c, 0x9d, 0x99, 0x18,
+    0x0f, 0x58, 0x1d, 0xfe, 0x6b, 0xf9, 0x44, 0xba, 0x9a, 0x7d, 0x2b, 0xd7, 0x07, 0xdc, 0xbb, 0xe7,
+    0xbc, 0x39, 0xeb, 0x32, 0x61, 0xb8, 0x36, 0xee, 0xeb, 0xa6, 0x52, 0xab, 0x79, 0x00, 0x2e, 0x1b,
+    0x8e, 0x44, 0xdd, 0xa9, 0x83, 0x40, 0x80, 0xe8, 0xc4, 0x2c, 0x63, 0x79, 0xc5, 0xeb, 0x88, 0xed,
+    0x8d, 0xc3, 0x7e, 0x9b, 0x88, 0x43, 0x47, 0x8d, 0xe0, 0x80, 0xeb, 0xa7, 0x91, 0xbe, 0x51, 0xce,
+    0x8b, 0x73, 0x8d, 0x30, 0x9c, 0xb2, 0xd2, 0x63, 0x75, 0xd9, 0xea, 0x7b, 0x52, 0x99, 0x22, 0xe2,
+    0x09, 0xf4, 0xbe, 0x84, 0x54, 0x0f, 0xf5, 0x57, 0xae, 0x22, 0x84, 0xe8, 0x8d, 0x6c, 0xfa, 0x2c,
+    0x2f, 0xa3, 0xce, 0x6f, 0x6a, 0x25, 0xf5, 0x9c, 0x77, 0x24, 0xa7, 0x9b, 0x84, 0x51, 0xd4, 0xb9,
+    0x52, 0x37, 0x9a, 0xea, 0x0c, 0x30, 0xa1, 0xf0, 0x96, 0x05, 0xbb, 0x64, 0x02, 0x55, 0x3e, 0xe7,
+    0xb7, 0x6e, 0xb7, 0xf9, 0x0a, 0x48, 0xb3, 0x9d, 0x1b, 0xa8, 0xe8, 0x8b, 0x19, 0xd3, 0x71, 0x90,
+    0x56, 0x4b, 0xde, 0x1f, 0x21, 0x73, 0xb6, 0x3c, 0x76, 0x7d, 0xb1, 0x69, 0x50, 0xec, 0xe2, 0xf5,
+    0x0d, 0x6c, 0x6f, 0x9c, 0x3c, 0xdd, 0xd4, 0xf0, 0x69, 0xca, 0xdc, 0xa8, 0x29, 0x73, 0x7f, 0x7a,
+    0xf9, 0x97, 0xe7, 0x3f, 0xff, 0x78, 0x4c, 0xa3, 0xfb, 0xa3, 0xed, 0xf0, 0xbb, 0xe7, 0x4f, 0x4f,
+    0xde, 0xbe, 0x39, 0x89, 0xd7, 0xf7, 0x27, 0xfe, 0x4a, 0x49, 0x74, 0x06, 0x35, 0x63, 0x1f, 0xfa,
+    0xfd, 0xf1, 0xa3, 0x1b, 0x06, 0xef, 0x8f, 0x1e, 0xde, 0x38, 0x3a, 0x9e, 0xf8, 0xce, 0xef, 0x5e,
+    0x21, 0xb5, 0x75, 0x3d, 0x8d, 0x63, 0x63, 0x74, 0x4d, 0x73, 0x58, 0x83, 0x7b, 0xb4, 0x49, 0xe9,
+    0x0c, 0x9e, 0xe4, 0x66, 0xee, 0x01, 0xe6, 0xaa, 0x4a, 0x26, 0x62, 0x67, 0xe2, 0xd1, 0x43, 0xca,
+    0x2f, 0x0f, 0x6e, 0xa0, 0x56, 0xc8, 0x13, 0xe8, 0x18, 0x00, 0x2f, 0x9a, 0x80, 0x46, 0xf5, 0x68,
+    0x8e, 0x96, 0xd4, 0xdf, 0x6c, 0xab, 0x33, 0x40, 0x78, 0x82, 0x06, 0x26, 0xa0, 0x2e, 0xa6, 0x9f,
+    0xe4, 0x55, 0xb8, 0xde, 0xd2, 0x3e, 0x3a, 0x1c, 0x5b, 0xd1, 0x4c, 0x17, 0xd5, 0x2e, 0x69, 0x8e,
+    0x0b, 0xcc, 0xa5, 0x2b, 0x7e, 0xef, 0x53, 0x3f, 0xe5, 0xf7, 0x7d, 0x6a, 0x96, 0xf0, 0x43, 0xad,
+    0x90, 0xff, 0xc1, 0xb9, 0x8a, 0xe9, 0xd8, 0x48, 0x45, 0x02, 0x57, 0xd8, 0x8f, 0x6f, 0x33, 0xe4,
+    0x53, 0x44, 0x99, 0x54, 0x11, 0xdb, 0x61, 0xdb, 0xb0, 0x8f, 0x8b, 0xd6, 0x8e, 0x88, 0x19, 0x9f,
+    0x76, 0xb8, 0x8f, 0xe9, 0x19, 0xe4, 0x0e, 0x7d, 0x79, 0xe1, 0x4f, 0xb0, 0x65, 0x1c, 0xd3, 0x1b,
+    0xd4, 0x05, 0xb9, 0x10, 0x86, 0xda, 0xe6, 0x7c, 0xcf, 0x54, 0x90, 0x29, 0xdb, 0x91, 0x9b, 0xea,
+    0xef, 0xfa, 0x2c, 0xe8, 0x6f, 0x2e, 0x2c, 0x91, 0xfd, 0x90, 0xf2, 0x9a, 0xe9, 0x79, 0x64, 0x2e,
+    0x39, 0x81, 0x79, 0x5c, 0x88, 0x22, 0x18, 0xf7, 0x9b, 0x85, 0xdf, 0x02, 0x05, 0xe1, 0x9e, 0xff,
+    0x8d, 0xbf, 0x5b, 0x68, 0x5f, 0xa0, 0x0d, 0x0d, 0xcc, 0xbe, 0x75, 0xd3, 0xb9, 0x05, 0x14, 0x81,
+    0xd2, 0x00, 0x92, 0xee, 0x35, 0xd7, 0x70, 0xb6, 0xdd, 0x27, 0x93, 0x39, 0xe0, 0x7f, 0xec, 0xd6,
+    0x07, 0xdb, 0xaa, 0x6a, 0xb9, 0xce, 0x90, 0xaf, 0x79, 0xf2, 0x5b, 0xa4, 0xac, 0xa8, 0x6a, 0x3f,
+    0xa3, 0x8c, 0x83, 0xed, 0x0d, 0xe7, 0x91, 0x4a, 0x71, 0x50, 0x11, 0xc2, 0xc1, 0x51, 0x55, 0x54,
+    0xce, 0xe1, 0x5a, 0xf8, 0xc7, 0xd7, 0xbc, 0xa2, 0xae, 0xd6, 0x6f, 0xb6, 0xe6, 0x49, 0xd5, 0x36,
+    0x1a, 0xb2, 0x3c, 0x67, 0x65, 0xc5, 0xd3, 0xd7, 0x60, 0xc9, 0x51, 0x38, 0x24, 0xd8, 0x83, 0xfb,
+    0x1c, 0x1e, 0xea, 0x60, 0x4a, 0x53, 0x5f, 0xad, 0x57, 0x47, 0xd1, 0xfd, 0x3d, 0x5c, 0xd7, 0xbf,
+    0x6d, 0xf9, 0x8b, 0x76, 0xc5, 0x4a, 0xe4, 0xa1, 0x55, 0xb8, 0xcb, 0x06, 0xae, 0x1d, 0xa6, 0xd6,
+    0x59, 0x4b, 0xd0, 0x79, 0x65, 0xb8, 0x77, 0xcf, 0x07, 0x11, 0x7a, 0x01, 0x5e, 0xb1, 0x18, 0x85,
+    0xb5, 0x0a, 0x7d, 0x47, 0x68, 0x5e, 0xed, 0xa9, 0xae, 0x29, 0x49, 0xdd, 0x55, 0xc3, 0x98, 0x46,
+    0x3f, 0x83, 0xb2, 0x3e, 0x01, 0xa2, 0xd1, 0x6f, 0xfc, 0x45, 0x2d, 0x78, 0xba, 0xa3, 0x84, 0x77,
+    0x0a, 0x36, 0xb2, 0xcd, 0x95, 0x27, 0x40, 0x88, 0xa8, 0x40, 0x4c, 0x7b, 0x73, 0xad, 0xcb, 0xc9,
+    0x70, 0x48, 0x72, 0xa2, 0xdc, 0xf3, 0x87, 0x1e, 0x75, 0xde, 0x73, 0xa6, 0x6b, 0x7e, 0xa4, 0x65,
+    0x90, 0x36, 0x21, 0xae, 0xc7, 0xd0, 0xdf, 0xcb, 0x8a, 0x9b, 0x94, 0xf3, 0xf7, 0x5a, 0x3e, 0xae,
+    0x22, 0x34, 0x08, 0x29, 0xee, 0x70, 0xaf, 0x2b, 0xeb, 0x5e, 0xb2, 0x36, 0x6a, 0xac, 0x35, 0x70,
+    0xd9, 0x35, 0xd6, 0xa5, 0x73, 0xcb, 0x52, 0x17, 0x09, 0x5c, 0xf8, 0xfd, 0xdb, 0x0c, 0x5c, 0xe6,
+    0xa9, 0xe1, 0x0f, 0xe7, 0xa9, 0xae, 0xa1, 0x1e, 0xca, 0x32, 0x43, 0x9d, 0x34, 0x43, 0xf6, 0x71,
+    0x2f, 0x70, 0x14, 0xf6, 0xbe, 0x1e, 0xf9, 0x00, 0x3a, 0x82, 0xc0, 0xb5, 0x61, 0xd3, 0x1e, 0x01,
+    0xca, 0xde, 0xd1, 0x9c, 0x27, 0x17, 0x86, 0xc0, 0x6b, 0x02, 0xf3, 0x60, 0x1b, 0x6c, 0x70, 0x97,
+    0x0e, 0x98, 0x65, 0x98, 0x1c, 0x03, 0xbb, 0xc8, 0xef, 0x9a, 0xdb, 0x0d, 0x35, 0x55, 0x56, 0xc2,
+    0x30, 0x25, 0x41, 0xe8, 0xca, 0x9a, 0x05, 0x6c, 0x89, 0x24, 0x89, 0x4d, 0x5f, 0x63, 0xf8, 0xfb,
+    0x8f, 0x3a, 0x90, 0xb2, 0xfe, 0xd2, 0x30, 0x74, 0xa9, 0x73, 0x5b, 0xcf, 0x61, 0x5b, 0x8e, 0x7b,
+    0xf7, 0xcc, 0xa9, 0xbb, 0x9d, 0x44, 0xa3, 0xc3, 0x6e, 0x9d, 0xdb, 0xf5, 0xf9, 0x4f, 0x58, 0x47,
+    0xb8, 0xce, 0xa8, 0xa6, 0x6e, 0x71, 0x14, 0x60, 0xb7, 0x05, 0xbb, 0x42, 0x7d, 0xf3, 0xaa, 0x95,
+    0xc0, 0x0e, 0x24, 0xe3, 0xda, 0xc4, 0x2a, 0x34, 0x0d, 0x80, 0x09, 0xf8, 0x36, 0x8f, 0x07, 0x2e,
+    0xb5, 0x67, 0xdb, 0x5a, 0x63, 0x62, 0x5f, 0xb7, 0x06, 0xe4, 0x86, 0x7e, 0x53, 0xf8, 0x37, 0xd8,
+    0x86, 0xdf, 0xa8, 0x10, 0x2a, 0x38, 0x2b, 0xaa, 0x15, 0x57, 0x5e, 0xa6, 0xe4, 0xa2, 0xa5, 0x53,
+    0xe4, 0xbd, 0xcc, 0x50, 0xf1, 0x3d, 0x82, 0x11, 0x72, 0xe0, 0x4a, 0x2e, 0xd5, 0xb6, 0x23, 0xc8,
+    0xc0, 0xb9, 0x34, 0x09, 0x71, 0x5c, 0x79, 0x3c, 0x49, 0xbf, 0x2b, 0x51, 0x71, 0xb8, 0xa4, 0x85,
+    0x25, 0xea, 0x17, 0xba, 0x80, 0xff, 0x5f, 0x43, 0xbf, 0xd9, 0x4c, 0x6f, 0xb7, 0x65, 0xb7, 0x6b,
+    0xa5, 0x8f, 0x27, 0x01, 0x0f, 0xd7, 0x3c, 0x2a, 0x15, 0xa7, 0x4a, 0xfe, 0x8c, 0x67, 0x6c, 0x99,
+    0xeb, 0x86, 0xec, 0xe8, 0x13, 0x40, 0x8c, 0x8e, 0x83, 0x29, 0x5c, 0x58, 0xdb, 0x0d, 0x21, 0x75,
+    0x8e, 0x3f, 0xbe, 0x7b, 0x75, 0x82, 0xbe, 0x36, 0x99, 0x1f, 0x33, 0xc5, 0x16, 0xd4, 0xce, 0xaf,
+    0x3c, 0x22, 0x6b, 0xb8, 0x9a, 0x05, 0xb4, 0x12, 0x24, 0x75, 0x5b, 0xe7, 0x7b, 0x9d, 0xb3, 0x6b,
+    0x2a, 0xbf, 0x4e, 0xf2, 0xd6, 0xb0, 0xeb, 0x06, 0x9b, 0x15, 0x4d, 0xd2, 0xba, 0x92, 0xd8, 0xa5,
+    0xcf, 0xb1, 0x3d, 0xc9, 0x51, 0xfb, 0x4e, 0x93, 0xc8, 0x2e, 0xeb, 0x16, 0x71, 0x0b, 0xf5, 0xc4,
+    0x7e, 0x46, 0xcb, 0x51, 0x65, 0xc9, 0x9c, 0xa7, 0x67, 0x68, 0x5a, 0x8f, 0x9a, 0xb1, 0xc6, 0x2f,
+    0xda, 0x5a, 0xb4, 0xdb, 0x51, 0x6e, 0x57, 0x47, 0x8c, 0x56, 0x06, 0x61, 0xff, 0xb1, 0x21, 0xf9,
+    0xdb, 0xf2, 0x88, 0x02, 0x80, 0xbc, 0xb1, 0x9f, 0xaf, 0x26, 0xfe, 0xf1, 0xdb, 0x93, 0x53, 0xbf,
+    0x4f, 0x5f, 0xe4, 0xb8, 0xaa, 0x26, 0x6b, 0xdf, 0xe9, 0x3a, 0x38, 0x45, 0x2b, 0x87, 0x9e, 0x11,
+    0xd7, 0x90, 0xdc, 0x75, 0x27, 0xc3, 0x8f, 0x83, 0xd5, 0x6a, 0x35, 0x20, 0x2f, 0x0f, 0x96, 0x0a,
+    0xdd, 0x67, 0x22, 0x53, 0x90, 0xd8, 0xa6, 0x4f, 0x1f, 0x05, 0x27, 0xa6, 0x73, 0xd6, 0xf2, 0x44,
+    0x2b, 0x58, 0x08, 0x25, 0x70, 0x3f, 0x2a, 0x58, 0x3e, 0x69, 0xa9, 0x67, 0x47, 0x36, 0x3b, 0x01,
+    0x72, 0x66, 0x75, 0x6e, 0x0a, 0xeb, 0x5d, 0x0f, 0x5b, 0x5a, 0xbc, 0xcd, 0xad, 0xc1, 0xf6, 0x06,
+    0x01, 0x72, 0x7d, 0x38, 0x7a, 0x12, 0x1e, 0xfa, 0x4f, 0x6b, 0x9a, 0x24, 0xcc, 0x51, 0x99, 0x24,
+    0xf6, 0x67, 0x39, 0x08, 0x2f, 0xbd, 0xf2, 0xd4, 0xd2, 0xb6, 0xea, 0xb0, 0xef, 0x84, 0xab, 0x4b,
+    0xa4, 0x13, 0xa7, 0x1b, 0xc9, 0xa4, 0x73, 0x19, 0xf9, 0x03, 0xa6, 0xa3, 0x52, 0xdf, 0xad, 0xf0,
+    0xd7, 0x68, 0xa6, 0xc3, 0x2f, 0x14, 0x0e, 0x49, 0x8d, 0x09, 0x53, 0x45, 0xe0, 0xbf, 0xa0, 0x60,
+    0xb8, 0xae, 0xae, 0x4f, 0x34, 0x99, 0x13, 0x87, 0xd0, 0x37, 0x59, 0x4a, 0xc5, 0x02, 0xfe, 0xbe,
+    0x04, 0xb9, 0x98, 0xcf, 0x64, 0x7e, 0x9f, 0xd6, 0xdf, 0x8e, 0xa9, 0x2f, 0x6f, 0x65, 0xbe, 0x61,
+    0xda, 0x8d, 0x0c, 0xec, 0xe8, 0x1d, 0xb4, 0xbf, 0x90, 0x97, 0x7c, 0xa7, 0x8f, 0xae, 0x4f, 0x23,
+    0x7c, 0x84, 0x56, 0xce, 0x0e, 0x05, 0xa1, 0xeb, 0xe0, 0x89, 0x7d, 0x6f, 0x6c, 0xc1, 0xbb, 0x4b,
+    0x5b, 0x7e, 0xfb, 0x62, 0xab, 0xbf, 0xde, 0x76, 0x5a, 0xd3, 0x1b, 0xee, 0x45, 0x80, 0xf0, 0xe6,
+    0xb6, 0x89, 0xd9, 0xd0, 0x7d, 0xea, 0x9a, 0x0d, 0xed, 0x17, 0xe9, 0xa1, 0xf9, 0xc7, 0xdb, 0x7f,
+    0x01, 0x47, 0x19, 0x09, 0x55, 0x8e, 0x1b, 0x00, 0x00,
+    };
+}
@@ -0,0 +1,311 @@
+/**
+ * @file provisioningProtocol.cpp
+ * @brief X25519 handshake, HKDF key derivation and AES-GCM framing of provisioning commands.
+ */
+
+#include "provisioningProtocol.h"
+
+#include <string.h>
+#include "mbedtls/ecdh.h"
+#include "mbedtls/gcm.h"
+#include "mbedtls/md.h"
+#include "mbedtls/platform_util.h"
+
+constexpr size_t ProvisioningProtocol::KEY_LEN;
+constexpr size_t ProvisioningProtocol::TAG_LEN;
+constexpr size_t ProvisioningProtocol::IV_LEN;
+constexpr size_t ProvisioningProtocol::HEADER_LEN;
+constexpr size_t ProvisioningProtocol::MAX_FRAME;
+constexpr size_t ProvisioningProtocol::MAX_SSID;
+constexpr size_t ProvisioningProtocol::MAX_PASSWORD;
+constexpr size_t ProvisioningProtocol::MAX_DEVICE_NAME;
+constexpr uint8_t ProvisioningProtocol::MAX_AUTH_FAILURES;
+constexpr uint32_t ProvisioningProtocol::LOCKOUT_MS;
+
+namespace
+{
+    constexpr size_t PUBKEY_LEN = 32;
+    constexpr char HKDF_INFO[] = "dhc-prov v1";
+    constexpr uint8_t DIR_CLIENT = 'C';
+    constexpr uint8_t DIR_DEVICE = 'D';
+
+    const mbedtls_md_info_t *sha256()
+    {
+        return mbedtls_md_info_from_type(MBEDTLS_MD_SHA256);
+    }
+
+    void makeIv(uint8_t *iv, uint8_t direction, uint32_t counter)
+    {
+        memset(iv, 0, ProvisioningProtocol::IV_LEN);
+        iv[0] = direction;
+        iv[8] = (uint8_t)(counter >> 24);
+        iv[9] = (uint8_t)(counter >> 16);
+        iv[10] = (uint8_t)(counter >> 8);
+        iv[11] = (uint8_t)counter;
+    }
+
+    // Copy a TLV string value; false if it is too long or contains a NUL
+    bool copyField(char *dst, size_t cap, const uint8_t *value, size_t len)
+    {
+        if (len > cap || memchr(value, 0, len))
+            return false;
+        memcpy(dst, value, len);
+        dst[len] = '\0';
+        return true;
+    }
+}
+
+ProvisioningProtocol::ProvisioningProtocol(RandomFn random, CredentialsFn onCredentials, StatusFn status)
+    : random_(random), onCredentials_(onCredentials), status_(status), popHash_(), havePop_(false),
+      key_(), haveKey_(false), rxCounter_(0), txCounter_(0), authFailures_(0), locked_(false), lockedAtMs_(0)
+{
+}
+
+ProvisioningProtocol::~ProvisioningProtocol()
+{
+    reset();
+    mbedtls_platform_zeroize(popHash_, sizeof(popHash_));
+}
+
+void ProvisioningProtocol::setPop(const char *pop, size_t len)
+{
+    reset();
+    havePop_ = pop && len > 0 && mbedtls_md(sha256(), reinterpret_cast<const unsigned char *>(pop), len, popHash_) == 0;
+}
+
+void ProvisioningProtocol::reset()
+{
+    mbedtls_platform_zeroize(key_, sizeof(key_));
+    haveKey_ = false;
+    rxCounter_ = 0;
+    txCounter_ = 0;
+}
+
+size_t ProvisioningProtocol::handle(const uint8_t *in, size_t len, uint8_t *out, size_t outSize, uint32_t nowMs)
+{
+    if (!in || len == 0 || outSize < MAX_FRAME)
+        return 0;
+    switch (in[0])
+    {
+    case FRAME_HELLO:
+        return onHello(in, len, out, outSize, nowMs);
+    case FRAME_SECURE:
+        return onSecure(in, len, out, outSize, nowMs);
+    default:
+        return error(out, outSize, Error::Malformed);
+    }
+}
+
+size_t ProvisioningProtocol::onHello(const uint8_t *in, size_t len, uint8_t *out, size_t outSize, uint32_t nowMs)
+{
+    if (locked_)
+    {
+        if (nowMs - lockedAtMs_ < LOCKOUT_MS)
+            return error(out, outSize, Error::LockedOut);
+        locked_ = false;
+        authFailures_ = 0;
+    }
+    if (!havePop_)
+        return error(out, outSize, Error::NoSession);
+    if (len != 1 + PUBKEY_LEN)
+        return error(out, outSize, Error::Malformed);
+
+    reset();
+
+    // mbedtls speaks the TLS point format: one length byte, then the 32-byte u-coordinate
+    uint8_t devicePoint[1 + PUBKEY_LEN];
+    uint8_t clientPoint[1 + PUBKEY_LEN];
+    uint8_t shared[32];
+    size_t olen = 0;
+    clientPoint[0] = PUBKEY_LEN;
+    memcpy(clientPoint + 1, in + 1, PUBKEY_LEN);
+
+    auto rng = [](void *self, unsigned char *buf, size_t n) -> int
+    {
+        static_cast<ProvisioningProtocol *>(self)->random_(buf, n);
+        return 0;
+    };
+
+    mbedtls_ecdh_context ecdh;
+    mbedtls_ecdh_init(&ecdh);
+    bool ok = mbedtls_ecdh_setup(&ecdh, MBEDTLS_ECP_DP_CURVE25519) == 0 &&
+              mbedtls_ecdh_make_public(&ecdh, &olen, devicePoint, sizeof(devicePoint), rng, this) == 0 &&
+              olen == sizeof(devicePoint) && devicePoint[0] == PUBKEY_LEN &&
+              mbedtls_ecdh_read_public(&ecdh, clientPoint, sizeof(clientPoint)) == 0 &&
+              mbedtls_ecdh_calc_secret(&ecdh, &olen, shared, sizeof(shared), rng, this) == 0 &&
+              olen == sizeof(shared);
+    mbedtls_ecdh_free(&ecdh);
+
+    ok = ok && deriveKey(shared, in + 1, devicePoint + 1);
+    mbedtls_platform_zeroize(shared, sizeof(shared));
+    if (!ok)
+        return error(out, outSize, Error::Internal);
+
+    haveKey_ = true;
+    out[0] = FRAME_HELLO_ACK;
+    memcpy(out + 1, devicePoint + 1, PUBKEY_LEN);
+    return 1 + PUBKEY_LEN;
+}
+
+/**
+ * HKDF-SHA256 (RFC 5869) with a single output block: the 32-byte session key.
+ */
+bool ProvisioningProtocol::deriveKey(const uint8_t *shared, const uint8_t *clientPub, const uint8_t *devicePub)
+{
+    uint8_t prk[32];
+    uint8_t info[sizeof(HKDF_INFO) - 1 + 2 * PUBKEY_LEN + 1];
+    uint8_t *p = info;
+    memcpy(p, HKDF_INFO, sizeof(HKDF_INFO) - 1);
+    p += sizeof(HKDF_INFO) - 1;
+    memcpy(p, clientPub, PUBKEY_LEN);
+    p += PUBKEY_LEN;
+    memcpy(p, devicePub, PUBKEY_LEN);
+    p += PUBKEY_LEN;
+    *p = 0x01; // T(1)
+
+    const bool ok = mbedtls_md_hmac(sha256(), popHash_, sizeof(popHash_), shared, 32, prk) == 0 &&
+                    mbedtls_md_hmac(sha256(), prk, sizeof(prk), info, sizeof(info), key_) == 0;
+    mbedtls_platform_zeroize(prk, sizeof(prk));
+    return ok;
+}
+
+size_t ProvisioningProtocol::onSecure(const uint8_t *in, size_t len, uint8_t *out, size_t outSize, uint32_t nowMs)
+{
+    if (!haveKey_)
+        return error(out, outSize, Error::NoSession);
+    if (len < HEADER_LEN + TAG_LEN || len > MAX_FRAME)
+        return error(out, outSize, Error::Malformed);
+
+    const uint32_t counter = ((uint32_t)in[1] << 24) | ((uint32_t)in[2] << 16) | ((uint32_t)in[3] << 8) | in[4];
+    if (counter <= rxCounter_)
+        return error(out, outSize, Error::Replay);
+
+    const size_t plainLen = len - HEADER_LEN - TAG_LEN;
+    uint8_t plain[MAX_FRAME];
+    uint8_t iv[IV_LEN];
+    makeIv(iv, DIR_CLIENT, counter);
+
+    mbedtls_gcm_context gcm;
+    mbedtls_gcm_init(&gcm);
+    const bool ok = mbedtls_gcm_setkey(&gcm, MBEDTLS_CIPHER_ID_AES, key_, KEY_LEN * 8) == 0 &&
+                    mbedtls_gcm_auth_decrypt(&gcm, plainLen, iv, IV_LEN, in, HEADER_LEN, in + len - TAG_LEN, TAG_LEN,
+                                             in + HEADER_LEN, plain) == 0;
+    mbedtls_gcm_free(&gcm);
+
+    if (!ok)
+    {
+        // Wrong key means wrong PoP (or tampering): limit how often that can be tried
+        if (++authFailures_ >= MAX_AUTH_FAILURES)
+        {
+            reset();
+            locked_ = true;
+            lockedAtMs_ = nowMs;
+            return error(out, outSize, Error::LockedOut);
+        }
+        return error(out, outSize, Error::AuthFailed);
+    }
+    rxCounter_ = counter;
+    authFailures_ = 0;
+
+    uint8_t reply[16];
+    const size_t replyLen = onCommand(plain, plainLen, reply, sizeof(reply));
+    mbedtls_platform_zeroize(plain, plainLen);
+    return seal(reply, replyLen, out, outSize);
+}
+
+size_t ProvisioningProtocol::onCommand(const uint8_t *cmd, size_t len, uint8_t *reply, size_t replySize)
+{
+    if (len == 0 || replySize < 7)
+        return 0;
+    reply[0] = (uint8_t)(cmd[0] | CMD_REPLY);
+
+    switch (cmd[0])
+    {
+    case CMD_SET_CREDENTIALS:
+    {
+        Credentials creds;
+        memset(&creds, 0, sizeof(creds));
+        bool valid = true;
+        size_t pos = 1;
+        while (valid && pos < len)
+        {
+            if (pos + 2 > len || pos + 2 + cmd[pos + 1] > len)
+            {
+                valid = false;
+                break;
+            }
+            const uint8_t tag = cmd[pos];
+            const uint8_t vlen = cmd[pos + 1];
+            const uint8_t *value = cmd + pos + 2;
+            switch (tag)
+            {
+            case TAG_SSID:
+                valid = copyField(creds.ssid, MAX_SSID, value, vlen);
+                break;
+            case TAG_PASSWORD:
+                valid = copyField(creds.password, MAX_PASSWORD, value, vlen);
+                break;
+            case TAG_DEVICE_NAME:
+                valid = copyField(creds.deviceName, MAX_DEVICE_NAME, value, vlen);
+                break;
+            default:
+                break; // unknown tags are skipped for forward compatibility
+            }
+            pos += 2 + vlen;
+        }
+
+        Result result = Result::Invalid;
+        if (valid && creds.ssid[0] != '\0')
+            result = onCredentials_ ? onCredentials_(creds) : Result::Busy;
+        mbedtls_platform_zeroize(&creds, sizeof(creds));
+        reply[1] = (uint8_t)result;
+        return 2;
+    }
+    case CMD_GET_STATUS:
+    {
+        const Status s = status_ ? status_() : Status{};
+        reply[1] = s.phase;
+        reply[2] = s.reason;
+        memcpy(reply + 3, s.ip, 4);
+        return 7;
+    }
+    default:
+        reply[1] = (uint8_t)Result::Invalid;
+        return 2;
+    }
+}
+
+size_t ProvisioningProtocol::seal(const uint8_t *plain, size_t len, uint8_t *out, size_t outSize)
+{
+    if (len == 0 || HEADER_LEN + len + TAG_LEN > outSize)
+        return error(out, outSize, Error::Internal);
+
+    const uint32_t counter = ++txCounter_;
+    out[0] = FRAME_SECURE;
+    out[1] = (uint8_t)(counter >> 24);
+    out[2] = (uint8_t)(counter >> 16);
+    out[3] = (uint8_t)(counter >> 8);
+    out[4] = (uint8_t)counter;
+
+    uint8_t iv[IV_LEN];
+    makeIv(iv, DIR_DEVICE, counter);
+
+    mbedtls_gcm_context gcm;
+    mbedtls_gcm_init(&gcm);
+    const bool ok = mbedtls_gcm_setkey(&gcm, MBEDTLS_CIPHER_ID_AES, key_, KEY_LEN * 8) == 0 &&
+                    mbedtls_gcm_crypt_and_tag(&gcm, MBEDTLS_GCM_ENCRYPT, len, iv, IV_LEN, out, HEADER_LEN, plain,
+                                              out + HEADER_LEN, TAG_LEN, out + HEADER_LEN + len) == 0;
+    mbedtls_gcm_free(&gcm);
+    if (!ok)
+        return error(out, outSize, Error::Internal);
+    return HEADER_LEN + len + TAG_LEN;
+}
+
+size_t ProvisioningProtocol::error(uint8_t *out, size_t outSize, Error e)
+{
+    if (outSize < 2)
+        return 0;
+    out[0] = FRAME_ERROR;
+    out[1] = (uint8_t)e;
+    return 2;
+}
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <functional>
+
+/**
+ * @file provisioningProtocol.h
+ * @brief Transport-independent secure provisioning session (used over BLE by BleProvisioning).
+ *
+ * No Arduino or BLE dependencies: frames in, frames out, crypto through mbedtls, so the
+ * whole protocol also builds and runs on a host.
+ *
+ * Session setup (X25519 + proof of possession):
+ *   client -> HELLO     [0x01][client public key, 32]
+ *   device <- HELLO_ACK [0x81][device public key, 32]
+ * Both sides compute the X25519 shared secret and derive one AES-256-GCM key with
+ * HKDF-SHA256: salt = SHA-256(PoP), ikm = shared secret,
+ * info = "dhc-prov v1" | client key | device key. The PoP (proof of possession) is the
+ * code shown on the device's display, so only someone who can see the device derives
+ * the right key; an eavesdropper on the BLE link learns nothing about the credentials.
+ *
+ * Encrypted frames, both directions:
+ *   [0x02][counter, 4 BE][ciphertext][tag, 16]
+ * The IV is a direction byte ('C' client, 'D' device), seven zero bytes and the counter;
+ * the 5-byte frame header is authenticated as AAD. Counters start at 1 and must strictly
+ * increase (replays are rejected).
+ *
+ * Plaintext of an encrypted frame is [command][body]:
+ *   SET_CREDENTIALS [0x10] TLVs (tag, length, value): 1 SSID, 2 password, 3 device name
+ *                   -> [0x90][Result]
+ *   GET_STATUS      [0x11] -> [0x91][phase][reason][IPv4, 4]
+ * Errors are sent in clear as [0xFF][Error].
+ *
+ * A frame that fails authentication counts as a wrong PoP; after MAX_AUTH_FAILURES the
+ * session is dropped and HELLO is refused for LOCKOUT_MS, which bounds online guessing.
+ */
+class ProvisioningProtocol
+{
+public:
+    static constexpr size_t KEY_LEN = 32;
+    static constexpr size_t TAG_LEN = 16;
+    static constexpr size_t IV_LEN = 12;
+    static constexpr size_t HEADER_LEN = 5;
+    static constexpr size_t MAX_FRAME = 192;
+    static constexpr size_t MAX_SSID = 32;
+    static constexpr size_t MAX_PASSWORD = 64;
+    static constexpr size_t MAX_DEVICE_NAME = 32;
+    static constexpr uint8_t MAX_AUTH_FAILURES = 3;
+    static constexpr uint32_t LOCKOUT_MS = 30000;
+
+    enum Frame : uint8_t
+    {
+        FRAME_HELLO = 0x01,
+        FRAME_SECURE = 0x02,
+        FRAME_HELLO_ACK = 0x81,
+        FRAME_ERROR = 0xFF
+    };
+
+    enum Command : uint8_t
+    {
+        CMD_SET_CREDENTIALS = 0x10,
+        CMD_GET_STATUS = 0x11,
+        CMD_REPLY = 0x80 // OR-ed into the command of a reply
+    };
+
+    enum Tag : uint8_t
+    {
+        TAG_SSID = 1,
+        TAG_PASSWORD = 2,
+        TAG_DEVICE_NAME = 3
+    };
+
+    enum class Result : uint8_t
+    {
+        Accepted = 0,
+        Busy = 1,
+        Invalid = 2
+    };
+
+    enum class Error : uint8_t
+    {
+        Malformed = 1,
+        NoSession = 2,
+        LockedOut = 3,
+        AuthFailed = 4,
+        Replay = 5,
+        Internal = 6
+    };
+
+    struct Credentials
+    {
+        char ssid[MAX_SSID + 1];
+        char password[MAX_PASSWORD + 1];
+        char deviceName[MAX_DEVICE_NAME + 1];
+    };
+
+    struct Status
+    {
+        uint8_t phase;  // Provisioning::Phase
+        uint8_t reason; // wifi_err_reason_t of a failed trial
+        uint8_t ip[4];  // station address once connected
+    };
+
+    using RandomFn = std::function<void(uint8_t *buf, size_t len)>;
+    using CredentialsFn = std::function<Result(const Credentials &creds)>;
+    using StatusFn = std::function<Status()>;
+
+    ProvisioningProtocol(RandomFn random, CredentialsFn onCredentials, StatusFn status);
+    ~ProvisioningProtocol();
+
+    ProvisioningProtocol(const ProvisioningProtocol &) = delete;
+    ProvisioningProtocol &operator=(const ProvisioningProtocol &) = delete;
+
+    // The code the client must know; an empty PoP refuses every session
+    void setPop(const char *pop, size_t len);
+
+    /**
+     * Handle one frame from the client and write the reply frame to `out`
+     * (MAX_FRAME bytes). Returns the reply length (0: nothing to send).
+     */
+    size_t handle(const uint8_t *in, size_t len, uint8_t *out, size_t outSize, uint32_t nowMs);
+
+    // Forget the session (client disconnected); the key is wiped
+    void reset();
+
+    bool sessionOpen() const { return haveKey_; }
+    uint8_t authFailures() const { return authFailures_; }
+
+private:
+    size_t onHello(const uint8_t *in, size_t len, uint8_t *out, size_t outSize, uint32_t nowMs);
+    size_t onSecure(const uint8_t *in, size_t len, uint8_t *out, size_t outSize, uint32_t nowMs);
+    size_t onCommand(const uint8_t *cmd, size_t len, uint8_t *reply, size_t replySize);
+    size_t seal(const uint8_t *plain, size_t len, uint8_t *out, size_t outSize);
+    bool deriveKey(const uint8_t *shared, const uint8_t *clientPub, const uint8_t *devicePub);
+    static size_t error(uint8_t *out, size_t outSize, Error e);
+
+    RandomFn random_;
+    CredentialsFn onCredentials_;
+    StatusFn status_;
+
+    uint8_t popHash_[32];
+    bool havePop_;
+
+    uint8_t key_[KEY_LEN];
+    bool haveKey_;
+    uint32_t rxCounter_; // last accepted client counter
+    uint32_t txCounter_;
+
+    uint8_t authFailures_;
+    bool locked_;
+    uint32_t lockedAtMs_;
+};
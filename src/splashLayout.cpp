@@ -0,0 +1,231 @@
+/**
+ * @file splashLayout.cpp
+ * @brief Splash font search, glyph-table text measurement and the layout cache.
+ */
+
+#include "splashLayout.h"
+
+// Custom fonts provided by Adafruit GFX (bundled with the library)
+#include <Fonts/FreeSans18pt7b.h>
+#include <Fonts/FreeSans12pt7b.h>
+#include <Fonts/FreeSans9pt7b.h>
+
+constexpr size_t SplashLayoutCache::SIZE;
+
+namespace
+{
+    // Built-in 5x7 font cell including spacing, at text size 1
+    constexpr uint8_t BUILTIN_CHAR_W = 6;
+    constexpr uint8_t BUILTIN_CHAR_H = 8;
+    // Vertical gap between splash title and subtitle
+    constexpr int16_t SPLASH_GAP = 6;
+
+    // Candidate GFX fonts for the splash, largest first. nullptr selects the
+    // built-in font.
+    const GFXfont *const SPLASH_TITLE_FONTS[] = {&FreeSans18pt7b, &FreeSans12pt7b, nullptr};
+    const GFXfont *const SPLASH_SUB_FONTS[] = {&FreeSans9pt7b, nullptr};
+}
+
+// Reads glyph metrics straight from the font's (flash resident) glyph table,
+// so no font switching on the driver is needed.
+TextBounds measureText(const GFXfont *font, const String &text, int16_t width)
+{
+    int16_t x = 0, y = 0;
+    int16_t minx = 0x7FFF, miny = 0x7FFF, maxx = -1, maxy = -1;
+
+    for (size_t i = 0; i < text.length(); ++i)
+    {
+        const char c = text[i];
+        if (c == '\r')
+            continue;
+
+        if (!font)
+        {
+            if (c == '\n' || (x + BUILTIN_CHAR_W) > width)
+            {
+                x = 0;
+                y += BUILTIN_CHAR_H;
+                if (c == '\n')
+                    continue;
+            }
+            minx = min<int16_t>(minx, x);
+            miny = min<int16_t>(miny, y);
+            maxx = max<int16_t>(maxx, x + BUILTIN_CHAR_W - 1);
+            maxy = max<int16_t>(maxy, y + BUILTIN_CHAR_H - 1);
+            x += BUILTIN_CHAR_W;
+            continue;
+        }
+
+        if (c == '\n')
+        {
+            x = 0;
+            y += font->yAdvance;
+            continue;
+        }
+        const uint8_t uc = static_cast<uint8_t>(c);
+        if (uc < font->first || uc > font->last)
+            continue;
+
+        const GFXglyph &g = font->glyph[uc - font->first];
+        if ((x + g.xOffset + g.width) > width)
+        {
+            x = 0;
+            y += font->yAdvance;
+        }
+        const int16_t x1 = x + g.xOffset;
+        const int16_t y1 = y + g.yOffset;
+        minx = min<int16_t>(minx, x1);
+        miny = min<int16_t>(miny, y1);
+        maxx = max<int16_t>(maxx, x1 + g.width - 1);
+        maxy = max<int16_t>(maxy, y1 + g.height - 1);
+        x += g.xAdvance;
+    }
+
+    TextBounds b;
+    if (maxx >= minx)
+    {
+        b.x = minx;
+        b.w = static_cast<uint16_t>(maxx - minx + 1);
+    }
+    if (maxy >= miny)
+    {
+        b.y = miny;
+        b.h = static_cast<uint16_t>(maxy - miny + 1);
+    }
+    return b;
+}
+
+void computeSplashLayout(const String &title, const String &subtitle, uint8_t preferredTitleSize,
+                         uint8_t preferredSubSize, int16_t width, int16_t height, SplashLayout &out)
+{
+    // With preferred built-in sizes only the built-in font is tried here.
+    const bool skipGfx = (preferredTitleSize != 0) || (preferredSubSize != 0);
+    constexpr size_t SUB_FONT_COUNT = sizeof(SPLASH_SUB_FONTS) / sizeof(SPLASH_SUB_FONTS[0]);
+
+    // Subtitle bounds only depend on the subtitle font; measure once per font.
+    TextBounds subBounds[SUB_FONT_COUNT];
+    for (size_t s = 0; s < SUB_FONT_COUNT; ++s)
+    {
+        if (!(skipGfx && SPLASH_SUB_FONTS[s] != nullptr))
+            subBounds[s] = measureText(SPLASH_SUB_FONTS[s], subtitle, width);
+    }
+
+    for (const GFXfont *tfont : SPLASH_TITLE_FONTS)
+    {
+        if (skipGfx && tfont != nullptr)
+            continue;
+        const TextBounds t = measureText(tfont, title, width);
+        for (size_t s = 0; s < SUB_FONT_COUNT; ++s)
+        {
+            if (skipGfx && SPLASH_SUB_FONTS[s] != nullptr)
+                continue;
+            const TextBounds &sb = subBounds[s];
+
+            // Compute centered positions using bounds (account for baseline offsets)
+            const int16_t titleY = (height / 2) - (static_cast<int16_t>(t.h + sb.h + SPLASH_GAP) / 2) - t.y;
+            const int16_t subY = titleY + static_cast<int16_t>(t.h) + SPLASH_GAP - sb.y;
+
+            // Validate vertical fit
+            if (titleY >= 0 && (subY + static_cast<int16_t>(sb.h)) <= height)
+            {
+                out.titleFont = tfont;
+                out.subFont = SPLASH_SUB_FONTS[s];
+                out.titleSize = 1;
+                out.subSize = 1;
+                out.titleX = (width - static_cast<int16_t>(t.w)) / 2 - t.x;
+                out.titleY = titleY;
+                out.subX = (width - static_cast<int16_t>(sb.w)) / 2 - sb.x;
+                out.subY = subY;
+                return;
+            }
+        }
+    }
+
+    // Built-in font sizes (allow larger sizes for title). Decrease until
+    // the text fits (or reach 1).
+    uint8_t titleSize = preferredTitleSize ? preferredTitleSize : 4;
+    int16_t titleW = static_cast<int16_t>(title.length()) * BUILTIN_CHAR_W * titleSize;
+    while (titleSize > 1 && titleW > width)
+    {
+        --titleSize;
+        titleW = static_cast<int16_t>(title.length()) * BUILTIN_CHAR_W * titleSize;
+    }
+
+    uint8_t subSize = preferredSubSize ? preferredSubSize : 2;
+    int16_t subW = static_cast<int16_t>(subtitle.length()) * BUILTIN_CHAR_W * subSize;
+    while (subSize > 1 && subW > width)
+    {
+        --subSize;
+        subW = static_cast<int16_t>(subtitle.length()) * BUILTIN_CHAR_W * subSize;
+    }
+
+    const int16_t titleH = BUILTIN_CHAR_H * titleSize;
+    const int16_t subH = BUILTIN_CHAR_H * subSize;
+    int16_t startY = (height - (titleH + SPLASH_GAP + subH)) / 2;
+    if (startY < 0)
+        startY = 0;
+
+    out.titleFont = nullptr;
+    out.subFont = nullptr;
+    out.titleSize = titleSize;
+    out.subSize = subSize;
+    out.titleX = max<int16_t>(0, (width - titleW) / 2);
+    out.titleY = startY + titleH - 2;
+    out.subX = max<int16_t>(0, (width - subW) / 2);
+    out.subY = startY + titleH + SPLASH_GAP + subH - 2;
+}
+
+const SplashLayout &SplashLayoutCache::get(const String &title, const String &subtitle, uint8_t preferredTitleSize,
+                                           uint8_t preferredSubSize, int16_t width, int16_t height, bool &cached)
+{
+    Inputs inputs;
+    inputs.title = title;
+    inputs.subtitle = subtitle;
+    inputs.titleSize = preferredTitleSize;
+    inputs.subSize = preferredSubSize;
+    inputs.width = width;
+    inputs.height = height;
+    const uint32_t key = keyOf(inputs);
+
+    for (const Entry &e : entries_)
+    {
+        if (e.valid && e.key == key && e.inputs == inputs)
+        {
+            cached = true;
+            return e.layout;
+        }
+    }
+
+    Entry &slot = entries_[next_];
+    next_ = (next_ + 1) % SIZE;
+    slot.key = key;
+    slot.valid = true;
+    slot.inputs = inputs;
+    computeSplashLayout(title, subtitle, preferredTitleSize, preferredSubSize, width, height, slot.layout);
+    cached = false;
+    return slot.layout;
+}
+
+// FNV-1a over the layout inputs (text and size constraints).
+uint32_t SplashLayoutCache::keyOf(const Inputs &in)
+{
+    uint32_t h = 2166136261u;
+    auto mix = [&h](uint8_t b)
+    {
+        h ^= b;
+        h *= 16777619u;
+    };
+    for (size_t i = 0; i < in.title.length(); ++i)
+        mix(static_cast<uint8_t>(in.title[i]));
+    mix(0);
+    for (size_t i = 0; i < in.subtitle.length(); ++i)
+        mix(static_cast<uint8_t>(in.subtitle[i]));
+    mix(0);
+    mix(in.titleSize);
+    mix(in.subSize);
+    mix(in.width & 0xFF);
+    mix(in.width >> 8);
+    mix(in.height & 0xFF);
+    mix(in.height >> 8);
+    return h;
+}
@@ -0,0 +1,89 @@
+#pragma once
+/**
+ * @file splashLayout.h
+ * @brief Font choice and placement for Display::startSplash(), with a small cache.
+ *
+ * Layout is a pure function of the texts, the preferred built-in sizes and the panel
+ * size, so it lives apart from Display and builds on the host (test/native). Text is
+ * measured from the fonts' glyph tables rather than through a driver's
+ * getTextBounds(), which would mean switching fonts on the panel for every candidate.
+ */
+
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+
+// Result of laying out a splash screen; everything needed to render it.
+struct SplashLayout
+{
+    const GFXfont *titleFont = nullptr; // nullptr = built-in font
+    const GFXfont *subFont = nullptr;
+    uint8_t titleSize = 1;
+    uint8_t subSize = 1;
+    int16_t titleX = 0;
+    int16_t titleY = 0;
+    int16_t subX = 0;
+    int16_t subY = 0;
+};
+
+struct TextBounds
+{
+    int16_t x = 0;
+    int16_t y = 0;
+    uint16_t w = 0;
+    uint16_t h = 0;
+};
+
+// Same result as Adafruit_GFX::getTextBounds() from (0, 0) at text size 1 with wrap
+// enabled on a `width` pixel wide panel. `font` nullptr measures the built-in font.
+TextBounds measureText(const GFXfont *font, const String &text, int16_t width);
+
+// Choose fonts and positions for a splash. Prefer large GFX fonts when they fit,
+// otherwise fall back to scaled built-in font sizes. Non-zero `preferredTitleSize` /
+// `preferredSubSize` request built-in sizes, honoured but reduced to fit the width.
+void computeSplashLayout(const String &title, const String &subtitle, uint8_t preferredTitleSize,
+                         uint8_t preferredSubSize, int16_t width, int16_t height, SplashLayout &out);
+
+// Recently used splash layouts, replaced round-robin.
+class SplashLayoutCache
+{
+public:
+    static constexpr size_t SIZE = 4;
+
+    // Layout for these inputs, computed on a miss. `cached` tells which it was.
+    // The reference stays valid until SIZE further misses.
+    const SplashLayout &get(const String &title, const String &subtitle, uint8_t preferredTitleSize,
+                            uint8_t preferredSubSize, int16_t width, int16_t height, bool &cached);
+
+private:
+    // Everything a splash layout depends on
+    struct Inputs
+    {
+        String title;
+        String subtitle;
+        uint8_t titleSize = 0;
+        uint8_t subSize = 0;
+        int16_t width = 0;
+        int16_t height = 0;
+
+        bool operator==(const Inputs &o) const
+        {
+            return titleSize == o.titleSize && subSize == o.subSize && width == o.width && height == o.height &&
+                   title == o.title && subtitle == o.subtitle;
+        }
+    };
+
+    // The hash only filters; a hit also needs equal inputs, so a collision cannot
+    // hand back another text's layout
+    struct Entry
+    {
+        uint32_t key = 0;
+        bool valid = false;
+        Inputs inputs;
+        SplashLayout layout;
+    };
+
+    static uint32_t keyOf(const Inputs &in);
+
+    Entry entries_[SIZE];
+    size_t next_ = 0;
+};
@@ -0,0 +1,204 @@
+/**
+ * @file supervisor.cpp
+ * @brief Heartbeat checking and task watchdog feeding.
+ */
+
+#include "supervisor.h"
+
+#include "esp_idf_version.h"
+#include "esp_task_wdt.h"
+#include "Logger.h"
+
+constexpr Supervisor::ModuleId Supervisor::INVALID_MODULE;
+constexpr uint8_t Supervisor::MAX_MODULES;
+constexpr uint32_t Supervisor::TWDT_TIMEOUT_S;
+constexpr uint32_t Supervisor::CHECK_INTERVAL_MS;
+
+namespace
+{
+    constexpr uint32_t TASK_STACK = 3072;
+    constexpr UBaseType_t TASK_PRIORITY = 5; // above the service task and loop() so neither can starve it
+
+    portMUX_TYPE registerMux = portMUX_INITIALIZER_UNLOCKED;
+}
+
+Supervisor &Supervisor::instance()
+{
+    static Supervisor inst;
+    return inst;
+}
+
+Supervisor::Supervisor()
+    : modules_(), count_(0), paused_(false), healthy_(true), task_(nullptr)
+{
+}
+
+bool Supervisor::begin()
+{
+    if (task_)
+        return true;
+
+#if ESP_IDF_VERSION_MAJOR >= 5
+    esp_task_wdt_config_t cfg = {};
+    cfg.timeout_ms = TWDT_TIMEOUT_S * 1000;
+    cfg.trigger_panic = true;
+    esp_err_t err = esp_task_wdt_reconfigure(&cfg);
+    if (err == ESP_ERR_INVALID_STATE)
+        err = esp_task_wdt_init(&cfg);
+#else
+    // Re-initialising an already running TWDT updates its timeout and panic mode
+    esp_err_t err = esp_task_wdt_init(TWDT_TIMEOUT_S, true);
+#endif
+    if (err != ESP_OK)
+    {
+        Logger::instance().error(String("Supervisor: task watchdog init failed: ") + String((int)err));
+        return false;
+    }
+
+    if (xTaskCreate(&Supervisor::taskEntry, "supervisor", TASK_STACK, this, TASK_PRIORITY, &task_) != pdPASS)
+    {
+        task_ = nullptr;
+        Logger::instance().error("Supervisor: failed to start task");
+        return false;
+    }
+
+    Logger::instance().info(String("Supervisor: watching ") + String(count_.load()) + " modules, watchdog " +
+                            String(TWDT_TIMEOUT_S) + " s");
+    return true;
+}
+
+Supervisor::ModuleId Supervisor::registerModule(const char *name, uint32_t deadlineMs)
+{
+    portENTER_CRITICAL(&registerMux);
+    const uint8_t id = count_.load(std::memory_order_relaxed);
+    if (id >= MAX_MODULES)
+    {
+        portEXIT_CRITICAL(&registerMux);
+        Logger::instance().error(String("Supervisor: no slot for module ") + name);
+        return INVALID_MODULE;
+    }
+    Module &m = modules_[id];
+    m.name = name;
+    m.deadlineMs = deadlineMs;
+    m.lastBeatMs.store((uint32_t)System::instance().monotonicMs(), std::memory_order_relaxed);
+    m.enabled.store(true, std::memory_order_relaxed);
+    count_.store(id + 1, std::memory_order_release);
+    portEXIT_CRITICAL(&registerMux);
+    return id;
+}
+
+void Supervisor::setEnabled(ModuleId id, bool enabled)
+{
+    if (id >= MAX_MODULES)
+        return;
+    heartbeat(id);
+    modules_[id].enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void Supervisor::pause(bool paused)
+{
+    if (!paused)
+    {
+        // Resuming counts as a heartbeat for everyone
+        const uint8_t n = count_.load(std::memory_order_acquire);
+        for (uint8_t i = 0; i < n; ++i)
+            heartbeat(i);
+    }
+    paused_.store(paused, std::memory_order_relaxed);
+    Logger::instance().debug(paused ? "Supervisor: paused" : "Supervisor: resumed");
+}
+
+void Supervisor::taskEntry(void *arg)
+{
+    Supervisor *self = static_cast<Supervisor *>(arg);
+    esp_task_wdt_add(nullptr);
+    for (;;)
+    {
+        self->check();
+        vTaskDelay(pdMS_TO_TICKS(CHECK_INTERVAL_MS));
+    }
+}
+
+void Supervisor::check()
+{
+    if (paused_.load(std::memory_order_relaxed))
+    {
+        esp_task_wdt_reset();
+        return;
+    }
+
+    const uint32_t now = (uint32_t)System::instance().monotonicMs();
+    const uint8_t n = count_.load(std::memory_order_acquire);
+    int culprit = -1;
+    uint32_t oldestAge = 0;
+    String others;
+
+    for (uint8_t i = 0; i < n; ++i)
+    {
+        Module &m = modules_[i];
+        if (!m.enabled.load(std::memory_order_relaxed))
+        {
+            m.stalled = false;
+            continue;
+        }
+        const uint32_t age = now - m.lastBeatMs.load(std::memory_order_relaxed);
+        if (age <= m.deadlineMs)
+        {
+            if (m.stalled)
+                Logger::instance().warn(String("Supervisor: module '") + m.name + "' recovered");
+            m.stalled = false;
+            continue;
+        }
+
+        if (!m.stalled)
+        {
+            m.stalled = true;
+            m.misses++;
+        }
+        // The oldest heartbeat is the blocker; the rest are collateral
+        if (culprit < 0 || age > oldestAge)
+        {
+            if (culprit >= 0)
+                others += String(" ") + modules_[culprit].name;
+            culprit = i;
+            oldestAge = age;
+        }
+        else
+        {
+            others += String(" ") + m.name;
+        }
+    }
+
+    if (culprit < 0)
+    {
+        healthy_.store(true, std::memory_order_relaxed);
+        esp_task_wdt_reset();
+        return;
+    }
+
+    // Stop feeding: the TWDT resets the unit unless the module recovers in time
+    if (healthy_.exchange(false, std::memory_order_relaxed))
+    {
+        const Module &m = modules_[culprit];
+        Logger::instance().error(String("Supervisor: module '") + m.name + "' stalled, no heartbeat for " +
+                                 String(oldestAge) + " ms (deadline " + String(m.deadlineMs) + " ms); watchdog reset in " +
+                                 String(TWDT_TIMEOUT_S) + " s" + (others.length() ? String(", also late:") + others : String("")));
+    }
+}
+
+size_t Supervisor::status(ModuleStatus *out, size_t max) const
+{
+    const uint32_t now = (uint32_t)System::instance().monotonicMs();
+    const uint8_t n = count_.load(std::memory_order_acquire);
+    size_t i = 0;
+    for (; i < n && i < max; ++i)
+    {
+        const Module &m = modules_[i];
+        out[i].name = m.name;
+        out[i].deadlineMs = m.deadlineMs;
+        out[i].ageMs = now - m.lastBeatMs.load(std::memory_order_relaxed);
+        out[i].misses = m.misses;
+        out[i].enabled = m.enabled.load(std::memory_order_relaxed);
+    }
+    return i;
+}
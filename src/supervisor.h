@@ -0,0 +1,90 @@
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "system.h"
+
+/**
+ * @file supervisor.h
+ * @brief Singleton that feeds the hardware task watchdog only while every module is alive.
+ *
+ * Modules (or the loop driving them) register a heartbeat deadline and call heartbeat()
+ * each time they make progress. A dedicated supervisor task wakes every
+ * CHECK_INTERVAL_MS, and if every enabled module has beaten within its deadline it
+ * resets the task watchdog (TWDT). Otherwise it logs which module stalled (the one with
+ * the oldest heartbeat: later modules in the same loop only stop because of it) and
+ * stops feeding, so the TWDT panics and resets the unit TWDT_TIMEOUT_S later. The log
+ * line ends up in the CrashLog record of the next boot.
+ *
+ * heartbeat() is a single relaxed atomic store and may be called from any task.
+ * Register modules from setup(); pause() suspends checking for legitimately long
+ * blocking work (e.g. an OTA transfer, which runs inside ArduinoOTA.handle()).
+ */
+class Supervisor
+{
+public:
+    using ModuleId = uint8_t;
+    static constexpr ModuleId INVALID_MODULE = 0xFF;
+    static constexpr uint8_t MAX_MODULES = 16;
+    static constexpr uint32_t TWDT_TIMEOUT_S = 5;
+    static constexpr uint32_t CHECK_INTERVAL_MS = 1000;
+
+    static Supervisor &instance();
+
+    // Configure the TWDT and start the supervisor task
+    bool begin();
+
+    // Register a module; it must beat at least every deadlineMs. Returns INVALID_MODULE if full.
+    ModuleId registerModule(const char *name, uint32_t deadlineMs);
+
+    void heartbeat(ModuleId id)
+    {
+        if (id < MAX_MODULES)
+            modules_[id].lastBeatMs.store((uint32_t)System::instance().monotonicMs(), std::memory_order_relaxed);
+    }
+
+    // Disabled modules are not checked; enabling counts as a heartbeat
+    void setEnabled(ModuleId id, bool enabled);
+
+    // Suspend/resume all deadline checks (the watchdog keeps being fed while paused)
+    void pause(bool paused);
+    bool paused() const { return paused_.load(std::memory_order_relaxed); }
+
+    struct ModuleStatus
+    {
+        const char *name;
+        uint32_t deadlineMs;
+        uint32_t ageMs; // since the last heartbeat
+        uint32_t misses;
+        bool enabled;
+    };
+    size_t status(ModuleStatus *out, size_t max) const;
+    bool healthy() const { return healthy_.load(std::memory_order_relaxed); }
+
+private:
+    Supervisor();
+    ~Supervisor() = default;
+    Supervisor(const Supervisor &) = delete;
+    Supervisor &operator=(const Supervisor &) = delete;
+
+    struct Module
+    {
+        const char *name = nullptr;
+        uint32_t deadlineMs = 0;
+        std::atomic<uint32_t> lastBeatMs{0}; // low 32 bits of System::monotonicMs()
+        std::atomic<bool> enabled{false};
+        uint32_t misses = 0; // supervisor task only
+        bool stalled = false;
+    };
+
+    static void taskEntry(void *arg);
+    void check();
+
+    Module modules_[MAX_MODULES];
+    std::atomic<uint8_t> count_;
+    std::atomic<bool> paused_;
+    std::atomic<bool> healthy_;
+    TaskHandle_t task_;
+};
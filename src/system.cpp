@@ -1,7 +1,13 @@
-#include "System.h"
+#include "system.h"
 #include "Logger.h"
 #include "esp_system.h"
-#include <limits.h>
+#include "esp_timer.h"
+#include "trace.h"
+#include <time.h>
+
+constexpr int32_t System::MAX_DRIFT_PPB;
+constexpr int64_t System::MIN_DRIFT_WINDOW_US;
+constexpr size_t System::TIMER_CAPACITY;
 
 System &System::instance()
 {
@@ -10,32 +16,174 @@ System &System::instance()
 }
 
 System::System()
-    : startMillis_(millis())
+    : clock_(&esp_timer_get_time), startUs_(0), clockSeq_(0), refWallUs_(0), refMonoUs_(0), driftPpb_(0),
+      source_(TimeSource::None), lastCorrectionUs_(0), lastSyncMonoUs_(0)
 {
+    startUs_ = clock_();
 }
 
 void System::init()
 {
-    startMillis_ = millis();
+    startUs_ = monotonicUs();
 }
 
 uint64_t System::getUptime() const
 {
-    unsigned long now = millis();
-    unsigned long start = startMillis_;
+    return (uint64_t)((monotonicUs() - startUs_) / 1000);
+}
+
+void System::setClockSource(ClockSource source)
+{
+    clock_ = source ? source : &esp_timer_get_time;
+}
+
+int64_t System::monotonicUs() const
+{
+    return clock_();
+}
+
+uint64_t System::timerClock()
+{
+    return instance().monotonicMs();
+}
+
+TimerWheel &System::timers()
+{
+    // Built on first use so the clock (and this singleton) already exist
+    static TimerWheel wheel(TIMER_CAPACITY, &System::timerClock);
+    return wheel;
+}
+
+size_t System::runTimers()
+{
+    TRACE_SCOPE("timers");
+    return timers().advance(monotonicMs());
+}
+
+uint32_t System::msUntilNextTimer()
+{
+    return timers().msUntilNextExpiry(monotonicMs());
+}
+
+int64_t System::now() const
+{
+    return nowAt(monotonicUs());
+}
+
+int64_t System::nowAt(int64_t monoUs) const
+{
+    int64_t wall, mono;
+    int32_t drift;
+    TimeSource src;
+    uint32_t seq;
+    do
+    {
+        seq = clockSeq_.load(std::memory_order_acquire);
+        wall = refWallUs_;
+        mono = refMonoUs_;
+        drift = driftPpb_;
+        src = source_;
+        std::atomic_thread_fence(std::memory_order_acquire);
+    } while ((seq & 1u) || seq != clockSeq_.load(std::memory_order_relaxed));
+
+    if (src == TimeSource::None)
+        return 0;
+    // Split so elapsed * drift cannot overflow after weeks without a sync
+    const int64_t elapsed = monoUs - mono;
+    const int64_t correction = elapsed / 1000000000LL * drift + elapsed % 1000000000LL * drift / 1000000000LL;
+    return wall + elapsed + correction;
+}
+
+bool System::timeValid() const
+{
+    TimeSource s = timeSource();
+    return s == TimeSource::Rtc || s == TimeSource::Ntp;
+}
+
+System::TimeSource System::timeSource() const
+{
+    return source_;
+}
+
+const char *System::timeSourceToString(TimeSource s)
+{
+    switch (s)
+    {
+    case TimeSource::LastKnown:
+        return "last-known";
+    case TimeSource::Rtc:
+        return "rtc";
+    case TimeSource::Ntp:
+        return "ntp";
+    default:
+        return "none";
+    }
+}
+
+bool System::formatIso8601(int64_t wallUs, char *buf, size_t size)
+{
+    if (size < 25)
+        return false;
+    time_t secs = (time_t)(wallUs / 1000000LL);
+    struct tm tm;
+    gmtime_r(&secs, &tm);
+    snprintf(buf, size, "%04d-%02d-%02dT%02d:%02d:%02d.%03dZ",
+             tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec,
+             (int)((wallUs / 1000LL) % 1000LL));
+    return true;
+}
 
-    // compute difference handling 32-bit wrap-around
-    uint64_t diff;
-    if (now >= start)
+void System::setWallClock(int64_t wallUs, int64_t monoUs, TimeSource source)
+{
+    int32_t drift = driftPpb_;
+    if (source == TimeSource::Ntp)
+    {
+        // Drift from two consecutive Ntp references far enough apart
+        if (source_ == TimeSource::Ntp && monoUs - refMonoUs_ >= MIN_DRIFT_WINDOW_US)
+        {
+            const int64_t monoSpan = monoUs - refMonoUs_;
+            const int64_t error = (wallUs - refWallUs_) - monoSpan;
+            // Only errors under 1000 ppm are worth measuring, which also keeps the ppb math in range
+            const bool bounded = error > -monoSpan / 1000 && error < monoSpan / 1000;
+            const int64_t measured = bounded ? error * 1000000LL / (monoSpan / 1000) : 0;
+            if (bounded && measured > -MAX_DRIFT_PPB && measured < MAX_DRIFT_PPB)
+                drift = driftPpb_ == 0 ? (int32_t)measured : (int32_t)((3LL * driftPpb_ + measured) / 4); // smooth
+            else
+                Logger::instance().warn(String("System: ignoring implausible clock drift ") + String((long)(error / (monoSpan / 1000000))) + " ppm");
+        }
+        lastCorrectionUs_ = source_ == TimeSource::None ? 0 : wallUs - nowAt(monoUs);
+        lastSyncMonoUs_ = monoUs;
+    }
+    else if (source < source_)
     {
-        diff = (uint64_t)(now - start);
+        return; // never downgrade a better reference
     }
     else
     {
-        // wrap occurred: (UINT32_MAX - start + 1) + now
-        diff = (uint64_t)((uint64_t)UINT32_MAX - (uint64_t)start + 1ULL + (uint64_t)now);
+        drift = 0;
     }
-    return diff;
+
+    clockSeq_.fetch_add(1, std::memory_order_acq_rel);
+    refWallUs_ = wallUs;
+    refMonoUs_ = monoUs;
+    driftPpb_ = drift;
+    source_ = source;
+    clockSeq_.fetch_add(1, std::memory_order_release);
+}
+
+int32_t System::driftPpb() const
+{
+    return driftPpb_;
+}
+
+int64_t System::lastCorrectionUs() const
+{
+    return lastCorrectionUs_;
+}
+
+int64_t System::lastSyncMonoUs() const
+{
+    return lastSyncMonoUs_;
 }
 
 esp_reset_reason_t System::resetReasonCode() const
@@ -1,22 +1,38 @@
 #pragma once
 
 #include <Arduino.h>
+#include <atomic>
 #include <cstdint>
 #include "esp_system.h"
+#include "timerWheel.h"
 
 /**
  * @file System.h
- * @brief Provides uptime since initialization and reset reason information.
+ * @brief Provides uptime, wall-clock time and reset reason information.
  *
  * Usage:
  *   System::instance().init();                // call early in setup()
  *   uint64_t ms = System::instance().getUptime();
+ *   uint64_t t = System::instance().monotonicMs(); // for timeouts/deadlines
+ *   int64_t us = System::instance().now();    // wall clock, 0 until known
  *   String reason = System::instance().resetReason();
+ *   System::instance().timers().schedule(500, [] { ... }); // deadline callback
  *
  * Notes:
- *  - getUptime() returns ms since init() (or since first construction) and handles
- *    millis() wrap-around. It does not survive deep-sleep resets.
+ *  - monotonicUs()/monotonicMs() are 64-bit and derived from esp_timer, so they never
+ *    wrap in practice; compare deadlines with plain >= (no millis() wrap arithmetic).
+ *    setClockSource() swaps the source (e.g. a fake clock when running off-target).
+ *  - getUptime() returns ms since init() (or since first construction). It does not
+ *    survive deep-sleep resets.
  *  - resetReason() reports the ESP32 SDK reset reason at boot.
+ *  - now() maps the monotonic esp_timer clock to wall time using the last reference
+ *    fed through setWallClock() (TimeSync does this from SNTP). The mapping is read
+ *    under a sequence counter, so the hot path is a timer read plus arithmetic (no
+ *    gettimeofday / locks). Between syncs the measured oscillator drift is applied.
+ *  - timers() is a shared TimerWheel on the monotonic clock. Its callbacks run from
+ *    runTimers() in the service task, so schedule/cancel only from that task (network,
+ *    console, web handlers, other timer callbacks; see taskLayout.h). msUntilNextTimer()
+ *    tells the service loop how long it may sleep.
  */
 class System
 {
@@ -30,6 +46,54 @@ public:
     // Uptime in milliseconds since init/start
     uint64_t getUptime() const;
 
+    // Where the current wall-clock reference came from (in increasing trust)
+    enum class TimeSource : uint8_t
+    {
+        None,      // unknown; now() returns 0
+        LastKnown, // last time persisted before power-off: a lower bound only
+        Rtc,       // carried over a soft reset in RTC memory (off by the reset duration)
+        Ntp        // SNTP
+    };
+
+    // Clock source returning monotonic microseconds; nullptr selects esp_timer_get_time
+    using ClockSource = int64_t (*)();
+    void setClockSource(ClockSource source);
+
+    // Monotonic microseconds / milliseconds since boot
+    int64_t monotonicUs() const;
+    uint64_t monotonicMs() const { return (uint64_t)(monotonicUs() / 1000); }
+
+    // Wall clock in microseconds since the Unix epoch (UTC); 0 if unknown
+    int64_t now() const;
+    int64_t nowAt(int64_t monoUs) const;
+
+    // True once the wall clock is trustworthy (Rtc or Ntp)
+    bool timeValid() const;
+    TimeSource timeSource() const;
+    static const char *timeSourceToString(TimeSource s);
+
+    // Format wall time as ISO 8601 UTC with milliseconds ("2024-01-31T12:34:56.789Z").
+    // buf needs at least 25 bytes; returns false if it is too small.
+    static bool formatIso8601(int64_t wallUs, char *buf, size_t size);
+
+    // Install a wall-clock reference: wallUs was the wall time at monotonic time monoUs.
+    // Consecutive Ntp references update the drift estimate.
+    void setWallClock(int64_t wallUs, int64_t monoUs, TimeSource source);
+
+    // Estimated local clock error in parts per billion (positive: local clock slow)
+    int32_t driftPpb() const;
+    // Prediction error (wall - predicted) at the last Ntp reference, in microseconds
+    int64_t lastCorrectionUs() const;
+    // Monotonic time of the last Ntp reference (0 = never)
+    int64_t lastSyncMonoUs() const;
+
+    // Shared deadline timers (service task only); capacity is fixed at TIMER_CAPACITY
+    TimerWheel &timers();
+    // Fire due timers; call once per service loop iteration
+    size_t runTimers();
+    // Time until the next timer needs service (UINT32_MAX if none)
+    uint32_t msUntilNextTimer();
+
     // Return raw esp reset reason enum
     esp_reset_reason_t resetReasonCode() const;
 
@@ -50,8 +114,24 @@ private:
     System(System &&) = delete;
     System &operator=(System &&) = delete;
 
-    // snapshot of millis() at start
-    volatile unsigned long startMillis_;
+    ClockSource clock_;
+
+    // monotonic time at init()
+    int64_t startUs_;
+
+    // Wall-clock mapping, guarded by a sequence counter (odd while being written)
+    std::atomic<uint32_t> clockSeq_;
+    int64_t refWallUs_;
+    int64_t refMonoUs_;
+    int32_t driftPpb_;
+    TimeSource source_;
+    int64_t lastCorrectionUs_;
+    int64_t lastSyncMonoUs_;
+    static constexpr int32_t MAX_DRIFT_PPB = 500000;      // +-500 ppm: reject anything beyond
+    static constexpr int64_t MIN_DRIFT_WINDOW_US = 60000000; // need >= 60 s between references
+
+    static constexpr size_t TIMER_CAPACITY = 32;
+    static uint64_t timerClock();
 
     // helper to map enum -> string
     static const char *resetReasonToString(esp_reset_reason_t r);
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <Arduino.h>
+#include "freertos/FreeRTOS.h"
+
+/**
+ * @file taskLayout.h
+ * @brief Which FreeRTOS task runs what, on which core, and who owns each singleton.
+ *
+ * Tasks (ESP32-S3, two cores; the WiFi driver and lwIP already live on core 0):
+ *
+ *  | task       | core | prio | period           | runs                                 |
+ *  |------------|------|------|------------------|--------------------------------------|
+ *  | control    | 1    | 10   | 10 ms, fixed     | ControlLoop steps (heater control)   |
+ *  | service    | 0    | 2    | next timer/idle  | timers, network, web, console, OTA   |
+ *  | loopTask   | 1    | 1    | 20 ms            | setup(), then DisplayManager::run()  |
+ *  | supervisor | any  | 5    | 1 s              | heartbeat checks, TWDT feeding       |
+ *  | dns        | 0    | 3    | on datagrams     | CaptiveDns, only while a portal runs |
+ *
+ * The service task runs what loop() used to: System timers, Provisioning,
+ * NetworkController, LinkMonitor, TimeSync, ArduinoOTA/OtaManager, Console,
+ * Config::poll() and Ws, waiting in PowerManager::idle() between passes.
+ *
+ * Network work can only take core 0 time, so web, DNS, mDNS and OTA bursts never delay
+ * the control task; the display's blocking I2C transfers run below it on core 1.
+ *
+ * Ownership (the owning task is the only one allowed to call anything not listed
+ * as cross-task):
+ *  - System: service (timers(), runTimers(), setWallClock()); the clock reads
+ *    (monotonicUs/Ms, now(), getUptime()) may be called from any task.
+ *  - Config: any task (setters/getters are internally locked); poll() from service.
+ *  - NetworkController, LinkMonitor, TimeSync, Provisioning, OtaManager, Ws, WebApi,
+ *    Console, MulticaseDns, OnBoardLed, PowerManager::idle(), CaptiveDns start/stop:
+ *    service; CaptiveDns::stats() from any task.
+ *  - ProvisioningBundle: service (console, Ws, setup for the dropped file).
+ *  - BleProvisioning: start/stop/loop on service; onFrame/onConnect/onDisconnect run in
+ *    the Bluetooth stack's task (core 0) and only hand credentials over to loop().
+ *  - DisplayManager: loopTask owns rendering (run()); post(), showStatus(),
+ *    showStatusAt(), showError() and clearError() may be called from any task (they are
+ *    queued when called from another task); addAmbient() too (the service task adds the
+ *    network screen when provisioning hands over). Display/DisplaySnapshot: loopTask; the
+ *    console's screenshot reads the framebuffer without locking (may tear).
+ *  - ControlLoop: steps run on control; jitter() / resetJitter() from any task.
+ *  - Logger: any task; the service task prints, other tasks' lines reach it through a
+ *    lock-free queue (lockFreeQueue.h).
+ *  - CrashLog::recordLine(), Supervisor::heartbeat(), PowerManager wake locks and
+ *    noteActivity(), FixedBlockPool / MemoryAccounting / BufferAllocator: any task.
+ *  - HeapMonitor: service (sampled from System::timers()).
+ *  - FileSystem: service and setup (LittleFS serialises internally, but change
+ *    callbacks run in the caller's task).
+ *
+ * setup() runs on loopTask before the other tasks exist, so it may touch everything.
+ */
+namespace TaskLayout
+{
+    constexpr BaseType_t CONTROL_CORE = 1;
+    constexpr UBaseType_t CONTROL_PRIORITY = 10;
+    constexpr uint32_t CONTROL_STACK = 4096;
+    constexpr uint32_t CONTROL_PERIOD_MS = 10;
+
+    constexpr BaseType_t SERVICE_CORE = 0;
+    constexpr UBaseType_t SERVICE_PRIORITY = 2;
+    constexpr uint32_t SERVICE_STACK = 8192; // same as the Arduino loop task it replaces
+
+    constexpr uint32_t DISPLAY_PERIOD_MS = 20;
+
+    // Above service so a probe burst is answered before the web server runs
+    constexpr BaseType_t DNS_CORE = 0;
+    constexpr UBaseType_t DNS_PRIORITY = 3;
+    constexpr uint32_t DNS_STACK = 3072;
+}
@@ -0,0 +1,195 @@
+/**
+ * @file timeSync.cpp
+ * @brief SNTP client glue and last-known time persistence (RTC memory + NVS).
+ */
+
+#include "timeSync.h"
+
+#include <WiFi.h>
+#include <Preferences.h>
+#include <sys/time.h>
+#include "esp_attr.h"
+#include "esp_sntp.h"
+#include "Logger.h"
+#include "system.h"
+#include "config.h"
+#include "trace.h"
+
+constexpr uint32_t TimeSync::SYNC_INTERVAL_MS;
+constexpr uint32_t TimeSync::PERSIST_INTERVAL_MS;
+constexpr uint32_t TimeSync::RTC_UPDATE_MS;
+
+namespace
+{
+    constexpr const char *PREFS_NAMESPACE = "time";
+    constexpr const char *PREFS_WALL_KEY = "wall";
+    constexpr uint32_t RTC_MAGIC = 0x54494D45; // "TIME"
+    constexpr time_t MIN_VALID_EPOCH = 1577836800; // 2020-01-01
+
+    // Survives soft resets (panic, watchdog, reboot), not power loss
+    struct RtcClock
+    {
+        uint32_t magic;
+        int64_t wallUs;
+        uint32_t check;
+    };
+    RTC_NOINIT_ATTR RtcClock rtcClock;
+
+    uint32_t rtcCheck(const RtcClock &c)
+    {
+        return c.magic ^ (uint32_t)c.wallUs ^ (uint32_t)((uint64_t)c.wallUs >> 32);
+    }
+
+    void setLibcTime(int64_t wallUs)
+    {
+        struct timeval tv;
+        tv.tv_sec = (time_t)(wallUs / 1000000LL);
+        tv.tv_usec = (suseconds_t)(wallUs % 1000000LL);
+        settimeofday(&tv, nullptr);
+    }
+}
+
+TimeSync &TimeSync::instance()
+{
+    static TimeSync inst;
+    return inst;
+}
+
+TimeSync::TimeSync()
+    : sntpRunning_(false), server_(), pending_(false), pendingWallUs_(0), pendingMonoUs_(0),
+      syncCount_(0), lastPersistMs_(0), lastRtcMs_(0)
+{
+}
+
+void TimeSync::begin()
+{
+    System &sys = System::instance();
+    const esp_reset_reason_t reason = sys.resetReasonCode();
+    const bool softReset = reason != ESP_RST_POWERON && reason != ESP_RST_BROWNOUT && reason != ESP_RST_UNKNOWN;
+
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    if (reason == ESP_RST_DEEPSLEEP && rtcClock.magic == RTC_MAGIC && tv.tv_sec > MIN_VALID_EPOCH)
+    {
+        // libc time ran on the RTC timer through deep sleep; RTC copy only proves it was set
+        const int64_t wall = (int64_t)tv.tv_sec * 1000000LL + tv.tv_usec;
+        sys.setWallClock(wall, sys.monotonicUs(), System::TimeSource::Rtc);
+    }
+    else if (softReset && rtcClock.magic == RTC_MAGIC && rtcClock.check == rtcCheck(rtcClock))
+    {
+        // Time at the last RTC update plus the time since this boot started
+        const int64_t mono = sys.monotonicUs();
+        const int64_t wall = rtcClock.wallUs + mono;
+        sys.setWallClock(wall, mono, System::TimeSource::Rtc);
+        setLibcTime(wall);
+    }
+    else
+    {
+        Preferences prefs;
+        if (prefs.begin(PREFS_NAMESPACE, true))
+        {
+            uint64_t secs = prefs.getULong64(PREFS_WALL_KEY, 0);
+            prefs.end();
+            if (secs > 0)
+            {
+                sys.setWallClock((int64_t)secs * 1000000LL, sys.monotonicUs(), System::TimeSource::LastKnown);
+                setLibcTime((int64_t)secs * 1000000LL);
+            }
+        }
+    }
+
+    if (sys.timeSource() != System::TimeSource::None)
+    {
+        char buf[32];
+        System::formatIso8601(sys.now(), buf, sizeof(buf));
+        Logger::instance().info(String("TimeSync: restored ") + buf + " (" +
+                                System::timeSourceToString(sys.timeSource()) + ")");
+    }
+}
+
+void TimeSync::onSntpSync(struct timeval *tv)
+{
+    TimeSync &self = instance();
+    self.pendingMonoUs_ = System::instance().monotonicUs();
+    self.pendingWallUs_ = (int64_t)tv->tv_sec * 1000000LL + tv->tv_usec;
+    self.pending_.store(true, std::memory_order_release);
+}
+
+void TimeSync::startSntp()
+{
+    server_ = Config::instance().getNtpServer();
+    sntp_setoperatingmode(SNTP_OPMODE_POLL);
+    sntp_setservername(0, server_.c_str());
+    sntp_set_sync_interval(SYNC_INTERVAL_MS);
+    sntp_set_time_sync_notification_cb(&TimeSync::onSntpSync);
+    sntp_init();
+    sntpRunning_ = true;
+    Logger::instance().info(String("TimeSync: SNTP started, server ") + server_);
+}
+
+void TimeSync::resync()
+{
+    if (sntpRunning_)
+    {
+        sntp_stop();
+        sntpRunning_ = false;
+    }
+    if (WiFi.status() == WL_CONNECTED)
+        startSntp();
+}
+
+void TimeSync::loop()
+{
+    TRACE_SCOPE("time");
+    System &sys = System::instance();
+    const uint64_t nowMs = sys.monotonicMs();
+
+    if (!sntpRunning_ && WiFi.status() == WL_CONNECTED)
+        startSntp();
+
+    if (pending_.exchange(false, std::memory_order_acquire))
+    {
+        const int64_t wall = pendingWallUs_;
+        const bool first = syncCount_ == 0;
+        sys.setWallClock(wall, pendingMonoUs_, System::TimeSource::Ntp);
+        syncCount_++;
+
+        char buf[32];
+        System::formatIso8601(wall, buf, sizeof(buf));
+        Logger::instance().info(String("TimeSync: ") + (first ? "synced " : "resynced ") + buf +
+                                ", correction " + String((long)(sys.lastCorrectionUs() / 1000)) + " ms, drift " +
+                                String((long)(sys.driftPpb() / 1000)) + " ppm");
+        if (first)
+            persist(wall);
+    }
+
+    if (sys.timeSource() == System::TimeSource::None)
+        return;
+
+    if (nowMs - lastRtcMs_ >= RTC_UPDATE_MS)
+    {
+        lastRtcMs_ = nowMs;
+        if (sys.timeValid())
+        {
+            rtcClock.magic = RTC_MAGIC;
+            rtcClock.wallUs = sys.now();
+            rtcClock.check = rtcCheck(rtcClock);
+        }
+    }
+
+    if (sys.timeValid() && nowMs - lastPersistMs_ >= PERSIST_INTERVAL_MS)
+        persist(sys.now());
+}
+
+void TimeSync::persist(int64_t wallUs)
+{
+    lastPersistMs_ = System::instance().monotonicMs();
+    Preferences prefs;
+    if (!prefs.begin(PREFS_NAMESPACE, false))
+    {
+        Logger::instance().warn("TimeSync: cannot open NVS");
+        return;
+    }
+    prefs.putULong64(PREFS_WALL_KEY, (uint64_t)(wallUs / 1000000LL));
+    prefs.end();
+}
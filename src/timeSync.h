@@ -0,0 +1,63 @@
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+
+/**
+ * @file timeSync.h
+ * @brief Singleton that keeps System's wall clock set: SNTP while online, persisted time otherwise.
+ *
+ * Lifecycle:
+ *  - begin() (early in setup): restore the last-known time so logs and schedules have a
+ *    clock before the network is up. After deep sleep the libc clock (kept on the RTC
+ *    timer) is still valid; after a soft reset the time carried in RTC memory
+ *    is used (accurate to about the reset duration); after a power cycle only the time
+ *    persisted in NVS is available, which is a lower bound (TimeSource::LastKnown).
+ *  - loop(): starts SNTP (server from Config::getNtpServer()) once the station has an IP,
+ *    hands each sync to System::setWallClock() (which tracks drift), keeps the RTC copy
+ *    fresh every second and writes NVS at most once per PERSIST_INTERVAL_MS.
+ *
+ * The SNTP callback runs in the lwIP task and only stores the sample; all processing
+ * happens in loop(). For bench tests point the server at scripts/ntp_standin.py.
+ */
+class TimeSync
+{
+public:
+    static TimeSync &instance();
+
+    void begin();
+    void loop();
+
+    // Restart SNTP, picking up a changed server from Config
+    void resync();
+
+    bool synced() const { return syncCount_ > 0; }
+    uint32_t syncCount() const { return syncCount_; }
+    const String &server() const { return server_; }
+
+    static constexpr uint32_t SYNC_INTERVAL_MS = 60UL * 60UL * 1000UL;
+    static constexpr uint32_t PERSIST_INTERVAL_MS = 60UL * 60UL * 1000UL;
+    static constexpr uint32_t RTC_UPDATE_MS = 1000;
+
+private:
+    TimeSync();
+    ~TimeSync() = default;
+    TimeSync(const TimeSync &) = delete;
+    TimeSync &operator=(const TimeSync &) = delete;
+
+    static void onSntpSync(struct timeval *tv);
+    void startSntp();
+    void persist(int64_t wallUs);
+
+    bool sntpRunning_;
+    String server_; // must outlive SNTP: lwIP keeps the pointer
+
+    // Written by the SNTP callback, consumed by loop()
+    std::atomic<bool> pending_;
+    volatile int64_t pendingWallUs_;
+    volatile int64_t pendingMonoUs_;
+
+    uint32_t syncCount_;
+    uint64_t lastPersistMs_;
+    uint64_t lastRtcMs_;
+};
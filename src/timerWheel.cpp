@@ -0,0 +1,282 @@
+/**
+ * @file timerWheel.cpp
+ * @brief Implementation of the hierarchical timer wheel.
+ *
+ * Placement: a timer due at tick e, scheduled at tick t, goes to level l, the lowest
+ * level with e - t < 64^(l+1), in slot (e >> 6l) & 63. Level l > 0 slots are cascaded
+ * (re-placed one level down) when the tick enters their block, i.e. when the lower
+ * index wraps to 0, which is always before any of their timers is due.
+ */
+
+#include "timerWheel.h"
+
+constexpr uint8_t TimerWheel::LEVELS;
+constexpr uint8_t TimerWheel::SLOT_BITS;
+constexpr uint16_t TimerWheel::SLOTS;
+constexpr uint16_t TimerWheel::SLOT_MASK;
+constexpr int16_t TimerWheel::NIL;
+
+namespace
+{
+    // Range covered by levels 0..3 (64^4 ms ~ 4.6 h)
+    constexpr uint64_t WHEEL_SPAN = 1ULL << 24;
+}
+
+TimerWheel::TimerWheel(size_t capacity, Clock clock, uint64_t nowMs)
+    : nodes_(capacity > 32767 ? 32767 : capacity), freeHead_(NIL), count_(0),
+      tick_(clock ? clock() : nowMs), clock_(clock), firing_(NIL), firingCancelled_(false)
+{
+    for (auto &level : heads_)
+        for (auto &h : level)
+            h = NIL;
+
+    for (int16_t i = (int16_t)nodes_.size() - 1; i >= 0; --i)
+    {
+        nodes_[i].gen = 1;
+        nodes_[i].next = freeHead_;
+        freeHead_ = i;
+    }
+}
+
+TimerWheel::TimerId TimerWheel::schedule(uint32_t delayMs, Callback cb)
+{
+    return add(delayMs, 0, std::move(cb));
+}
+
+TimerWheel::TimerId TimerWheel::schedulePeriodic(uint32_t periodMs, Callback cb, int32_t firstDelayMs)
+{
+    if (periodMs == 0)
+        return 0;
+    return add(firstDelayMs < 0 ? periodMs : (uint32_t)firstDelayMs, periodMs, std::move(cb));
+}
+
+TimerWheel::TimerId TimerWheel::add(uint32_t delayMs, uint32_t period, Callback cb)
+{
+    if (freeHead_ == NIL || !cb)
+        return 0;
+
+    // Measure from the real clock: the wheel may lag if advance() has not run for a while
+    uint64_t base = clock_ ? clock_() : tick_;
+    if (base < tick_)
+        base = tick_;
+    const uint64_t expiry = base + (delayMs == 0 ? 1 : delayMs);
+
+    const int16_t idx = freeHead_;
+    Node &n = nodes_[idx];
+    freeHead_ = n.next;
+
+    n.expiry = expiry;
+    n.period = period;
+    n.cb = std::move(cb);
+    place(idx);
+    return ((TimerId)n.gen << 16) | (TimerId)(idx + 1);
+}
+
+int16_t TimerWheel::resolve(TimerId id) const
+{
+    const uint32_t slot = id & 0xFFFF;
+    if (slot == 0 || slot > nodes_.size())
+        return NIL;
+    const int16_t idx = (int16_t)(slot - 1);
+    if (nodes_[idx].gen != (uint16_t)(id >> 16))
+        return NIL;
+    return idx;
+}
+
+bool TimerWheel::cancel(TimerId id)
+{
+    const int16_t idx = resolve(id);
+    if (idx == NIL)
+        return false;
+
+    if (idx == firing_)
+    {
+        // Cancelled from its own callback: advance() releases it afterwards
+        const bool wasLive = !firingCancelled_;
+        firingCancelled_ = true;
+        return wasLive;
+    }
+    if (!nodes_[idx].pending)
+        return false;
+
+    unlink(idx);
+    release(idx);
+    return true;
+}
+
+bool TimerWheel::isPending(TimerId id) const
+{
+    const int16_t idx = resolve(id);
+    if (idx == NIL)
+        return false;
+    if (idx == firing_)
+        return !firingCancelled_ && nodes_[idx].period != 0;
+    return nodes_[idx].pending;
+}
+
+void TimerWheel::place(int16_t idx)
+{
+    Node &n = nodes_[idx];
+    uint64_t e = n.expiry < tick_ ? tick_ : n.expiry;
+    const uint64_t delta = e - tick_;
+
+    uint8_t level = 0;
+    if (delta >= WHEEL_SPAN)
+    {
+        // Park at the far end of the top level; re-placed when that slot cascades
+        e = tick_ + WHEEL_SPAN - 1;
+        level = LEVELS - 1;
+    }
+    else
+    {
+        while (level < LEVELS - 1 && delta >= (1ULL << (SLOT_BITS * (level + 1))))
+            level++;
+    }
+
+    const uint8_t slot = (uint8_t)((e >> (SLOT_BITS * level)) & SLOT_MASK);
+    n.level = level;
+    n.slot = slot;
+    n.prev = NIL;
+    n.next = heads_[level][slot];
+    if (n.next != NIL)
+        nodes_[n.next].prev = idx;
+    heads_[level][slot] = idx;
+    n.pending = true;
+    count_++;
+}
+
+void TimerWheel::unlink(int16_t idx)
+{
+    Node &n = nodes_[idx];
+    if (n.prev != NIL)
+        nodes_[n.prev].next = n.next;
+    else
+        heads_[n.level][n.slot] = n.next;
+    if (n.next != NIL)
+        nodes_[n.next].prev = n.prev;
+    n.prev = n.next = NIL;
+    n.pending = false;
+    count_--;
+}
+
+void TimerWheel::release(int16_t idx)
+{
+    Node &n = nodes_[idx];
+    n.cb = nullptr;
+    n.gen = (uint16_t)(n.gen + 1 == 0 ? 1 : n.gen + 1); // stale ids stop resolving
+    n.next = freeHead_;
+    freeHead_ = idx;
+}
+
+void TimerWheel::cascade(uint8_t level)
+{
+    const uint8_t slot = (uint8_t)((tick_ >> (SLOT_BITS * level)) & SLOT_MASK);
+    int16_t idx = heads_[level][slot];
+    heads_[level][slot] = NIL;
+    while (idx != NIL)
+    {
+        const int16_t next = nodes_[idx].next;
+        count_--; // place() counts it again
+        place(idx);
+        idx = next;
+    }
+}
+
+/**
+ * Absolute tick of the next thing advance() has to do: an expiry in level 0 or a
+ * cascade of a non-empty higher-level slot. UINT64_MAX if the wheel is empty.
+ */
+uint64_t TimerWheel::nextEventTick() const
+{
+    if (count_ == 0)
+        return UINT64_MAX;
+
+    uint64_t best = UINT64_MAX;
+    for (uint16_t k = 1; k <= SLOTS; ++k)
+    {
+        const uint64_t t = tick_ + k;
+        if (heads_[0][t & SLOT_MASK] != NIL)
+        {
+            best = t;
+            break;
+        }
+    }
+    for (uint8_t level = 1; level < LEVELS; ++level)
+    {
+        const uint8_t shift = SLOT_BITS * level;
+        const uint64_t block = tick_ >> shift;
+        for (uint16_t k = 1; k <= SLOTS; ++k)
+        {
+            const uint64_t b = block + k;
+            if ((b << shift) >= best)
+                break;
+            if (heads_[level][b & SLOT_MASK] != NIL)
+            {
+                best = b << shift;
+                break;
+            }
+        }
+    }
+    return best;
+}
+
+uint32_t TimerWheel::msUntilNextExpiry(uint64_t nowMs) const
+{
+    const uint64_t next = nextEventTick();
+    if (next == UINT64_MAX)
+        return UINT32_MAX;
+    if (next <= nowMs)
+        return 0;
+    const uint64_t d = next - nowMs;
+    return d >= UINT32_MAX ? UINT32_MAX - 1 : (uint32_t)d;
+}
+
+size_t TimerWheel::advance(uint64_t nowMs)
+{
+    size_t fired = 0;
+    while (tick_ < nowMs)
+    {
+        // Skip idle stretches: nothing happens before the next event
+        const uint64_t next = nextEventTick();
+        if (next > nowMs)
+        {
+            tick_ = nowMs;
+            break;
+        }
+        tick_ = next;
+        for (uint8_t level = 1; level < LEVELS; ++level)
+        {
+            if ((tick_ & ((1ULL << (SLOT_BITS * level)) - 1)) != 0)
+                break;
+            cascade(level);
+        }
+
+        int16_t &head = heads_[0][tick_ & SLOT_MASK];
+        while (head != NIL)
+        {
+            const int16_t idx = head;
+            Node &n = nodes_[idx];
+            unlink(idx);
+
+            firing_ = idx;
+            firingCancelled_ = false;
+            n.cb();
+            firing_ = NIL;
+            fired++;
+
+            if (n.period != 0 && !firingCancelled_)
+            {
+                n.expiry += n.period;
+                // Fell behind (advance() came late): skip the missed periods, keep the phase
+                if (n.expiry <= nowMs)
+                    n.expiry += ((nowMs - n.expiry) / n.period + 1) * n.period;
+                place(idx);
+            }
+            else
+            {
+                release(idx);
+            }
+        }
+    }
+    return fired;
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <Arduino.h>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+/**
+ * @file timerWheel.h
+ * @brief Hierarchical timer wheel: O(1) schedule/cancel over a fixed pool, dispatched from loop().
+ *
+ * Four levels of 64 slots with a 1 ms tick cover ~4.6 h directly (64 ms, 4 s, 4.4 min,
+ * 4.6 h per level); longer delays are parked in the top level and re-cascaded. A timer
+ * lives in exactly one slot list (intrusive, index-linked), so scheduling and cancelling
+ * never search. Expiries are processed in order by advance(), which fires callbacks
+ * from the caller's context; callbacks may schedule or cancel timers (including their own).
+ *
+ * The pool is allocated once in the constructor; schedule() returns 0 when it is full.
+ * Timer ids carry a generation so cancelling an id that already fired (and whose slot
+ * was reused) is a harmless no-op.
+ *
+ * Not thread-safe: use from one task (the main loop; see System::timers()).
+ */
+class TimerWheel
+{
+public:
+    using TimerId = uint32_t; // 0 = invalid
+    using Callback = std::function<void()>;
+    using Clock = uint64_t (*)(); // current time in ms
+
+    // clock: delays are measured from clock() when given, otherwise from the last advance()
+    explicit TimerWheel(size_t capacity, Clock clock = nullptr, uint64_t nowMs = 0);
+
+    // One-shot timer firing delayMs from now (0 = next tick)
+    TimerId schedule(uint32_t delayMs, Callback cb);
+
+    // Periodic timer: first fires after periodMs (or firstDelayMs if given), then every periodMs.
+    // When advance() runs late, periods that were missed entirely are skipped, not replayed.
+    TimerId schedulePeriodic(uint32_t periodMs, Callback cb, int32_t firstDelayMs = -1);
+
+    // Cancel a pending timer; returns false if it is not pending (already fired / unknown)
+    bool cancel(TimerId id);
+    bool isPending(TimerId id) const;
+
+    // Advance to nowMs and fire everything due, in expiry order. Returns the number fired.
+    size_t advance(uint64_t nowMs);
+
+    // Lower bound on the time until the next expiry (0 = due now, UINT32_MAX = none).
+    // Exact for timers within 64 ms; for later ones it is the next cascade point.
+    uint32_t msUntilNextExpiry(uint64_t nowMs) const;
+
+    size_t size() const { return count_; }
+    size_t capacity() const { return nodes_.size(); }
+    uint64_t now() const { return tick_; }
+
+private:
+    static constexpr uint8_t LEVELS = 4;
+    static constexpr uint8_t SLOT_BITS = 6;
+    static constexpr uint16_t SLOTS = 1u << SLOT_BITS;
+    static constexpr uint16_t SLOT_MASK = SLOTS - 1;
+    static constexpr int16_t NIL = -1;
+
+    struct Node
+    {
+        uint64_t expiry = 0;
+        uint32_t period = 0; // 0 = one-shot
+        uint16_t gen = 0;
+        int16_t prev = NIL;
+        int16_t next = NIL;
+        uint8_t level = 0;
+        uint8_t slot = 0;
+        bool pending = false;
+        Callback cb;
+    };
+
+    TimerId add(uint32_t delayMs, uint32_t period, Callback cb);
+    uint64_t nextEventTick() const;
+    int16_t resolve(TimerId id) const;
+    void place(int16_t idx);
+    void unlink(int16_t idx);
+    void release(int16_t idx);
+    void cascade(uint8_t level);
+
+    std::vector<Node> nodes_;
+    int16_t heads_[LEVELS][SLOTS];
+    int16_t freeHead_;
+    size_t count_;
+    uint64_t tick_; // last processed ms
+    Clock clock_;
+
+    // Timer whose callback is running, and whether it cancelled itself
+    int16_t firing_;
+    bool firingCancelled_;
+};
@@ -0,0 +1,146 @@
+/**
+ * @file trace.cpp
+ * @brief Trace ring allocation, span name registry and Chrome trace export.
+ */
+
+#include "trace.h"
+
+#include "bufferAllocator.h"
+#include "Logger.h"
+
+constexpr size_t Trace::EVENTS_PER_CORE;
+constexpr uint16_t Trace::MAX_NAMES;
+constexpr uint8_t Trace::CORES;
+
+namespace
+{
+    portMUX_TYPE namesMux = portMUX_INITIALIZER_UNLOCKED;
+
+    static_assert((Trace::EVENTS_PER_CORE & (Trace::EVENTS_PER_CORE - 1)) == 0, "EVENTS_PER_CORE must be a power of two");
+}
+
+Trace &Trace::instance()
+{
+    static Trace inst;
+    return inst;
+}
+
+Trace::Trace()
+    : rings_(), recording_(false), names_(), nameCount_(1)
+{
+    // Id 0 catches spans recorded after the name table filled up
+    names_[0] = "(other)";
+}
+
+bool Trace::begin()
+{
+    if (!compiledIn())
+        return false;
+    if (rings_[0].events)
+        return true;
+
+    // Internal SRAM: spans are recorded from anywhere, including while PSRAM is busy
+    const MemoryAccounting::ModuleId mod = MemoryAccounting::instance().registerModule("trace");
+    for (uint8_t c = 0; c < CORES; ++c)
+    {
+        rings_[c].events = static_cast<Event *>(
+            BufferAllocator::instance().allocate(EVENTS_PER_CORE * sizeof(Event), BufferAllocator::Placement::Internal, mod));
+        if (!rings_[c].events)
+        {
+            Logger::instance().error("Trace: no memory for trace rings");
+            for (uint8_t k = 0; k < c; ++k)
+            {
+                BufferAllocator::instance().release(rings_[k].events);
+                rings_[k].events = nullptr;
+            }
+            return false;
+        }
+    }
+    recording_.store(true, std::memory_order_relaxed);
+    Logger::instance().info(String("Trace: recording ") + String((unsigned)EVENTS_PER_CORE) + " spans per core");
+    return true;
+}
+
+void Trace::setRecording(bool on)
+{
+    recording_.store(on && rings_[0].events != nullptr, std::memory_order_relaxed);
+}
+
+void Trace::clear()
+{
+    for (uint8_t c = 0; c < CORES; ++c)
+        rings_[c].head.store(0, std::memory_order_relaxed);
+}
+
+Trace::NameId Trace::nameId(const char *name)
+{
+    portENTER_CRITICAL(&namesMux);
+    for (uint16_t i = 1; i < nameCount_; ++i)
+    {
+        if (names_[i] == name || strcmp(names_[i], name) == 0)
+        {
+            portEXIT_CRITICAL(&namesMux);
+            return i;
+        }
+    }
+    NameId id = 0;
+    if (nameCount_ < MAX_NAMES)
+    {
+        id = nameCount_++;
+        names_[id] = name;
+    }
+    portEXIT_CRITICAL(&namesMux);
+    return id;
+}
+
+size_t Trace::eventCount() const
+{
+    size_t n = 0;
+    for (uint8_t c = 0; c < CORES; ++c)
+        n += min<size_t>(rings_[c].head.load(std::memory_order_relaxed), EVENTS_PER_CORE);
+    return n;
+}
+
+size_t Trace::writeChromeJson(Print &out)
+{
+    size_t written = out.print(F("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["));
+    char buf[160];
+
+    // One track per core
+    for (uint8_t c = 0; c < CORES; ++c)
+    {
+        snprintf(buf, sizeof(buf), "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"core %u\"}}",
+                 c ? "," : "", (unsigned)c, (unsigned)c);
+        written += out.print(buf);
+    }
+
+    if (rings_[0].events)
+    {
+        // Pause so the rings hold still; give spans already being stored a tick to land
+        const bool wasRecording = recording_.exchange(false, std::memory_order_relaxed);
+        vTaskDelay(1);
+
+        // Spans carry the low 32 bits of esp_timer; rebuild full timestamps relative to now
+        const int64_t now64 = esp_timer_get_time();
+        const uint32_t now32 = (uint32_t)now64;
+        for (uint8_t c = 0; c < CORES; ++c)
+        {
+            const Ring &r = rings_[c];
+            const uint32_t head = r.head.load(std::memory_order_relaxed);
+            const uint32_t count = min<uint32_t>(head, EVENTS_PER_CORE);
+            for (uint32_t k = head - count; k != head; ++k)
+            {
+                const Event &e = r.events[k & (EVENTS_PER_CORE - 1)];
+                const int64_t ts = now64 - (int64_t)(uint32_t)(now32 - e.startUs);
+                snprintf(buf, sizeof(buf), ",{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%lld,\"dur\":%lu}",
+                         e.name < nameCount_ ? names_[e.name] : names_[0], (unsigned)c, (long long)ts, (unsigned long)e.durUs);
+                written += out.print(buf);
+            }
+        }
+
+        recording_.store(wasRecording, std::memory_order_relaxed);
+    }
+
+    written += out.print(F("]}"));
+    return written;
+}
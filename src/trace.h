@@ -0,0 +1,133 @@
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+
+/**
+ * @file trace.h
+ * @brief Scoped trace spans in per-core ring buffers, exported as Chrome trace JSON.
+ *
+ *   void NetworkController::loop()
+ *   {
+ *       TRACE_SCOPE("network");
+ *       ...
+ *   }
+ *
+ * Each TRACE_SCOPE resolves its name to a small id once (function-local static) and
+ * records one complete span (start, duration, name id) when the scope ends. Spans go
+ * into a ring per CPU core; a slot is claimed with one atomic increment on that ring,
+ * so recording takes no lock and costs two esp_timer reads plus a 12-byte store
+ * (the console's "trace bench [n]" times it on the device; test/native/test_trace on
+ * the host). Rings overwrite their oldest spans.
+ *
+ * writeChromeJson() emits the rings in the Chrome trace event format (one track per
+ * core), which chrome://tracing and ui.perfetto.dev open directly. It is served at
+ * GET /api/trace and printed by the console's "trace dump". Recording pauses while a
+ * dump runs.
+ *
+ * Tracing is compiled in only with DHC_TRACE_ENABLED=1 (see the -trace environment
+ * in platformio.ini). Otherwise TRACE_SCOPE expands to nothing and the API reports
+ * that tracing is unavailable.
+ */
+
+#ifndef DHC_TRACE_ENABLED
+#define DHC_TRACE_ENABLED 0
+#endif
+
+class Trace
+{
+public:
+    using NameId = uint16_t;
+
+    static constexpr size_t EVENTS_PER_CORE = 1024; // power of two
+    static constexpr uint16_t MAX_NAMES = 64;
+    static constexpr uint8_t CORES = portNUM_PROCESSORS;
+
+    static Trace &instance();
+
+    // Allocate the rings and start recording; false when compiled out or out of memory
+    bool begin();
+
+    static constexpr bool compiledIn() { return DHC_TRACE_ENABLED != 0; }
+    bool recording() const { return recording_.load(std::memory_order_relaxed); }
+    void setRecording(bool on);
+    void clear();
+
+    // Id for a span name (registered on first use); the string must outlive the program
+    NameId nameId(const char *name);
+
+    // Spans currently held, over all cores
+    size_t eventCount() const;
+
+    // Chrome trace event JSON; returns bytes written
+    size_t writeChromeJson(Print &out);
+
+    static uint32_t nowUs() { return (uint32_t)esp_timer_get_time(); }
+
+    void record(NameId id, uint32_t startUs, uint32_t durUs)
+    {
+        if (!recording_.load(std::memory_order_relaxed))
+            return;
+        Ring &r = rings_[xPortGetCoreID()];
+        const uint32_t i = r.head.fetch_add(1, std::memory_order_relaxed);
+        Event &e = r.events[i & (EVENTS_PER_CORE - 1)];
+        e.startUs = startUs;
+        e.durUs = durUs;
+        e.name = id;
+    }
+
+    class Scope
+    {
+    public:
+        explicit Scope(NameId id) : id_(id), startUs_(nowUs()) {}
+        ~Scope() { Trace::instance().record(id_, startUs_, nowUs() - startUs_); }
+
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+
+    private:
+        NameId id_;
+        uint32_t startUs_;
+    };
+
+private:
+    Trace();
+    ~Trace() = default;
+    Trace(const Trace &) = delete;
+    Trace &operator=(const Trace &) = delete;
+
+    struct Event
+    {
+        uint32_t startUs; // low 32 bits of esp_timer
+        uint32_t durUs;
+        NameId name;
+        uint16_t reserved;
+    };
+
+    struct Ring
+    {
+        Event *events = nullptr;
+        std::atomic<uint32_t> head{0}; // total spans ever claimed
+    };
+
+    Ring rings_[CORES];
+    std::atomic<bool> recording_;
+    const char *names_[MAX_NAMES];
+    uint16_t nameCount_;
+};
+
+#if DHC_TRACE_ENABLED
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+#define TRACE_SCOPE(name)                                                                                   \
+    static const Trace::NameId TRACE_CONCAT(traceName_, __LINE__) = Trace::instance().nameId(name);         \
+    const Trace::Scope TRACE_CONCAT(traceScope_, __LINE__)(TRACE_CONCAT(traceName_, __LINE__))
+#else
+#define TRACE_SCOPE(name) \
+    do                    \
+    {                     \
+    } while (0)
+#endif
@@ -0,0 +1,258 @@
+/**
+ * @file webApi.cpp
+ * @brief Implementation of the /api/... HTTP routes.
+ */
+
+#include "webApi.h"
+
+#include "ws.h"
+#include "display.h"
+#include "displaySnapshot.h"
+#include "networkController.h"
+#include "linkMonitor.h"
+#include "crashLog.h"
+#include "memoryPool.h"
+#include "trace.h"
+#include "provisioningBundle.h"
+#include "config.h"
+
+#include <ArduinoJson.h>
+
+namespace
+{
+    // Print that forwards to a chunked HTTP response in CHUNK-sized pieces
+    class ChunkedPrint : public Print
+    {
+    public:
+        explicit ChunkedPrint(WebServer &srv) : srv_(srv), len_(0) {}
+        ~ChunkedPrint() override { flush(); }
+
+        size_t write(uint8_t c) override
+        {
+            buf_[len_++] = (char)c;
+            if (len_ == CHUNK)
+                flush();
+            return 1;
+        }
+
+        size_t write(const uint8_t *data, size_t n) override
+        {
+            for (size_t i = 0; i < n; ++i)
+                write(data[i]);
+            return n;
+        }
+
+        void flush() override
+        {
+            if (len_)
+                srv_.sendContent(buf_, len_);
+            len_ = 0;
+        }
+
+    private:
+        static constexpr size_t CHUNK = 512;
+        WebServer &srv_;
+        char buf_[CHUNK];
+        size_t len_;
+    };
+
+    // Envelope of a ProvisioningBundle: base64 payload and signature plus a little JSON
+    constexpr size_t BUNDLE_BODY_MAX = ProvisioningBundle::MAX_PAYLOAD * 4 / 3 + 256;
+
+    // JSON buffers built by the routes are accounted to "webApi"
+    MemoryAccounting::ModuleId jsonModule()
+    {
+        static const MemoryAccounting::ModuleId id = MemoryAccounting::instance().registerModule("webApi");
+        return id;
+    }
+}
+
+WebApi &WebApi::instance()
+{
+    static WebApi inst;
+    return inst;
+}
+
+void WebApi::registerRoutes()
+{
+    // Display snapshot: streamed straight from the framebuffer, no image copy.
+    Ws::instance().onRaw("/api/display.png", HTTP_GET, [](WebServer &srv)
+                         {
+                             const Display &d = Display::instance(srv.arg("panel") == "1" ? 1 : 0);
+                             const uint8_t *fb = d.framebuffer();
+                             if (!fb)
+                             {
+                                 srv.send(503, "text/plain", "Display unavailable");
+                                 return;
+                             }
+                             srv.setContentLength(DisplaySnapshot::pngSize(d.width(), d.height()));
+                             srv.sendHeader("Cache-Control", "no-store");
+                             srv.send(200, "image/png", "");
+                             WiFiClient client = srv.client();
+                             DisplaySnapshot::writePng(client, fb, d.width(), d.height()); });
+
+    Ws::instance().onRaw("/api/display.pbm", HTTP_GET, [](WebServer &srv)
+                         {
+                             const Display &d = Display::instance(srv.arg("panel") == "1" ? 1 : 0);
+                             const uint8_t *fb = d.framebuffer();
+                             if (!fb)
+                             {
+                                 srv.send(503, "text/plain", "Display unavailable");
+                                 return;
+                             }
+                             srv.setContentLength(DisplaySnapshot::pbmSize(d.width(), d.height(), false));
+                             srv.sendHeader("Cache-Control", "no-store");
+                             srv.send(200, "image/x-portable-bitmap", "");
+                             WiFiClient client = srv.client();
+                             DisplaySnapshot::writePbm(client, fb, d.width(), d.height(), false); });
+
+    // WiFi connection state and metrics
+    Ws::instance().onRaw("/api/wifi", HTTP_GET, [](WebServer &srv)
+                         {
+                             NetworkController &nc = NetworkController::instance();
+                             const auto &m = nc.metrics();
+                             StaticJsonDocument<1024> doc;
+                             doc["state"] = NetworkController::stateToString(nc.state());
+                             if (nc.isConnected())
+                             {
+                                 doc["ssid"] = WiFi.SSID();
+                                 doc["ip"] = WiFi.localIP().toString();
+                                 doc["rssi"] = WiFi.RSSI();
+                                 doc["channel"] = WiFi.channel();
+                             }
+                             JsonObject metrics = doc.createNestedObject("metrics");
+                             metrics["attempts"] = m.attempts;
+                             metrics["successes"] = m.successes;
+                             metrics["failures"] = m.failures;
+                             metrics["disconnects"] = m.disconnects;
+                             metrics["bootToIpMs"] = m.bootToIpMs;
+                             metrics["lastConnectMs"] = m.lastConnectMs;
+                             metrics["lastRecoveryMs"] = m.lastRecoveryMs;
+                             metrics["lastDisconnectReason"] = m.lastDisconnectReason;
+                             metrics["fastBoot"] = m.fastBoot;
+                             metrics["leaseReused"] = m.leaseReused;
+                             metrics["previousBootToIpMs"] = m.previousBootToIpMs;
+
+                             LinkMonitor &lm = LinkMonitor::instance();
+                             const LinkMonitor::RssiStats st = lm.rssiStats();
+                             JsonObject link = doc.createNestedObject("link");
+                             if (st.count > 0)
+                             {
+                                 link["rssiMin"] = st.min;
+                                 link["rssiMax"] = st.max;
+                                 link["rssiAvg"] = st.avg;
+                             }
+                             link["samples"] = st.count;
+                             link["powerPolicy"] = LinkMonitor::policyToString(lm.policy());
+                             link["powerSave"] = LinkMonitor::powerSaveToString(lm.powerSave());
+                             link["powerSaveSwitches"] = lm.powerSaveSwitches();
+                             link["msAwake"] = lm.msAwake();
+                             link["msModemSleep"] = lm.msModemSleep();
+                             LinkMonitor::DisconnectRecord recs[LinkMonitor::DISCONNECT_HISTORY];
+                             size_t n = lm.disconnects(recs, LinkMonitor::DISCONNECT_HISTORY);
+                             JsonArray reasons = link.createNestedArray("disconnects");
+                             for (size_t i = 0; i < n; ++i)
+                             {
+                                 JsonObject r = reasons.createNestedObject();
+                                 r["atMs"] = recs[i].atMs;
+                                 r["reason"] = recs[i].reason;
+                             }
+                             String body;
+                             serializeJson(doc, body);
+                             srv.send(200, "application/json", body); });
+
+    // Cached scan results. A stale cache (or ?refresh=1) starts a background scan;
+    // clients poll while "scanning" is true.
+    Ws::instance().onRaw("/api/scan", HTTP_GET, [](WebServer &srv)
+                         {
+                             NetworkController &nc = NetworkController::instance();
+                             nc.startScan(srv.arg("refresh") == "1");
+                             const auto &results = nc.scanResults();
+                             PooledJsonDocument doc(JSON_OBJECT_SIZE(3) + JSON_ARRAY_SIZE(results.size()) +
+                                                        results.size() * (JSON_OBJECT_SIZE(6) + 64),
+                                                    PooledJsonAllocator(jsonModule()));
+                             doc["scanning"] = nc.scanInProgress();
+                             const uint32_t age = nc.scanAgeMs();
+                             if (age != UINT32_MAX)
+                                 doc["ageMs"] = age;
+                             JsonArray list = doc.createNestedArray("networks");
+                             for (const auto &r : results)
+                             {
+                                 JsonObject n = list.createNestedObject();
+                                 n["ssid"] = r.ssid.c_str();
+                                 n["rssi"] = r.rssi;
+                                 n["channel"] = r.channel;
+                                 n["secure"] = r.encryption != WIFI_AUTH_OPEN;
+                                 n["auth"] = (int)r.encryption;
+                                 n["aps"] = r.apCount;
+                             }
+                             String body;
+                             serializeJson(doc, body);
+                             srv.sendHeader("Cache-Control", "no-store");
+                             srv.send(200, "application/json", body); });
+
+    // Signed provisioning bundle: the envelope as request body
+    Ws::instance().onRaw("/api/bundle", HTTP_POST, [](WebServer &srv)
+                         {
+                             const String &body = srv.arg("plain");
+                             if (body.length() > BUNDLE_BODY_MAX)
+                             {
+                                 srv.send(413, "text/plain", "Bundle too large");
+                                 return;
+                             }
+                             ProvisioningBundle &bundle = ProvisioningBundle::instance();
+                             const ProvisioningBundle::Result r = bundle.applyEnvelope(body);
+                             int code = 400;
+                             switch (r)
+                             {
+                             case ProvisioningBundle::Result::Applied:
+                                 code = 200;
+                                 break;
+                             case ProvisioningBundle::Result::BadSignature:
+                             case ProvisioningBundle::Result::WrongDevice:
+                                 code = 403;
+                                 break;
+                             case ProvisioningBundle::Result::Stale:
+                                 code = 409;
+                                 break;
+                             case ProvisioningBundle::Result::NoKey:
+                             case ProvisioningBundle::Result::StoreFailed:
+                                 code = 500;
+                                 break;
+                             default:
+                                 break;
+                             }
+                             StaticJsonDocument<384> doc;
+                             doc["result"] = ProvisioningBundle::resultToString(r);
+                             doc["detail"] = bundle.lastDetail();
+                             doc["device"] = bundle.deviceId();
+                             doc["seq"] = Config::instance().getBundleSeq();
+                             String out;
+                             serializeJson(doc, out);
+                             srv.sendHeader("Cache-Control", "no-store");
+                             srv.send(code, "application/json", out); });
+
+    // Trace spans as Chrome trace JSON (open in chrome://tracing or ui.perfetto.dev)
+    Ws::instance().onRaw("/api/trace", HTTP_GET, [](WebServer &srv)
+                         {
+                             if (!Trace::compiledIn())
+                             {
+                                 srv.send(404, "text/plain", "Tracing not compiled in (build with DHC_TRACE_ENABLED=1)");
+                                 return;
+                             }
+                             srv.setContentLength(CONTENT_LENGTH_UNKNOWN);
+                             srv.sendHeader("Cache-Control", "no-store");
+                             srv.sendHeader("Content-Disposition", "attachment; filename=\"trace.json\"");
+                             srv.send(200, "application/json", "");
+                             {
+                                 ChunkedPrint out(srv);
+                                 Trace::instance().writeChromeJson(out);
+                             }
+                             srv.sendContent(""); });
+
+    // Boot/crash history (CrashLog records, oldest first)
+    Ws::instance().onRaw("/api/crashlog", HTTP_GET, [](WebServer &srv)
+                         {
+                             srv.sendHeader("Cache-Control", "no-store");
+                             srv.send(200, "application/json", CrashLog::instance().json()); });
+}
@@ -0,0 +1,37 @@
+#pragma once
+/**
+ * @file webApi.h
+ * @brief Registers the device's JSON/binary HTTP endpoints (/api/...) on the Ws server.
+ *
+ * The routes are shared between provisioning mode and normal operation, so both
+ * call registerRoutes() right after Ws::begin().
+ *
+ * Endpoints:
+ *  - GET /api/display.png  current display contents as PNG
+ *  - GET /api/display.pbm  current display contents as raw PBM (P4)
+ *    (both accept ?panel=1 for the secondary panel)
+ *  - GET /api/wifi         station state, connection metrics and link quality (JSON)
+ *  - GET /api/scan         cached scan results; ?refresh=1 forces a new scan (JSON)
+ *  - GET /api/crashlog     reset history with crash context of abnormal resets (JSON)
+ *  - POST /api/bundle      apply a signed provisioning bundle (see provisioningBundle.h)
+ *  - GET /api/trace        trace spans as Chrome trace JSON (DHC_TRACE_ENABLED builds)
+ */
+
+#include <Arduino.h>
+
+class WebApi
+{
+public:
+    static WebApi &instance();
+
+    // Register all /api/* routes. Ws must already be running.
+    void registerRoutes();
+
+private:
+    WebApi() = default;
+    ~WebApi() = default;
+
+    // non-copyable
+    WebApi(const WebApi &) = delete;
+    WebApi &operator=(const WebApi &) = delete;
+};
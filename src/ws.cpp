@@ -7,6 +7,8 @@
 
 #include "ws.h"
 #include "Logger.h"
+#include "system.h"
+#include "trace.h"
 
 #include <LittleFS.h>
 
@@ -17,7 +19,7 @@ Ws &Ws::instance()
 }
 
 Ws::Ws()
-    : server_(nullptr), running_(false)
+    : server_(nullptr), running_(false), lastActivityMs_(0)
 {
 }
 
@@ -77,6 +79,7 @@ bool Ws::begin(uint16_t port)
     // NotFound handler: wildcard-aware static mapping first, then 404
     server_->onNotFound([this]()
                         {
+        lastActivityMs_ = System::instance().monotonicMs();
         String uri = server_->uri();
 
         // Find best mapping: exact match preferred, otherwise longest prefix wildcard
@@ -188,6 +191,10 @@ bool Ws::begin(uint16_t port)
         Logger::instance().debug(msg);
         server_->send(404, "text/plain", "Not Found"); });
 
+    // Only collected headers can be read in handlers; serveEmbedded() needs this one
+    static const char *collected[] = {"If-None-Match"};
+    server_->collectHeaders(collected, sizeof(collected) / sizeof(collected[0]));
+
     server_->begin();
     running_ = true;
     Logger::instance().info(String("WS: started on port ") + String(port));
@@ -204,6 +211,9 @@ void Ws::stop()
         server_->stop();
         server_.reset();
     }
+    // Routes died with the server; drop the static mappings too so the next begin() starts clean
+    staticMappings_.clear();
+    rawRoutes_.clear();
     running_ = false;
     Logger::instance().info("WS: stopped");
 }
@@ -216,27 +226,60 @@ void Ws::on(const String &uri, HTTPMethod method, std::function<void()> handler)
         return;
     }
 
-    server_->on(uri.c_str(), method, [handler]()
+    server_->on(uri.c_str(), method, [this, handler]()
                 {
+        lastActivityMs_ = System::instance().monotonicMs();
         if (handler) handler(); });
 
     Logger::instance().debug(String("WS: registered route ") + uri + " method=" + String(method));
 }
 
-void Ws::onRaw(const String &uri, HTTPMethod method, std::function<void(WebServer &)> handler)
+Ws::RouteId Ws::onRaw(const String &uri, HTTPMethod method, std::function<void(WebServer &)> handler)
 {
     if (!running_)
     {
         Logger::instance().warn(String("WS: onRaw() called for '") + uri + "' but server not running");
-        return;
+        return 0;
     }
 
-    server_->on(uri.c_str(), method, [this, handler]()
+    // A retired route for the same request would still win the dispatch: reuse it
+    for (size_t i = 0; i < rawRoutes_.size(); ++i)
+    {
+        RawRoute &r = rawRoutes_[i];
+        if (r.removed && r.method == method && r.uri == uri)
+        {
+            r.handler = handler;
+            r.removed = false;
+            Logger::instance().debug(String("WS: re-registered raw route ") + uri + " method=" + String(method));
+            return (RouteId)(i + 1);
+        }
+    }
+
+    rawRoutes_.push_back(RawRoute{uri, method, handler, false});
+    const size_t index = rawRoutes_.size() - 1;
+    server_->on(uri.c_str(), method, [this, index]()
                 {
+        lastActivityMs_ = System::instance().monotonicMs();
+        if (rawRoutes_[index].removed)
+        {
+            server_->send(404, "text/plain", "Not Found");
+            return;
+        }
+        // Copy: the handler may register routes and grow rawRoutes_
+        const auto handler = rawRoutes_[index].handler;
         if (handler)
             handler(*server_); });
 
     Logger::instance().debug(String("WS: registered raw route ") + uri + " method=" + String(method));
+    return (RouteId)(index + 1);
+}
+
+void Ws::removeRoute(RouteId id)
+{
+    if (!running_ || id == 0 || id > rawRoutes_.size())
+        return;
+    rawRoutes_[id - 1].removed = true;
+    rawRoutes_[id - 1].handler = nullptr;
 }
 
 void Ws::send(int code, const String &contentType, const String &body)
@@ -253,9 +296,34 @@ void Ws::wsLoop()
 {
     if (!running_ || !server_)
         return;
+    TRACE_SCOPE("ws");
     server_->handleClient();
 }
 
+Ws::RouteId Ws::serveEmbedded(const String &uri, const char *contentType, const uint8_t *gz, size_t len,
+                              const char *etag, uint32_t maxAgeS, RequestFilter allow)
+{
+    const String cacheControl = maxAgeS == 0 ? String("no-cache")
+                                             : String("public, max-age=") + String(maxAgeS) + ", immutable";
+    return onRaw(uri, HTTP_GET, [contentType, gz, len, etag, cacheControl, allow](WebServer &srv)
+          {
+              if (allow && !allow(srv))
+              {
+                  srv.send(403, "text/plain", "Forbidden");
+                  return;
+              }
+              srv.sendHeader("ETag", etag);
+              srv.sendHeader("Cache-Control", cacheControl);
+              if (srv.header("If-None-Match") == etag)
+              {
+                  srv.send(304);
+                  return;
+              }
+              // Flash is memory mapped; send_P streams it without a RAM copy
+              srv.sendHeader("Content-Encoding", "gzip");
+              srv.send_P(200, contentType, reinterpret_cast<const char *>(gz), len); });
+}
+
 void Ws::serveStatic(const String &uriPrefix, const String &fsPathPrefix)
 {
     // Normalize without corrupting wildcard forms like "/*"
@@ -15,6 +15,12 @@
 class Ws
 {
 public:
+    // Handle of a route registered with onRaw()/serveEmbedded(); 0 = not registered
+    using RouteId = uint32_t;
+
+    // Decides per request whether a route serves it; refused requests get 403
+    using RequestFilter = std::function<bool(WebServer &)>;
+
     static Ws &instance();
 
     // Start/stop server
@@ -26,7 +32,14 @@ public:
 
     // Register a handler that receives the underlying WebServer reference.
     // Useful for reading args/body or streaming files using WebServer APIs.
-    void onRaw(const String &uri, HTTPMethod method, std::function<void(WebServer &)> handler);
+    RouteId onRaw(const String &uri, HTTPMethod method, std::function<void(WebServer &)> handler);
+
+    /**
+     * Retire a route. WebServer cannot drop a handler, so the route stays registered but
+     * answers 404 until the server is stopped (which drops every route); registering
+     * the same URI and method again reuses it.
+     */
+    void removeRoute(RouteId id);
 
     // Convenience response helper (call from handler)
     void send(int code, const String &contentType, const String &body);
@@ -37,8 +50,22 @@ public:
     // Serve static files using wildcard/template mapping rules described in ws.cpp
     void serveStatic(const String &uriPrefix, const String &fsPathPrefix);
 
+    /**
+     * Serve a gzipped asset compiled into flash (e.g. src/provisioningPage.h) at `uri`.
+     * Sent with Content-Encoding: gzip and the given ETag; a matching If-None-Match gets
+     * 304 without a body. maxAgeS 0 (entry points such as "/") sends no-cache, so every
+     * load revalidates; only versioned assets whose URI changes with their content
+     * should pass a long max-age (sent as immutable). With `allow`, requests it rejects
+     * get 403 instead of the asset.
+     */
+    RouteId serveEmbedded(const String &uri, const char *contentType, const uint8_t *gz, size_t len, const char *etag,
+                          uint32_t maxAgeS, RequestFilter allow = nullptr);
+
     bool isRunning() const;
 
+    // System::monotonicMs() of the last request handled (0 = none yet); used to detect an active client
+    uint64_t lastActivityMs() const { return lastActivityMs_; }
+
 private:
     Ws();
     ~Ws();
@@ -55,7 +82,18 @@ private:
         bool fsHasWildcard; // true if fsPrefix contains '*'
     };
 
+    // onRaw() registration; RouteId is its index + 1
+    struct RawRoute
+    {
+        String uri;
+        HTTPMethod method;
+        std::function<void(WebServer &)> handler;
+        bool removed;
+    };
+
     std::unique_ptr<WebServer> server_;
     bool running_;
+    uint64_t lastActivityMs_;
+    std::vector<RawRoute> rawRoutes_; // since begin(); cleared by stop()
     std::vector<StaticMapping> staticMappings_;
 };
@@ -0,0 +1,151 @@
+#pragma once
+/**
+ * @file Adafruit_GFX.h
+ * @brief Host stand-in for Adafruit_GFX: the primitives the display code draws with,
+ *        all routed through drawPixel() like the library's defaults, and the library's
+ *        getTextBounds() (text itself is not rendered).
+ *
+ * The font types match gfxfont.h, so the fonts bundled with the library (Fonts/,
+ * which include <Adafruit_GFX.h>) compile against this header.
+ */
+
+#include <Arduino.h>
+
+#ifndef _GFXFONT_H_
+#define _GFXFONT_H_
+typedef struct
+{
+    uint16_t bitmapOffset;
+    uint8_t width;
+    uint8_t height;
+    uint8_t xAdvance;
+    int8_t xOffset;
+    int8_t yOffset;
+} GFXglyph;
+
+typedef struct
+{
+    uint8_t *bitmap;
+    GFXglyph *glyph;
+    uint16_t first;
+    uint16_t last;
+    uint8_t yAdvance;
+} GFXfont;
+#endif
+
+class Adafruit_GFX : public Print
+{
+public:
+    Adafruit_GFX(int16_t w, int16_t h) : WIDTH(w), HEIGHT(h) {}
+
+    virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+
+    virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+    {
+        for (int16_t i = 0; i < w; ++i)
+            drawPixel(x + i, y, color);
+    }
+
+    virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+    {
+        for (int16_t i = 0; i < h; ++i)
+            drawPixel(x, y + i, color);
+    }
+
+    virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+    {
+        for (int16_t i = 0; i < h; ++i)
+            drawFastHLine(x, y + i, w, color);
+    }
+
+    virtual void fillScreen(uint16_t color) { fillRect(0, 0, WIDTH, HEIGHT, color); }
+
+    size_t write(uint8_t) override { return 1; } // text rendering is not simulated
+    using Print::write;
+
+    void setFont(const GFXfont *f = nullptr) { gfxFont_ = f; }
+    void setTextSize(uint8_t s) { textSizeX_ = textSizeY_ = s > 0 ? s : 1; }
+    void setTextWrap(bool w) { wrap_ = w; }
+    void setTextColor(uint16_t) {}
+    void setCursor(int16_t, int16_t) {}
+    void setRotation(uint8_t) {}
+
+    // As in Adafruit_GFX 1.11 (getTextBounds()/charBounds()), at rotation 0
+    void getTextBounds(const String &str, int16_t x, int16_t y, int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h)
+    {
+        int16_t minx = 0x7FFF, miny = 0x7FFF, maxx = -1, maxy = -1;
+        *x1 = x;
+        *y1 = y;
+        *w = *h = 0;
+        for (size_t i = 0; i < str.length(); ++i)
+            charBounds(static_cast<unsigned char>(str[i]), &x, &y, &minx, &miny, &maxx, &maxy);
+        if (maxx >= minx)
+        {
+            *x1 = minx;
+            *w = maxx - minx + 1;
+        }
+        if (maxy >= miny)
+        {
+            *y1 = miny;
+            *h = maxy - miny + 1;
+        }
+    }
+
+    int16_t width() const { return WIDTH; }
+    int16_t height() const { return HEIGHT; }
+
+protected:
+    int16_t WIDTH;
+    int16_t HEIGHT;
+
+private:
+    void charBounds(unsigned char c, int16_t *x, int16_t *y, int16_t *minx, int16_t *miny, int16_t *maxx,
+                    int16_t *maxy)
+    {
+        if (c == '\n')
+        {
+            *x = 0;
+            *y += textSizeY_ * (gfxFont_ ? gfxFont_->yAdvance : 8);
+            return;
+        }
+        if (c == '\r')
+            return;
+
+        if (!gfxFont_)
+        {
+            if (wrap_ && (*x + textSizeX_ * 6) > WIDTH)
+            {
+                *x = 0;
+                *y += textSizeY_ * 8;
+            }
+            const int16_t x2 = *x + textSizeX_ * 6 - 1, y2 = *y + textSizeY_ * 8 - 1;
+            *maxx = max(*maxx, x2);
+            *maxy = max(*maxy, y2);
+            *minx = min(*minx, *x);
+            *miny = min(*miny, *y);
+            *x += textSizeX_ * 6;
+            return;
+        }
+
+        if (c < gfxFont_->first || c > gfxFont_->last)
+            return;
+        const GFXglyph *glyph = &gfxFont_->glyph[c - gfxFont_->first];
+        if (wrap_ && (*x + ((int16_t)glyph->xOffset + glyph->width) * textSizeX_) > WIDTH)
+        {
+            *x = 0;
+            *y += textSizeY_ * gfxFont_->yAdvance;
+        }
+        const int16_t x1 = *x + glyph->xOffset * textSizeX_, y1 = *y + glyph->yOffset * textSizeY_;
+        const int16_t x2 = x1 + glyph->width * textSizeX_ - 1, y2 = y1 + glyph->height * textSizeY_ - 1;
+        *minx = min(*minx, x1);
+        *miny = min(*miny, y1);
+        *maxx = max(*maxx, x2);
+        *maxy = max(*maxy, y2);
+        *x += glyph->xAdvance * textSizeX_;
+    }
+
+    const GFXfont *gfxFont_ = nullptr;
+    int16_t textSizeX_ = 1;
+    int16_t textSizeY_ = 1;
+    bool wrap_ = true;
+};
@@ -0,0 +1,95 @@
+#pragma once
+/**
+ * @file Adafruit_SH110X.h
+ * @brief Host stand-in for Adafruit_SH1106G on the fake TwoWire.
+ *
+ * Same wire format as the library: the SH1106 has no auto-incrementing window,
+ * so each page goes out as its own PAGE/column command pair followed by
+ * 0x40-prefixed data, starting at column 2 of the 132-column RAM.
+ */
+
+#include <Adafruit_GFX.h>
+#include <Wire.h>
+#include <stdlib.h>
+
+#define SH110X_SETCONTRAST 0x81
+#define SH110X_NORMALDISPLAY 0xA6
+#define SH110X_INVERTDISPLAY 0xA7
+#define SH110X_DISPLAYON 0xAF
+#define SH110X_SETPAGEADDR 0xB0
+
+// Base the library keeps the framebuffer in (protected, as upstream)
+class Adafruit_GrayOLED : public Adafruit_GFX
+{
+public:
+    Adafruit_GrayOLED(uint16_t w, uint16_t h, TwoWire *twi) : Adafruit_GFX(w, h), wire_(twi) {}
+    ~Adafruit_GrayOLED() override { free(buffer); }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override
+    {
+        if (!buffer || x < 0 || y < 0 || x >= WIDTH || y >= HEIGHT)
+            return;
+        uint8_t &cell = buffer[x + (y / 8) * WIDTH];
+        const uint8_t bit = 1 << (y & 7);
+        cell = color == 1 ? (cell | bit) : color == 0 ? (cell & ~bit) : (cell ^ bit);
+    }
+
+    void clearDisplay()
+    {
+        if (buffer)
+            memset(buffer, 0, bufferSize());
+    }
+
+    void setContrast(uint8_t level)
+    {
+        command(SH110X_SETCONTRAST);
+        command(level);
+    }
+
+    void invertDisplay(bool i) { command(i ? SH110X_INVERTDISPLAY : SH110X_NORMALDISPLAY); }
+
+protected:
+    size_t bufferSize() const { return (size_t)WIDTH * ((HEIGHT + 7) / 8); }
+
+    bool command(uint8_t c)
+    {
+        wire_->beginTransmission(address_);
+        wire_->write(0x00);
+        wire_->write(c);
+        return wire_->endTransmission() == 0;
+    }
+
+    uint8_t *buffer = nullptr;
+    TwoWire *wire_;
+    uint8_t address_ = 0x3C;
+};
+
+class Adafruit_SH1106G : public Adafruit_GrayOLED
+{
+public:
+    Adafruit_SH1106G(uint16_t w, uint16_t h, TwoWire *twi, int8_t rst) : Adafruit_GrayOLED(w, h, twi) {}
+
+    bool begin(uint8_t addr = 0x3C, bool reset = true)
+    {
+        if (!buffer && !(buffer = static_cast<uint8_t *>(malloc(bufferSize()))))
+            return false;
+        clearDisplay();
+        address_ = addr;
+        return command(SH110X_DISPLAYON);
+    }
+
+    void display()
+    {
+        constexpr uint8_t COLUMN_OFFSET = 2;
+        for (uint16_t page = 0; page < (uint16_t)(HEIGHT / 8); ++page)
+        {
+            command((uint8_t)(SH110X_SETPAGEADDR + page));
+            command(COLUMN_OFFSET & 0x0F);        // column low nibble
+            command(0x10 | (COLUMN_OFFSET >> 4)); // column high nibble
+            wire_->beginTransmission(address_);
+            wire_->write(0x40);
+            wire_->write(buffer + (size_t)page * WIDTH, WIDTH);
+            wire_->endTransmission();
+        }
+    }
+};
@@ -0,0 +1,91 @@
+#pragma once
+/**
+ * @file Adafruit_SSD1306.h
+ * @brief Host stand-in for Adafruit_SSD1306 on the fake TwoWire.
+ *
+ * Same wire format as the library: commands as 0x00 + byte, the framebuffer as
+ * 0x40-prefixed chunks after a PAGEADDR/COLUMNADDR window. Like the library,
+ * begin() only fails when the framebuffer cannot be allocated; it does not
+ * notice a missing panel.
+ */
+
+#include <Adafruit_GFX.h>
+#include <Wire.h>
+#include <stdlib.h>
+
+#define SSD1306_SWITCHCAPVCC 0x02
+#define SSD1306_SETCONTRAST 0x81
+#define SSD1306_NORMALDISPLAY 0xA6
+#define SSD1306_INVERTDISPLAY 0xA7
+#define SSD1306_DISPLAYON 0xAF
+#define SSD1306_PAGEADDR 0x22
+#define SSD1306_COLUMNADDR 0x21
+
+class Adafruit_SSD1306 : public Adafruit_GFX
+{
+public:
+    Adafruit_SSD1306(uint8_t w, uint8_t h, TwoWire *twi, int8_t rst) : Adafruit_GFX(w, h), wire_(twi) {}
+    ~Adafruit_SSD1306() override { free(buffer_); }
+
+    bool begin(uint8_t vcs, uint8_t addr, bool reset = true, bool periphBegin = true)
+    {
+        if (!buffer_ && !(buffer_ = static_cast<uint8_t *>(malloc(bufferSize()))))
+            return false;
+        clearDisplay();
+        address_ = addr;
+        if (periphBegin)
+            wire_->begin();
+        command(SSD1306_DISPLAYON);
+        return true;
+    }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override
+    {
+        if (!buffer_ || x < 0 || y < 0 || x >= WIDTH || y >= HEIGHT)
+            return;
+        uint8_t &cell = buffer_[x + (y / 8) * WIDTH];
+        const uint8_t bit = 1 << (y & 7);
+        cell = color == 1 ? (cell | bit) : color == 0 ? (cell & ~bit) : (cell ^ bit);
+    }
+
+    void clearDisplay()
+    {
+        if (buffer_)
+            memset(buffer_, 0, bufferSize());
+    }
+
+    void display()
+    {
+        const uint8_t window[] = {SSD1306_PAGEADDR, 0, 0xFF, SSD1306_COLUMNADDR, 0, (uint8_t)(WIDTH - 1)};
+        for (uint8_t c : window)
+            command(c);
+        for (size_t i = 0; i < bufferSize(); i += CHUNK)
+        {
+            wire_->beginTransmission(address_);
+            wire_->write(0x40);
+            wire_->write(buffer_ + i, min(CHUNK, bufferSize() - i));
+            wire_->endTransmission();
+        }
+    }
+
+    void ssd1306_command(uint8_t c) { command(c); }
+    void invertDisplay(bool i) { command(i ? SSD1306_INVERTDISPLAY : SSD1306_NORMALDISPLAY); }
+    uint8_t *getBuffer() { return buffer_; }
+
+private:
+    static constexpr size_t CHUNK = 31; // 32-byte Wire buffer minus the control byte
+
+    size_t bufferSize() const { return (size_t)WIDTH * ((HEIGHT + 7) / 8); }
+
+    bool command(uint8_t c)
+    {
+        wire_->beginTransmission(address_);
+        wire_->write(0x00);
+        wire_->write(c);
+        return wire_->endTransmission() == 0;
+    }
+
+    TwoWire *wire_;
+    uint8_t *buffer_ = nullptr;
+    uint8_t address_ = 0x3C;
+};
@@ -0,0 +1,233 @@
+#pragma once
+/**
+ * @file Arduino.h
+ * @brief Host stand-in for the parts of the Arduino core the natively tested modules use.
+ *
+ * Only built into the "native" PlatformIO environment (see test/README). String is a thin
+ * wrapper over std::string, Serial prints to stdout and millis()/micros() follow the
+ * host's steady clock. ESP.restart() aborts, so a test that reaches it fails loudly.
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+using std::max;
+using std::min;
+
+#define PROGMEM
+#define F(s) (s)
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+inline void yield() {}
+inline void noInterrupts() {}
+inline void interrupts() {}
+
+class String
+{
+public:
+    String() = default;
+    String(const char *s) : s_(s ? s : "") {}
+    String(const std::string &s) : s_(s) {}
+    explicit String(char c) : s_(1, c) {}
+    explicit String(int v) : s_(std::to_string(v)) {}
+    explicit String(unsigned v) : s_(std::to_string(v)) {}
+    explicit String(long v) : s_(std::to_string(v)) {}
+    explicit String(unsigned long v) : s_(std::to_string(v)) {}
+    explicit String(long long v) : s_(std::to_string(v)) {}
+    explicit String(unsigned long long v) : s_(std::to_string(v)) {}
+    explicit String(double v, unsigned decimals = 2)
+    {
+        char buf[32];
+        snprintf(buf, sizeof(buf), "%.*f", (int)decimals, v);
+        s_ = buf;
+    }
+
+    const char *c_str() const { return s_.c_str(); }
+    unsigned length() const { return (unsigned)s_.size(); }
+    bool isEmpty() const { return s_.empty(); }
+    char charAt(unsigned i) const { return i < s_.size() ? s_[i] : 0; }
+    char operator[](unsigned i) const { return charAt(i); }
+    char &operator[](unsigned i) { return s_[i]; }
+
+    String substring(unsigned from) const { return from < s_.size() ? String(s_.substr(from)) : String(); }
+    String substring(unsigned from, unsigned to) const
+    {
+        return from < s_.size() && from < to ? String(s_.substr(from, to - from)) : String();
+    }
+    int indexOf(char c, unsigned from = 0) const
+    {
+        const size_t i = s_.find(c, from);
+        return i == std::string::npos ? -1 : (int)i;
+    }
+    int indexOf(const String &s, unsigned from = 0) const
+    {
+        const size_t i = s_.find(s.s_, from);
+        return i == std::string::npos ? -1 : (int)i;
+    }
+    bool startsWith(const String &s) const { return s_.compare(0, s.s_.size(), s.s_) == 0; }
+    bool endsWith(const String &s) const
+    {
+        return s_.size() >= s.s_.size() && s_.compare(s_.size() - s.s_.size(), s.s_.size(), s.s_) == 0;
+    }
+    bool equalsIgnoreCase(const String &o) const
+    {
+        return s_.size() == o.s_.size() &&
+               std::equal(s_.begin(), s_.end(), o.s_.begin(),
+                          [](char a, char b) { return tolower((unsigned char)a) == tolower((unsigned char)b); });
+    }
+    long toInt() const { return strtol(s_.c_str(), nullptr, 10); }
+
+    void trim()
+    {
+        const size_t b = s_.find_first_not_of(" \t\r\n");
+        const size_t e = s_.find_last_not_of(" \t\r\n");
+        s_ = b == std::string::npos ? std::string() : s_.substr(b, e - b + 1);
+    }
+    void toLowerCase()
+    {
+        for (char &c : s_)
+            c = (char)tolower((unsigned char)c);
+    }
+    void toUpperCase()
+    {
+        for (char &c : s_)
+            c = (char)toupper((unsigned char)c);
+    }
+    void replace(const String &from, const String &to)
+    {
+        if (from.s_.empty())
+            return;
+        for (size_t i = s_.find(from.s_); i != std::string::npos; i = s_.find(from.s_, i + to.s_.size()))
+            s_.replace(i, from.s_.size(), to.s_);
+    }
+    bool reserve(unsigned n)
+    {
+        s_.reserve(n);
+        return true;
+    }
+
+    String &operator+=(const String &o)
+    {
+        s_ += o.s_;
+        return *this;
+    }
+    String &operator+=(const char *o)
+    {
+        s_ += o ? o : "";
+        return *this;
+    }
+    String &operator+=(char c)
+    {
+        s_ += c;
+        return *this;
+    }
+    bool concat(const String &o)
+    {
+        s_ += o.s_;
+        return true;
+    }
+
+    friend String operator+(const String &a, const String &b) { return String(a.s_ + b.s_); }
+    friend String operator+(const String &a, const char *b) { return String(a.s_ + (b ? b : "")); }
+    friend String operator+(const char *a, const String &b) { return String((a ? a : "") + b.s_); }
+    friend String operator+(const String &a, char c) { return String(a.s_ + c); }
+    friend bool operator==(const String &a, const String &b) { return a.s_ == b.s_; }
+    friend bool operator==(const String &a, const char *b) { return a.s_ == (b ? b : ""); }
+    friend bool operator!=(const String &a, const String &b) { return a.s_ != b.s_; }
+    friend bool operator!=(const String &a, const char *b) { return !(a == b); }
+    friend bool operator<(const String &a, const String &b) { return a.s_ < b.s_; }
+
+private:
+    std::string s_;
+};
+
+class Print
+{
+public:
+    virtual ~Print() = default;
+    virtual size_t write(uint8_t b) = 0;
+    virtual size_t write(const uint8_t *buf, size_t len)
+    {
+        size_t n = 0;
+        while (len-- && write(*buf++))
+            ++n;
+        return n;
+    }
+    size_t write(const char *s) { return s ? write(reinterpret_cast<const uint8_t *>(s), strlen(s)) : 0; }
+
+    size_t print(const char *s) { return write(s); }
+    size_t print(const String &s) { return write(s.c_str()); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(long v) { return print(String(v)); }
+    size_t print(unsigned long v) { return print(String(v)); }
+    size_t print(int v) { return print(String(v)); }
+    size_t print(unsigned v) { return print(String(v)); }
+    template <typename T>
+    size_t println(const T &v) { return print(v) + print("\r\n"); }
+    size_t println() { return print("\r\n"); }
+    size_t printf(const char *fmt, ...) __attribute__((format(printf, 2, 3)))
+    {
+        char buf[256];
+        va_list ap;
+        va_start(ap, fmt);
+        const int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+        va_end(ap);
+        return n < 0 ? 0 : write(reinterpret_cast<const uint8_t *>(buf), min((size_t)n, sizeof(buf) - 1));
+    }
+};
+
+class HardwareSerial : public Print
+{
+public:
+    void begin(unsigned long) {}
+    void flush() { fflush(stdout); }
+    int available() { return 0; }
+    int read() { return -1; }
+    size_t write(uint8_t b) override { return fputc(b, stdout) == EOF ? 0 : 1; }
+    size_t write(const uint8_t *buf, size_t len) override { return fwrite(buf, 1, len, stdout); }
+    using Print::write;
+    explicit operator bool() const { return true; }
+};
+
+extern HardwareSerial Serial;
+
+class IPAddress
+{
+public:
+    IPAddress() : b_{0, 0, 0, 0} {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : b_{a, b, c, d} {}
+    explicit IPAddress(uint32_t v) { memcpy(b_, &v, 4); } // network byte order, as on the ESP32
+    operator uint32_t() const
+    {
+        uint32_t v;
+        memcpy(&v, b_, 4);
+        return v;
+    }
+    uint8_t operator[](int i) const { return b_[i]; }
+    uint8_t &operator[](int i) { return b_[i]; }
+    String toString() const
+    {
+        char buf[16];
+        snprintf(buf, sizeof(buf), "%u.%u.%u.%u", b_[0], b_[1], b_[2], b_[3]);
+        return String(buf);
+    }
+
+private:
+    uint8_t b_[4];
+};
+
+class EspClass
+{
+public:
+    [[noreturn]] void restart() { abort(); }
+};
+
+extern EspClass ESP;
@@ -0,0 +1,65 @@
+#pragma once
+/**
+ * @file Wire.h
+ * @brief Host stand-in for the Arduino TwoWire: a fake I2C bus.
+ *
+ * Addresses added with attach() ACK, everything else NACKs. Every transmission
+ * is kept in log() so tests can check what a driver put on the wire.
+ */
+
+#include <Arduino.h>
+#include <algorithm>
+#include <vector>
+
+class TwoWire
+{
+public:
+    struct Transfer
+    {
+        uint8_t address;
+        std::vector<uint8_t> bytes;
+        bool acked;
+    };
+
+    bool begin(int sda = -1, int scl = -1, uint32_t frequency = 0) { return true; }
+    void setClock(uint32_t frequency) { clock_ = frequency; }
+    uint32_t getClock() const { return clock_; }
+
+    void beginTransmission(uint8_t address)
+    {
+        pending_ = Transfer{address, {}, false};
+    }
+
+    size_t write(uint8_t b)
+    {
+        pending_.bytes.push_back(b);
+        return 1;
+    }
+
+    size_t write(const uint8_t *buf, size_t len)
+    {
+        pending_.bytes.insert(pending_.bytes.end(), buf, buf + len);
+        return len;
+    }
+
+    // 0 = ACK, 2 = address NACK (as the Arduino core reports it)
+    uint8_t endTransmission(bool sendStop = true)
+    {
+        pending_.acked = std::find(devices_.begin(), devices_.end(), pending_.address) != devices_.end();
+        log_.push_back(pending_);
+        return pending_.acked ? 0 : 2;
+    }
+
+    // Fake-bus controls
+    void attach(uint8_t address) { devices_.push_back(address); }
+    const std::vector<Transfer> &log() const { return log_; }
+    void clearLog() { log_.clear(); }
+
+private:
+    std::vector<uint8_t> devices_;
+    std::vector<Transfer> log_;
+    Transfer pending_{0, {}, false};
+    uint32_t clock_ = 100000;
+};
+
+extern TwoWire Wire;
@@ -0,0 +1,9 @@
+#pragma once
+/**
+ * @file esp_timer.h
+ * @brief Host stand-in for esp_timer_get_time(): microseconds of the host's steady clock.
+ */
+
+#include <stdint.h>
+
+int64_t esp_timer_get_time();
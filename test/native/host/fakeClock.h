@@ -0,0 +1,27 @@
+#pragma once
+/**
+ * @file fakeClock.h
+ * @brief Settable monotonic clock for System::setClockSource() in native tests.
+ *
+ *   System::instance().setClockSource(FakeClock::read);
+ *   FakeClock::setMs(3 * (1ULL << 32) - 10); // ten ms before millis() would wrap a third time
+ *   FakeClock::advanceMs(20);
+ */
+
+#include <atomic>
+#include <stdint.h>
+
+namespace FakeClock
+{
+    inline std::atomic<int64_t> &nowUs()
+    {
+        static std::atomic<int64_t> us{0};
+        return us;
+    }
+
+    inline int64_t read() { return nowUs().load(std::memory_order_relaxed); }
+    inline void setUs(int64_t us) { nowUs().store(us, std::memory_order_relaxed); }
+    inline void setMs(uint64_t ms) { setUs((int64_t)ms * 1000); }
+    inline void advanceUs(int64_t us) { nowUs().fetch_add(us, std::memory_order_relaxed); }
+    inline void advanceMs(uint64_t ms) { advanceUs((int64_t)ms * 1000); }
+}
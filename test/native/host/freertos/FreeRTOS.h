@@ -0,0 +1,53 @@
+#pragma once
+/**
+ * @file FreeRTOS.h
+ * @brief Host stand-in for the FreeRTOS types and critical sections the tested modules use.
+ *
+ * portMUX_TYPE is a spinlock on std::atomic_flag, so critical sections exclude each other
+ * between host threads the way they do between the two ESP32 cores.
+ */
+
+#include <atomic>
+#include <stdint.h>
+
+typedef int BaseType_t;
+typedef unsigned UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS pdTRUE
+#define pdFAIL pdFALSE
+#define portMAX_DELAY ((TickType_t)0xFFFFFFFFu)
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define portNUM_PROCESSORS 2
+#define configMAX_PRIORITIES 25
+
+struct portMUX_TYPE
+{
+    std::atomic_flag locked = ATOMIC_FLAG_INIT;
+
+    portMUX_TYPE() = default;
+    // Copies start unlocked, like a portMUX_INITIALIZER_UNLOCKED member initializer
+    portMUX_TYPE(const portMUX_TYPE &) {}
+    portMUX_TYPE &operator=(const portMUX_TYPE &) { return *this; }
+};
+
+#define portMUX_INITIALIZER_UNLOCKED portMUX_TYPE()
+
+inline void portENTER_CRITICAL(portMUX_TYPE *mux)
+{
+    while (mux->locked.test_and_set(std::memory_order_acquire))
+    {
+    }
+}
+
+inline void portEXIT_CRITICAL(portMUX_TYPE *mux) { mux->locked.clear(std::memory_order_release); }
+
+#define portENTER_CRITICAL_ISR(mux) portENTER_CRITICAL(mux)
+#define portEXIT_CRITICAL_ISR(mux) portEXIT_CRITICAL(mux)
+#define taskENTER_CRITICAL(mux) portENTER_CRITICAL(mux)
+#define taskEXIT_CRITICAL(mux) portEXIT_CRITICAL(mux)
+
+BaseType_t xPortGetCoreID();
@@ -0,0 +1,17 @@
+#pragma once
+/**
+ * @file task.h
+ * @brief Host stand-in for FreeRTOS tasks: each task is a detached std::thread.
+ */
+
+#include "freertos/FreeRTOS.h"
+
+typedef void *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stackBytes, void *arg,
+                                   UBaseType_t priority, TaskHandle_t *handle, BaseType_t core);
+TaskHandle_t xTaskGetCurrentTaskHandle();
+void vTaskDelay(TickType_t ticks);
+// Only vTaskDelete(nullptr) at the end of a task function is supported (the thread returns)
+inline void vTaskDelete(TaskHandle_t) {}
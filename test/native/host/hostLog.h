@@ -0,0 +1,17 @@
+#pragma once
+/**
+ * @file hostLog.h
+ * @brief What the host Logger (hostLogger.cpp) saw, for tests that expect a warning or error.
+ */
+
+#include <cstddef>
+#include <string>
+
+namespace HostLog
+{
+    // Warn and Error lines since the last reset()
+    size_t problems();
+    // Text of the most recent line of any level
+    std::string last();
+    void reset();
+}
@@ -0,0 +1,61 @@
+/**
+ * @file hostArduino.cpp
+ * @brief Host implementations behind the Arduino/ESP-IDF/FreeRTOS shims in host/.
+ */
+
+#include <Arduino.h>
+#include <Wire.h>
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include <chrono>
+#include <thread>
+
+HardwareSerial Serial;
+EspClass ESP;
+TwoWire Wire;
+
+int64_t esp_timer_get_time()
+{
+    static const auto start = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+unsigned long millis() { return (unsigned long)(uint32_t)(esp_timer_get_time() / 1000); }
+unsigned long micros() { return (unsigned long)(uint32_t)esp_timer_get_time(); }
+void delay(unsigned long ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
+
+namespace
+{
+    char mainTask;
+    thread_local TaskHandle_t currentTask = &mainTask;
+    std::atomic<int> nextCore{0};
+    thread_local int currentCore = -1;
+}
+
+BaseType_t xPortGetCoreID()
+{
+    // Threads are spread over the two "cores" in creation order
+    if (currentCore < 0)
+        currentCore = nextCore.fetch_add(1) % portNUM_PROCESSORS;
+    return currentCore;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle() { return currentTask; }
+
+void vTaskDelay(TickType_t ticks) { std::this_thread::sleep_for(std::chrono::milliseconds(ticks)); }
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char * /*name*/, uint32_t /*stackBytes*/, void *arg,
+                                   UBaseType_t /*priority*/, TaskHandle_t *handle, BaseType_t /*core*/)
+{
+    // One byte per task gives it a distinct handle; tasks are few, so it is never freed
+    TaskHandle_t self = new char;
+    if (handle)
+        *handle = self;
+    std::thread([fn, arg, self] {
+        currentTask = self;
+        fn(arg);
+    }).detach();
+    return pdPASS;
+}
@@ -0,0 +1,87 @@
+/**
+ * @file hostLogger.cpp
+ * @brief Logger for the native tests: prints Warn and Error to stderr, keeps no queue.
+ *
+ * The firmware Logger pulls in CrashLog and the System clock for timestamps; tests
+ * only need the messages, and HostLog lets them check that one was logged.
+ */
+
+#include "Logger.h"
+#include "hostLog.h"
+
+#include <mutex>
+
+namespace
+{
+    std::mutex logMutex;
+    size_t problemCount = 0;
+    std::string lastLine;
+}
+
+size_t HostLog::problems()
+{
+    std::lock_guard<std::mutex> lock(logMutex);
+    return problemCount;
+}
+
+std::string HostLog::last()
+{
+    std::lock_guard<std::mutex> lock(logMutex);
+    return lastLine;
+}
+
+void HostLog::reset()
+{
+    std::lock_guard<std::mutex> lock(logMutex);
+    problemCount = 0;
+    lastLine.clear();
+}
+
+Logger &Logger::instance()
+{
+    static Logger inst;
+    return inst;
+}
+
+Logger::Logger() : level_(LogLevel::Info), initialized_(false), writer_(nullptr), dropped_(0) {}
+
+void Logger::init(unsigned long) { initialized_ = true; }
+void Logger::setLevel(LogLevel level) { level_ = level; }
+Logger::LogLevel Logger::getLevel() const { return level_; }
+
+void Logger::log(LogLevel level, const String &msg)
+{
+    std::lock_guard<std::mutex> lock(logMutex);
+    lastLine = msg.c_str();
+    if (level >= LogLevel::Warn)
+    {
+        ++problemCount;
+        fprintf(stderr, "[%s] %s\n", levelToString(level), msg.c_str());
+    }
+}
+
+void Logger::print(const char *, const char *, const char *) {}
+void Logger::attachWriter() {}
+void Logger::flush() {}
+
+void Logger::debug(const String &msg) { log(LogLevel::Debug, msg); }
+void Logger::info(const String &msg) { log(LogLevel::Info, msg); }
+void Logger::warn(const String &msg) { log(LogLevel::Warn, msg); }
+void Logger::error(const String &msg) { log(LogLevel::Error, msg); }
+
+const char *Logger::levelToString(LogLevel level)
+{
+    switch (level)
+    {
+    case LogLevel::Debug:
+        return "DEBUG";
+    case LogLevel::Info:
+        return "INFO";
+    case LogLevel::Warn:
+        return "WARN";
+    case LogLevel::Error:
+        return "ERROR";
+    default:
+        return "OFF";
+    }
+}
@@ -0,0 +1,253 @@
+/**
+ * @file test_main.cpp
+ * @brief BufferAllocator placement policy, fallback and accounting against a fake heap backend,
+ *        and the host platform backend's simulated PSRAM.
+ */
+
+#include <unity.h>
+#include "bufferAllocator.h"
+
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using Region = BufferAllocator::Region;
+    using Placement = BufferAllocator::Placement;
+
+    // Heap with a byte budget per region; counts calls and remembers the last request
+    struct FakeHeap
+    {
+        size_t budget[2];
+        size_t used[2];
+        size_t allocations;
+        size_t frees;
+        bool lastDma;
+        size_t errors;
+        std::string lastReport;
+    };
+    FakeHeap heap;
+
+    size_t idx(Region r) { return r == Region::Psram ? 1 : 0; }
+
+    void *fakeAllocate(size_t bytes, Region region, bool dma)
+    {
+        heap.lastDma = dma;
+        if (heap.used[idx(region)] + bytes > heap.budget[idx(region)])
+            return nullptr;
+        heap.used[idx(region)] += bytes;
+        heap.allocations++;
+        return malloc(bytes);
+    }
+
+    void fakeFree(void *raw, Region region, size_t bytes)
+    {
+        heap.used[idx(region)] -= bytes;
+        heap.frees++;
+        free(raw);
+    }
+
+    size_t fakeFreeBytes(Region region) { return heap.budget[idx(region)] - heap.used[idx(region)]; }
+    size_t fakeTotalBytes(Region region) { return heap.budget[idx(region)]; }
+
+    void fakeReport(bool error, const char *message)
+    {
+        heap.errors += error;
+        heap.lastReport = message;
+    }
+
+    const BufferAllocator::Backend FAKE = {fakeAllocate, fakeFree, fakeFreeBytes, fakeTotalBytes, fakeReport};
+
+    void useFakeHeap(size_t internalBytes, size_t psramBytes)
+    {
+        heap = FakeHeap{{internalBytes, psramBytes}, {0, 0}, 0, 0, false, 0, std::string()};
+        BufferAllocator::instance().setBackend(&FAKE);
+    }
+
+    MemoryAccounting::ModuleStats statsOf(MemoryAccounting::ModuleId id)
+    {
+        MemoryAccounting::ModuleStats all[MemoryAccounting::MAX_MODULES];
+        const size_t n = MemoryAccounting::instance().stats(all, MemoryAccounting::MAX_MODULES);
+        TEST_ASSERT_TRUE(id < n);
+        return all[id];
+    }
+
+    constexpr size_t HEADER = 8;
+}
+
+void setUp()
+{
+    useFakeHeap(64 * 1024, 64 * 1024);
+    BufferAllocator::instance().setPsramEnabled(true);
+}
+
+void tearDown()
+{
+    BufferAllocator::instance().setBackend(nullptr);
+}
+
+void test_placement_policy()
+{
+    BufferAllocator &ba = BufferAllocator::instance();
+    TEST_ASSERT_TRUE(ba.psramAvailable());
+
+    void *small = ba.allocate(BufferAllocator::PSRAM_MIN_BYTES - 1, Placement::Large);
+    void *large = ba.allocate(BufferAllocator::PSRAM_MIN_BYTES, Placement::Large);
+    void *tiny = ba.allocate(16, Placement::Psram);
+    void *internal = ba.allocate(4096, Placement::Internal);
+    TEST_ASSERT_FALSE(heap.lastDma);
+    void *dma = ba.allocate(64, Placement::Dma);
+    TEST_ASSERT_TRUE(heap.lastDma);
+
+    TEST_ASSERT_TRUE(ba.regionOf(small) == Region::Internal);
+    TEST_ASSERT_TRUE(ba.regionOf(large) == Region::Psram);
+    TEST_ASSERT_TRUE(ba.regionOf(tiny) == Region::Psram);
+    TEST_ASSERT_TRUE(ba.regionOf(internal) == Region::Internal);
+    TEST_ASSERT_TRUE(ba.regionOf(dma) == Region::Internal);
+    TEST_ASSERT_EQUAL(BufferAllocator::PSRAM_MIN_BYTES, BufferAllocator::sizeOf(large));
+    TEST_ASSERT_EQUAL(0, (uintptr_t)large % 8);
+
+    // Header included in what the backend sees
+    TEST_ASSERT_EQUAL(BufferAllocator::PSRAM_MIN_BYTES + 16 + 2 * HEADER, heap.used[1]);
+
+    for (void *p : {small, large, tiny, internal, dma})
+        ba.release(p);
+    TEST_ASSERT_EQUAL(0, heap.used[0]);
+    TEST_ASSERT_EQUAL(0, heap.used[1]);
+    TEST_ASSERT_EQUAL(heap.allocations, heap.frees);
+}
+
+void test_without_psram_everything_is_internal()
+{
+    useFakeHeap(64 * 1024, 0);
+    BufferAllocator &ba = BufferAllocator::instance();
+    TEST_ASSERT_FALSE(ba.psramAvailable());
+    void *p = ba.allocate(8192, Placement::Psram);
+    TEST_ASSERT_NOT_NULL(p);
+    TEST_ASSERT_TRUE(ba.regionOf(p) == Region::Internal);
+    ba.release(p);
+
+    useFakeHeap(64 * 1024, 64 * 1024);
+    ba.setPsramEnabled(false);
+    p = ba.allocate(8192, Placement::Large);
+    TEST_ASSERT_TRUE(ba.regionOf(p) == Region::Internal);
+    ba.release(p);
+}
+
+void test_psram_full_falls_back_to_internal()
+{
+    useFakeHeap(16 * 1024, 4 * 1024);
+    BufferAllocator &ba = BufferAllocator::instance();
+    void *a = ba.allocate(3000, Placement::Large);
+    void *b = ba.allocate(3000, Placement::Large); // does not fit the remaining PSRAM
+    TEST_ASSERT_TRUE(ba.regionOf(a) == Region::Psram);
+    TEST_ASSERT_TRUE(ba.regionOf(b) == Region::Internal);
+    TEST_ASSERT_FALSE(heap.lastDma);
+    ba.release(a);
+    ba.release(b);
+}
+
+void test_accounting_and_failures_per_module()
+{
+    const MemoryAccounting::ModuleId mod = MemoryAccounting::instance().registerModule("test-accounting");
+    TEST_ASSERT_NOT_EQUAL(MemoryAccounting::INVALID_MODULE, mod);
+    TEST_ASSERT_EQUAL(mod, MemoryAccounting::instance().registerModule("test-accounting"));
+
+    useFakeHeap(8 * 1024, 8 * 1024);
+    BufferAllocator &ba = BufferAllocator::instance();
+    void *psram = ba.allocate(1000, Placement::Large, mod);
+    void *internal = ba.allocate(100, Placement::Internal, mod);
+    MemoryAccounting::ModuleStats s = statsOf(mod);
+    TEST_ASSERT_EQUAL(100, s.bytes);
+    TEST_ASSERT_EQUAL(1000, s.psramBytes);
+    TEST_ASSERT_EQUAL(2, s.allocs);
+
+    // Neither region can hold this one
+    TEST_ASSERT_NULL(ba.allocate(20 * 1024, Placement::Large, mod));
+    TEST_ASSERT_EQUAL(1, statsOf(mod).failures);
+
+    ba.release(psram);
+    ba.release(internal);
+    s = statsOf(mod);
+    TEST_ASSERT_EQUAL(0, s.bytes);
+    TEST_ASSERT_EQUAL(0, s.psramBytes);
+    TEST_ASSERT_EQUAL(100, s.peakBytes);
+    TEST_ASSERT_EQUAL(1000, s.psramPeakBytes);
+}
+
+void test_foreign_release_is_reported_not_freed()
+{
+    BufferAllocator &ba = BufferAllocator::instance();
+    uint64_t foreign[4] = {0, 0, 0, 0};
+    ba.release(&foreign[1]);
+    TEST_ASSERT_EQUAL(1, heap.errors);
+    TEST_ASSERT_EQUAL(0, heap.frees);
+
+    void *p = ba.allocate(32, Placement::Internal);
+    ba.release(p);
+    TEST_ASSERT_EQUAL(1, heap.frees);
+    ba.release(nullptr);
+    TEST_ASSERT_EQUAL(1, heap.errors);
+}
+
+void test_buffer_ptr_releases()
+{
+    {
+        BufferPtr<uint8_t[]> buf(static_cast<uint8_t *>(BufferAllocator::instance().allocate(600, Placement::Large)));
+        TEST_ASSERT_NOT_NULL(buf.get());
+        buf[599] = 1;
+        TEST_ASSERT_EQUAL(600 + HEADER, heap.used[1]);
+    }
+    TEST_ASSERT_EQUAL(0, heap.used[1]);
+    TEST_ASSERT_EQUAL(1, heap.frees);
+}
+
+void test_begin_reports_through_backend()
+{
+    BufferAllocator::instance().begin();
+    TEST_ASSERT_EQUAL_STRING("BufferAllocator: PSRAM 64 KiB (64 KiB free), large buffers go there", heap.lastReport.c_str());
+    useFakeHeap(1024, 0);
+    BufferAllocator::instance().begin();
+    TEST_ASSERT_EQUAL_STRING("BufferAllocator: no PSRAM, all buffers internal", heap.lastReport.c_str());
+    TEST_ASSERT_EQUAL(0, heap.errors);
+}
+
+void test_host_backend_simulates_psram_budget()
+{
+    BufferAllocator &ba = BufferAllocator::instance();
+    ba.setBackend(nullptr);
+    TEST_ASSERT_EQUAL(BufferAllocator::HOST_PSRAM_BYTES, ba.totalBytes(Region::Psram));
+    TEST_ASSERT_EQUAL(BufferAllocator::HOST_PSRAM_BYTES, ba.freeBytes(Region::Psram));
+
+    // Fill the pretend PSRAM with 64 KiB blocks; the one that does not fit goes internal
+    std::vector<void *> blocks;
+    constexpr size_t BLOCK = 64 * 1024;
+    for (size_t i = 0; i < BufferAllocator::HOST_PSRAM_BYTES / BLOCK; ++i)
+    {
+        blocks.push_back(ba.allocate(BLOCK, Placement::Large));
+        TEST_ASSERT_NOT_NULL(blocks.back());
+    }
+    // Headers used the last few bytes of the budget, so the 32nd block already fell back
+    TEST_ASSERT_TRUE(ba.regionOf(blocks.back()) == Region::Internal);
+    TEST_ASSERT_TRUE(ba.regionOf(blocks.front()) == Region::Psram);
+    TEST_ASSERT_LESS_THAN(BLOCK, ba.freeBytes(Region::Psram));
+
+    for (void *p : blocks)
+        ba.release(p);
+    TEST_ASSERT_EQUAL(BufferAllocator::HOST_PSRAM_BYTES, ba.freeBytes(Region::Psram));
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_placement_policy);
+    RUN_TEST(test_without_psram_everything_is_internal);
+    RUN_TEST(test_psram_full_falls_back_to_internal);
+    RUN_TEST(test_accounting_and_failures_per_module);
+    RUN_TEST(test_foreign_release_is_reported_not_freed);
+    RUN_TEST(test_buffer_ptr_releases);
+    RUN_TEST(test_begin_reports_through_backend);
+    RUN_TEST(test_host_backend_simulates_psram_budget);
+    return UNITY_END();
+}
@@ -0,0 +1,305 @@
+/**
+ * @file test_main.cpp
+ * @brief CaptiveDns reply encoder (A and SOA tails, NOTIMP/FORMERR, malformed queries) and the
+ *        responder task over loopback UDP, with a queries/s figure.
+ *
+ * The loopback benchmark is the host-side counterpart of scripts/dns_load.py; it measures
+ * the encoder and the drain-per-wake loop, not the ESP32's WiFi and lwIP. Not asserted.
+ */
+
+#include <unity.h>
+#include "captiveDns.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace
+{
+    constexpr uint16_t TEST_PORT = 53053;
+    const IPAddress PORTAL(192, 168, 4, 1);
+
+    constexpr uint16_t TYPE_A = 1, TYPE_AAAA = 28, TYPE_HTTPS = 65, TYPE_ANY = 255;
+    constexpr uint16_t CLASS_IN = 1, CLASS_CH = 3;
+
+    const uint8_t A_TAIL[] = {0xC0, 0x0C, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x04, 192, 168, 4, 1};
+    const uint8_t SOA_TAIL[] = {0xC0, 0x0C, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x16, 0x00, 0x00,
+                                0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0E, 0x10, 0x00, 0x00, 0x02, 0x58,
+                                0x00, 0x01, 0x51, 0x80, 0x00, 0x00, 0x00, 0x1E};
+
+    void push16(std::vector<uint8_t> &v, uint16_t x)
+    {
+        v.push_back((uint8_t)(x >> 8));
+        v.push_back((uint8_t)x);
+    }
+
+    // Standard recursive query for one name, optionally with an EDNS OPT record like phones send
+    std::vector<uint8_t> query(const std::string &name, uint16_t type, uint16_t qclass = CLASS_IN,
+                               uint16_t id = 0x1234, bool edns = false)
+    {
+        std::vector<uint8_t> q;
+        push16(q, id);
+        push16(q, 0x0100); // RD
+        push16(q, 1);
+        push16(q, 0);
+        push16(q, 0);
+        push16(q, edns ? 1 : 0);
+        size_t start = 0;
+        while (start <= name.size())
+        {
+            size_t dot = name.find('.', start);
+            if (dot == std::string::npos)
+                dot = name.size();
+            q.push_back((uint8_t)(dot - start));
+            q.insert(q.end(), name.begin() + start, name.begin() + dot);
+            start = dot + 1;
+        }
+        q.push_back(0);
+        push16(q, type);
+        push16(q, qclass);
+        if (edns)
+        {
+            const uint8_t opt[] = {0x00, 0x00, 0x29, 0x05, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+            q.insert(q.end(), opt, opt + sizeof(opt));
+        }
+        return q;
+    }
+
+    size_t questionEnd(const std::vector<uint8_t> &q)
+    {
+        size_t pos = 12;
+        while (q[pos])
+            pos += 1 + q[pos];
+        return pos + 5;
+    }
+
+    uint16_t get16(const uint8_t *p) { return (uint16_t)((p[0] << 8) | p[1]); }
+
+    size_t answer(const std::vector<uint8_t> &q, std::vector<uint8_t> &reply, CaptiveDns::Outcome &outcome)
+    {
+        reply.assign(CaptiveDns::REPLY_BUFFER, 0xEE);
+        const size_t n = CaptiveDns::instance().answer(q.data(), q.size(), reply.data(), reply.size(), outcome);
+        reply.resize(n);
+        return n;
+    }
+
+    void checkHeader(const std::vector<uint8_t> &reply, uint16_t id, uint16_t an, uint16_t ns)
+    {
+        TEST_ASSERT_EQUAL_HEX16(id, get16(&reply[0]));
+        TEST_ASSERT_EQUAL_HEX8(0x85, reply[2]); // QR, AA, RD
+        TEST_ASSERT_EQUAL_HEX8(0x80, reply[3]); // RA, NOERROR
+        TEST_ASSERT_EQUAL(1, get16(&reply[4]));
+        TEST_ASSERT_EQUAL(an, get16(&reply[6]));
+        TEST_ASSERT_EQUAL(ns, get16(&reply[8]));
+        TEST_ASSERT_EQUAL(0, get16(&reply[10])); // OPT not echoed
+    }
+
+    int clientSocket()
+    {
+        const int s = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+        timeval tv = {1, 0};
+        setsockopt(s, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+        return s;
+    }
+
+    sockaddr_in responderAddress()
+    {
+        sockaddr_in to = {};
+        to.sin_family = AF_INET;
+        to.sin_port = htons(TEST_PORT);
+        to.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        return to;
+    }
+}
+
+void setUp()
+{
+    // start() builds the reply templates, so the encoder tests need it too
+    if (!CaptiveDns::instance().running())
+        TEST_ASSERT_TRUE(CaptiveDns::instance().start(PORTAL, TEST_PORT));
+}
+
+void tearDown() {}
+
+void test_a_query_gets_portal_address()
+{
+    for (bool edns : {false, true})
+    {
+        const std::vector<uint8_t> q = query("connectivitycheck.gstatic.com", TYPE_A, CLASS_IN, 0xBEEF, edns);
+        std::vector<uint8_t> reply;
+        CaptiveDns::Outcome outcome;
+        const size_t qEnd = questionEnd(q);
+        TEST_ASSERT_EQUAL(qEnd + sizeof(A_TAIL), answer(q, reply, outcome));
+        TEST_ASSERT_TRUE(outcome == CaptiveDns::Outcome::Answered);
+        checkHeader(reply, 0xBEEF, 1, 0);
+        TEST_ASSERT_EQUAL_MEMORY(q.data() + 12, reply.data() + 12, qEnd - 12);
+        TEST_ASSERT_EQUAL_MEMORY(A_TAIL, reply.data() + qEnd, sizeof(A_TAIL));
+    }
+
+    const std::vector<uint8_t> any = query("captive.apple.com", TYPE_ANY);
+    std::vector<uint8_t> reply;
+    CaptiveDns::Outcome outcome;
+    answer(any, reply, outcome);
+    TEST_ASSERT_TRUE(outcome == CaptiveDns::Outcome::Answered);
+}
+
+void test_other_types_get_cacheable_nodata()
+{
+    for (uint16_t type : {TYPE_AAAA, TYPE_HTTPS})
+    {
+        const std::vector<uint8_t> q = query("www.apple.com", type, CLASS_IN, 0x0042, true);
+        std::vector<uint8_t> reply;
+        CaptiveDns::Outcome outcome;
+        const size_t qEnd = questionEnd(q);
+        TEST_ASSERT_EQUAL(qEnd + sizeof(SOA_TAIL), answer(q, reply, outcome));
+        TEST_ASSERT_TRUE(outcome == CaptiveDns::Outcome::Negative);
+        checkHeader(reply, 0x0042, 0, 1);
+        TEST_ASSERT_EQUAL_MEMORY(SOA_TAIL, reply.data() + qEnd, sizeof(SOA_TAIL));
+    }
+
+    // A outside class IN is not ours to answer either
+    const std::vector<uint8_t> chaos = query("version.bind", TYPE_A, CLASS_CH);
+    std::vector<uint8_t> reply;
+    CaptiveDns::Outcome outcome;
+    answer(chaos, reply, outcome);
+    TEST_ASSERT_TRUE(outcome == CaptiveDns::Outcome::Negative);
+}
+
+void test_unsupported_queries_are_rejected_header_only()
+{
+    std::vector<uint8_t> q = query("example.com", TYPE_A);
+    q[2] = 0x10 | 0x01; // opcode 2 (STATUS), RD
+    std::vector<uint8_t> reply;
+    CaptiveDns::Outcome outcome;
+    TEST_ASSERT_EQUAL(12, answer(q, reply, outcome));
+    TEST_ASSERT_TRUE(outcome == CaptiveDns::Outcome::Rejected);
+    TEST_ASSERT_EQUAL_HEX8(0x91, reply[2]); // QR, opcode kept, RD
+    TEST_ASSERT_EQUAL_HEX8(0x84, reply[3]); // RA, NOTIMP
+    for (int i = 4; i < 12; ++i)
+        TEST_ASSERT_EQUAL(0, reply[i]);
+
+    q = query("example.com", TYPE_A);
+    q[5] = 2; // QDCOUNT 2
+    TEST_ASSERT_EQUAL(12, answer(q, reply, outcome));
+    TEST_ASSERT_TRUE(outcome == CaptiveDns::Outcome::Rejected);
+    TEST_ASSERT_EQUAL_HEX8(0x81, reply[3]); // RA, FORMERR
+}
+
+void test_malformed_packets_are_dropped()
+{
+    std::vector<uint8_t> reply;
+    CaptiveDns::Outcome outcome;
+    const std::vector<uint8_t> good = query("captive.apple.com", TYPE_A);
+
+    std::vector<uint8_t> q(good.begin(), good.begin() + 11); // shorter than a header
+    TEST_ASSERT_EQUAL(0, answer(q, reply, outcome));
+    TEST_ASSERT_TRUE(outcome == CaptiveDns::Outcome::Dropped);
+
+    q = good;
+    q[2] |= 0x80; // a response
+    TEST_ASSERT_EQUAL(0, answer(q, reply, outcome));
+
+    q.assign(good.begin(), good.end() - 2); // qclass cut off
+    TEST_ASSERT_EQUAL(0, answer(q, reply, outcome));
+
+    q.assign(good.begin(), good.begin() + 16); // name runs off the end
+    TEST_ASSERT_EQUAL(0, answer(q, reply, outcome));
+
+    q = good;
+    q[12] = 0xC0; // compression pointer in the question
+    TEST_ASSERT_EQUAL(0, answer(q, reply, outcome));
+
+    std::string longName;
+    for (int i = 0; i < 5; ++i)
+        longName += std::string(60, 'a' + i) + ".";
+    q = query(longName + "com", TYPE_A); // over 255 octets
+    TEST_ASSERT_EQUAL(0, answer(q, reply, outcome));
+    TEST_ASSERT_TRUE(outcome == CaptiveDns::Outcome::Dropped);
+}
+
+void test_reply_buffer_limits()
+{
+    // Longest legal name plus padding up to MAX_PACKET still fits REPLY_BUFFER
+    std::string name;
+    for (int i = 0; i < 3; ++i)
+        name += std::string(63, 'x') + ".";
+    name += std::string(61, 'y');
+    std::vector<uint8_t> q = query(name, TYPE_AAAA);
+    q.resize(CaptiveDns::MAX_PACKET, 0);
+    std::vector<uint8_t> reply;
+    CaptiveDns::Outcome outcome;
+    TEST_ASSERT_EQUAL(questionEnd(q) + sizeof(SOA_TAIL), answer(q, reply, outcome));
+
+    // A caller's buffer too small for the tail gets nothing rather than a cut reply
+    q = query("captive.apple.com", TYPE_A);
+    uint8_t small[40];
+    TEST_ASSERT_EQUAL(0, CaptiveDns::instance().answer(q.data(), q.size(), small, sizeof(small), outcome));
+}
+
+void test_loopback_burst_and_throughput()
+{
+    CaptiveDns &dns = CaptiveDns::instance();
+    dns.resetStats();
+    const int s = clientSocket();
+    const sockaddr_in to = responderAddress();
+    const char *names[] = {"connectivitycheck.gstatic.com", "captive.apple.com", "www.msftconnecttest.com"};
+    const uint16_t types[] = {TYPE_A, TYPE_AAAA, TYPE_HTTPS};
+
+    // A phone joining: every probe sent before any reply is read
+    constexpr int BURST = 24;
+    for (int i = 0; i < BURST; ++i)
+    {
+        const std::vector<uint8_t> q = query(names[i % 3], types[i / 3 % 3], CLASS_IN, (uint16_t)i);
+        sendto(s, q.data(), q.size(), 0, reinterpret_cast<const sockaddr *>(&to), sizeof(to));
+    }
+    uint8_t rx[CaptiveDns::REPLY_BUFFER];
+    int replies = 0;
+    while (replies < BURST && recv(s, rx, sizeof(rx), 0) > 0)
+        replies++;
+    TEST_ASSERT_EQUAL(BURST, replies);
+
+    // Sustained: one query in flight at a time, like dns_load.py --concurrency 1
+    constexpr int QUERIES = 20000;
+    int answered = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < QUERIES; ++i)
+    {
+        const std::vector<uint8_t> q = query(names[i % 3], types[i % 3], CLASS_IN, (uint16_t)i);
+        sendto(s, q.data(), q.size(), 0, reinterpret_cast<const sockaddr *>(&to), sizeof(to));
+        const ssize_t n = recv(s, rx, sizeof(rx), 0);
+        answered += n > 12 && get16(rx) == (uint16_t)i;
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    close(s);
+    dns.stop();
+    TEST_ASSERT_FALSE(dns.running());
+
+    TEST_ASSERT_EQUAL(QUERIES, answered);
+    const CaptiveDns::Stats st = dns.stats();
+    TEST_ASSERT_EQUAL(BURST + QUERIES, st.queries);
+    TEST_ASSERT_EQUAL(st.queries, st.answered + st.negative);
+    TEST_ASSERT_EQUAL(0, st.dropped);
+    TEST_ASSERT_GREATER_THAN(1, st.maxBatch); // the burst was drained per wake
+
+    char msg[160];
+    snprintf(msg, sizeof(msg), "loopback: %.0f queries/s, %.1f us round trip; burst of %d drained in up to %u per wake",
+             QUERIES / seconds, seconds * 1e6 / QUERIES, BURST, (unsigned)st.maxBatch);
+    TEST_MESSAGE(msg);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_a_query_gets_portal_address);
+    RUN_TEST(test_other_types_get_cacheable_nodata);
+    RUN_TEST(test_unsupported_queries_are_rejected_header_only);
+    RUN_TEST(test_malformed_packets_are_dropped);
+    RUN_TEST(test_reply_buffer_limits);
+    RUN_TEST(test_loopback_burst_and_throughput);
+    return UNITY_END();
+}
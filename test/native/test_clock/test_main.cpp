@@ -0,0 +1,164 @@
+/**
+ * @file test_main.cpp
+ * @brief System monotonic clock, uptime, wall clock and timers over several 32-bit millis() wraps.
+ *
+ * A millis() counter wraps every 2^32 ms (~49.7 days). The System clock is fed from
+ * FakeClock, so the tests jump straight to uptimes of several wraps.
+ */
+
+#include <unity.h>
+#include "system.h"
+#include "fakeClock.h"
+
+namespace
+{
+    constexpr uint64_t WRAP_MS = 1ULL << 32;
+    constexpr int64_t US_PER_S = 1000000LL;
+    constexpr int64_t WALL_2024 = 1704067200LL * US_PER_S; // 2024-01-01T00:00:00Z
+}
+
+void setUp()
+{
+    FakeClock::setUs(0);
+    System::instance().init();
+}
+
+void tearDown() {}
+
+void test_monotonic_ms_past_three_wraps()
+{
+    const uint64_t t = 3 * WRAP_MS + 1234;
+    FakeClock::setMs(t);
+    TEST_ASSERT_EQUAL_UINT64(t, System::instance().monotonicMs());
+    TEST_ASSERT_EQUAL_INT64((int64_t)t * 1000, System::instance().monotonicUs());
+    // What a 32-bit millis() would report at the same moment
+    TEST_ASSERT_EQUAL_UINT32(1234, (uint32_t)t);
+}
+
+void test_uptime_counts_from_init_across_wraps()
+{
+    FakeClock::setMs(WRAP_MS - 500);
+    System::instance().init();
+    FakeClock::advanceMs(1000);
+    TEST_ASSERT_EQUAL_UINT64(1000, System::instance().getUptime());
+
+    // Second and third wrap: the old millis() reconstruction lost 2^32 ms on each
+    FakeClock::advanceMs(2 * WRAP_MS);
+    TEST_ASSERT_EQUAL_UINT64(2 * WRAP_MS + 1000, System::instance().getUptime());
+}
+
+void test_deadline_compare_across_wrap()
+{
+    FakeClock::setMs(2 * WRAP_MS - 50);
+    const uint64_t deadline = System::instance().monotonicMs() + 100;
+    FakeClock::advanceMs(60); // past the wrap, deadline not reached
+    TEST_ASSERT_FALSE(System::instance().monotonicMs() >= deadline);
+    FakeClock::advanceMs(40);
+    TEST_ASSERT_TRUE(System::instance().monotonicMs() >= deadline);
+}
+
+void test_wall_clock_follows_monotonic_across_wraps()
+{
+    System &sys = System::instance();
+    FakeClock::setMs(WRAP_MS - 10000);
+    sys.setWallClock(WALL_2024, sys.monotonicUs(), System::TimeSource::Rtc);
+    TEST_ASSERT_EQUAL_INT32(0, sys.driftPpb());
+
+    FakeClock::advanceMs(2 * WRAP_MS);
+    TEST_ASSERT_EQUAL_INT64(WALL_2024 + (int64_t)(2 * WRAP_MS) * 1000, sys.now());
+
+    char iso[25];
+    TEST_ASSERT_TRUE(System::formatIso8601(sys.now(), iso, sizeof(iso)));
+    TEST_ASSERT_EQUAL_STRING("2024-04-09T10:05:34.592Z", iso);
+}
+
+void test_drift_applies_without_overflow_across_wraps()
+{
+    System &sys = System::instance();
+    // Two Ntp references one hour apart; the local clock lost 36 ms (10 ppm slow)
+    FakeClock::setMs(WRAP_MS - 3600000);
+    sys.setWallClock(WALL_2024, sys.monotonicUs(), System::TimeSource::Ntp);
+    FakeClock::advanceMs(3600000);
+    sys.setWallClock(WALL_2024 + 3600LL * US_PER_S + 36000, sys.monotonicUs(), System::TimeSource::Ntp);
+    TEST_ASSERT_EQUAL_INT32(10000, sys.driftPpb());
+    const int64_t refWall = sys.now();
+
+    // No sync for three wraps (~149 days): elapsed * drift exceeds int64 range here
+    const int64_t elapsedUs = (int64_t)(3 * WRAP_MS) * 1000;
+    FakeClock::advanceUs(elapsedUs);
+    TEST_ASSERT_EQUAL_INT64(refWall + elapsedUs + elapsedUs / 100000, sys.now());
+}
+
+void test_drift_measured_over_a_long_span()
+{
+    System &sys = System::instance();
+    // References two wraps apart (~99 days) with 20 ppm drift
+    const int64_t spanUs = (int64_t)(2 * WRAP_MS) * 1000;
+    FakeClock::setMs(5 * WRAP_MS);
+    sys.setWallClock(WALL_2024, sys.monotonicUs(), System::TimeSource::Ntp);
+    const int32_t smoothedFrom = sys.driftPpb();
+    FakeClock::advanceUs(spanUs);
+    sys.setWallClock(WALL_2024 + spanUs + spanUs / 50000, sys.monotonicUs(), System::TimeSource::Ntp);
+    const int32_t expected = smoothedFrom == 0 ? 20000 : (int32_t)((3LL * smoothedFrom + 20000) / 4);
+    TEST_ASSERT_INT32_WITHIN(1, expected, sys.driftPpb());
+
+    // A wall jump of days is rejected, not wrapped into a plausible-looking drift
+    const int32_t before = sys.driftPpb();
+    FakeClock::advanceUs(spanUs);
+    sys.setWallClock(WALL_2024 + 3 * spanUs, sys.monotonicUs(), System::TimeSource::Ntp);
+    TEST_ASSERT_EQUAL_INT32(before, sys.driftPpb());
+}
+
+void test_timers_fire_across_wraps()
+{
+    System &sys = System::instance();
+    FakeClock::setMs(WRAP_MS - 3000);
+    sys.runTimers(); // catch the wheel up to the clock
+
+    int fired = 0;
+    const TimerWheel::TimerId id = sys.timers().schedulePeriodic(1000, [&fired] { fired++; });
+    TEST_ASSERT_NOT_EQUAL(0, id);
+
+    int oneShot = 0;
+    sys.timers().schedule(3500, [&oneShot] { oneShot++; });
+
+    for (int step = 0; step < 24; ++step) // 6 s in 250 ms steps, straddling the wrap
+    {
+        FakeClock::advanceMs(250);
+        sys.runTimers();
+    }
+    TEST_ASSERT_EQUAL(6, fired);
+    TEST_ASSERT_EQUAL(1, oneShot);
+
+    TEST_ASSERT_TRUE(sys.timers().cancel(id));
+
+    // Idle until just before the next wrap, then a one-shot due right after it
+    FakeClock::setMs(2 * WRAP_MS - 3000);
+    TEST_ASSERT_EQUAL(0, sys.runTimers());
+    sys.timers().schedule(3500, [&oneShot] { oneShot++; });
+    TEST_ASSERT_TRUE(sys.msUntilNextTimer() > 0 && sys.msUntilNextTimer() <= 3500);
+    FakeClock::advanceMs(3499);
+    sys.runTimers();
+    TEST_ASSERT_EQUAL(1, oneShot);
+    FakeClock::advanceMs(1);
+    sys.runTimers();
+    TEST_ASSERT_EQUAL(2, oneShot);
+    TEST_ASSERT_EQUAL(6, fired);
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, sys.msUntilNextTimer());
+}
+
+int main(int argc, char **argv)
+{
+    // Before anything touches System::timers(), which reads the clock on first use
+    System::instance().setClockSource(FakeClock::read);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_monotonic_ms_past_three_wraps);
+    RUN_TEST(test_uptime_counts_from_init_across_wraps);
+    RUN_TEST(test_deadline_compare_across_wrap);
+    RUN_TEST(test_wall_clock_follows_monotonic_across_wraps);
+    RUN_TEST(test_drift_applies_without_overflow_across_wraps);
+    RUN_TEST(test_drift_measured_over_a_long_span);
+    RUN_TEST(test_timers_fire_across_wraps);
+    return UNITY_END();
+}
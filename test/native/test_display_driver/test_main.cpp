@@ -0,0 +1,223 @@
+/**
+ * @file test_main.cpp
+ * @brief DisplayDriver backends on a fake I2C bus: probing, page-major framebuffers going
+ *        out unconverted, two panels sharing one bus, and the memory backend's failure path.
+ */
+
+#include <unity.h>
+#include "displayDriver.h"
+#include "bufferAllocator.h"
+
+#include <vector>
+
+namespace
+{
+    DisplayGeometry geometry(DisplayController controller, uint8_t address, uint16_t height = 64)
+    {
+        DisplayGeometry g;
+        g.controller = controller;
+        g.address = address;
+        g.height = height;
+        return g;
+    }
+
+    // Data bytes (0x40 transfers) sent to `address`, in bus order
+    std::vector<uint8_t> dataSentTo(const TwoWire &bus, uint8_t address)
+    {
+        std::vector<uint8_t> out;
+        for (const auto &t : bus.log())
+            if (t.address == address && t.acked && !t.bytes.empty() && t.bytes[0] == 0x40)
+                out.insert(out.end(), t.bytes.begin() + 1, t.bytes.end());
+        return out;
+    }
+
+    // Single-byte commands (0x00 transfers) sent to `address`, in bus order
+    std::vector<uint8_t> commandsSentTo(const TwoWire &bus, uint8_t address)
+    {
+        std::vector<uint8_t> out;
+        for (const auto &t : bus.log())
+            if (t.address == address && t.bytes.size() == 2 && t.bytes[0] == 0x00)
+                out.push_back(t.bytes[1]);
+        return out;
+    }
+
+    void drawPattern(DisplayDriver &d)
+    {
+        d.gfx().drawPixel(0, 0, DISPLAY_WHITE);
+        d.gfx().drawPixel(3, 10, DISPLAY_WHITE);
+        d.gfx().drawFastVLine(127, 0, 64, DISPLAY_WHITE);
+        d.gfx().drawPixel(127, 5, 2); // inverse
+    }
+
+    // Backend whose heap is always exhausted
+    void *noAllocate(size_t, BufferAllocator::Region, bool) { return nullptr; }
+    void noFree(void *, BufferAllocator::Region, size_t) {}
+    size_t noBytes(BufferAllocator::Region) { return 0; }
+    void noReport(bool, const char *) {}
+    const BufferAllocator::Backend EXHAUSTED = {noAllocate, noFree, noBytes, noBytes, noReport};
+}
+
+void setUp() {}
+void tearDown()
+{
+    BufferAllocator::instance().setBackend(nullptr);
+}
+
+void test_controller_names_round_trip()
+{
+    for (DisplayController c : {DisplayController::Ssd1306, DisplayController::Sh1106, DisplayController::Memory, DisplayController::None})
+        TEST_ASSERT_TRUE(DisplayDriver::controllerFromString(DisplayDriver::controllerToString(c)) == c);
+    TEST_ASSERT_TRUE(DisplayDriver::controllerFromString(" SH1106 ") == DisplayController::Sh1106);
+    TEST_ASSERT_TRUE(DisplayDriver::controllerFromString("st7735") == DisplayController::None);
+}
+
+void test_create_rejects_unusable_geometry()
+{
+    TEST_ASSERT_NULL(DisplayDriver::create(geometry(DisplayController::Memory, 0, 60), Wire).get());
+    TEST_ASSERT_NULL(DisplayDriver::create(geometry(DisplayController::Memory, 0, 0), Wire).get());
+    TEST_ASSERT_NULL(DisplayDriver::create(geometry(DisplayController::None, 0x3C), Wire).get());
+    TEST_ASSERT_NOT_NULL(DisplayDriver::create(geometry(DisplayController::Memory, 0, 32), Wire).get());
+}
+
+void test_memory_driver_is_page_major_without_bus_traffic()
+{
+    TwoWire bus;
+    auto d = DisplayDriver::create(geometry(DisplayController::Memory, 0x3C), bus);
+    TEST_ASSERT_TRUE(d->begin());
+    drawPattern(*d);
+    d->flush();
+    const uint8_t *fb = d->buffer();
+    TEST_ASSERT_EQUAL_HEX8(0x01, fb[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x04, fb[3 + 1 * 128]);                  // (3,10): page 1, bit 2
+    TEST_ASSERT_EQUAL_HEX8(0xDF, fb[127]);                          // column 127, y = 5 toggled off
+    TEST_ASSERT_EQUAL_HEX8(0xFF, fb[127 + 7 * 128]);
+    TEST_ASSERT_EQUAL(0, bus.log().size());
+
+    d->clearBuffer();
+    for (size_t i = 0; i < 128 * 8; ++i)
+        TEST_ASSERT_EQUAL_HEX8(0, fb[i]);
+}
+
+void test_memory_driver_begin_fails_without_memory()
+{
+    const MemoryAccounting::ModuleId display = MemoryAccounting::instance().registerModule("display");
+    MemoryAccounting::ModuleStats before[MemoryAccounting::MAX_MODULES];
+    MemoryAccounting::instance().stats(before, MemoryAccounting::MAX_MODULES);
+
+    BufferAllocator::instance().setBackend(&EXHAUSTED);
+    auto d = DisplayDriver::create(geometry(DisplayController::Memory, 0), Wire);
+    TEST_ASSERT_NOT_NULL(d.get());
+    TEST_ASSERT_FALSE(d->begin());
+    TEST_ASSERT_NULL(d->buffer());
+
+    // A caller that ignores begin() must not crash
+    d->clearBuffer();
+    drawPattern(*d);
+    d->flush();
+
+    MemoryAccounting::ModuleStats after[MemoryAccounting::MAX_MODULES];
+    MemoryAccounting::instance().stats(after, MemoryAccounting::MAX_MODULES);
+    TEST_ASSERT_EQUAL(before[display].failures + 1, after[display].failures);
+}
+
+void test_ssd1306_probes_its_address()
+{
+    TwoWire bus;
+    bus.attach(0x3C);
+    TEST_ASSERT_TRUE(DisplayDriver::create(geometry(DisplayController::Ssd1306, 0x3C), bus)->begin());
+    TEST_ASSERT_FALSE(DisplayDriver::create(geometry(DisplayController::Ssd1306, 0x3D), bus)->begin());
+    TEST_ASSERT_FALSE(DisplayDriver::create(geometry(DisplayController::Sh1106, 0x3D), bus)->begin());
+}
+
+void test_ssd1306_flushes_framebuffer_unconverted()
+{
+    TwoWire bus;
+    bus.attach(0x3C);
+    auto d = DisplayDriver::create(geometry(DisplayController::Ssd1306, 0x3C, 32), bus);
+    TEST_ASSERT_TRUE(d->begin());
+    drawPattern(*d);
+    bus.clearLog();
+    d->flush();
+
+    const std::vector<uint8_t> sent = dataSentTo(bus, 0x3C);
+    TEST_ASSERT_EQUAL(128 * 4, sent.size());
+    TEST_ASSERT_EQUAL_MEMORY(d->buffer(), sent.data(), sent.size());
+    for (const auto &t : bus.log())
+        TEST_ASSERT_TRUE(t.bytes.size() <= 32); // fits the Wire buffer
+}
+
+void test_two_panels_share_one_bus()
+{
+    TwoWire bus;
+    bus.attach(0x3C);
+    bus.attach(0x3D);
+    auto left = DisplayDriver::create(geometry(DisplayController::Ssd1306, 0x3C), bus);
+    auto right = DisplayDriver::create(geometry(DisplayController::Sh1106, 0x3D), bus);
+    TEST_ASSERT_TRUE(left->begin());
+    TEST_ASSERT_TRUE(right->begin());
+
+    left->gfx().fillRect(0, 0, 8, 8, DISPLAY_WHITE);
+    drawPattern(*right);
+    bus.clearLog();
+    left->flush();
+    right->flush();
+
+    const std::vector<uint8_t> l = dataSentTo(bus, 0x3C);
+    const std::vector<uint8_t> r = dataSentTo(bus, 0x3D);
+    TEST_ASSERT_EQUAL(128 * 8, l.size());
+    TEST_ASSERT_EQUAL(128 * 8, r.size());
+    TEST_ASSERT_EQUAL_MEMORY(left->buffer(), l.data(), l.size());
+    TEST_ASSERT_EQUAL_MEMORY(right->buffer(), r.data(), r.size());
+    TEST_ASSERT_EQUAL_HEX8(0xFF, l[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x00, l[8]);
+
+    // SH1106: one page per transfer, each addressed at column 2 of its 132-column RAM
+    const std::vector<uint8_t> cmds = commandsSentTo(bus, 0x3D);
+    TEST_ASSERT_EQUAL(8 * 3, cmds.size());
+    for (uint8_t page = 0; page < 8; ++page)
+    {
+        TEST_ASSERT_EQUAL_HEX8(0xB0 + page, cmds[page * 3]);
+        TEST_ASSERT_EQUAL_HEX8(0x02, cmds[page * 3 + 1]);
+        TEST_ASSERT_EQUAL_HEX8(0x10, cmds[page * 3 + 2]);
+    }
+}
+
+void test_contrast_and_invert_commands()
+{
+    TwoWire bus;
+    bus.attach(0x3C);
+    bus.attach(0x3D);
+    auto ssd = DisplayDriver::create(geometry(DisplayController::Ssd1306, 0x3C), bus);
+    auto sh = DisplayDriver::create(geometry(DisplayController::Sh1106, 0x3D), bus);
+    TEST_ASSERT_TRUE(ssd->begin());
+    TEST_ASSERT_TRUE(sh->begin());
+    bus.clearLog();
+
+    ssd->setContrast(0x42);
+    ssd->invert(true);
+    sh->setContrast(0x17);
+    sh->invert(false);
+
+    const std::vector<uint8_t> a = commandsSentTo(bus, 0x3C);
+    const std::vector<uint8_t> b = commandsSentTo(bus, 0x3D);
+    const uint8_t expectA[] = {0x81, 0x42, 0xA7};
+    const uint8_t expectB[] = {0x81, 0x17, 0xA6};
+    TEST_ASSERT_EQUAL(3, a.size());
+    TEST_ASSERT_EQUAL(3, b.size());
+    TEST_ASSERT_EQUAL_MEMORY(expectA, a.data(), 3);
+    TEST_ASSERT_EQUAL_MEMORY(expectB, b.data(), 3);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_controller_names_round_trip);
+    RUN_TEST(test_create_rejects_unusable_geometry);
+    RUN_TEST(test_memory_driver_is_page_major_without_bus_traffic);
+    RUN_TEST(test_memory_driver_begin_fails_without_memory);
+    RUN_TEST(test_ssd1306_probes_its_address);
+    RUN_TEST(test_ssd1306_flushes_framebuffer_unconverted);
+    RUN_TEST(test_two_panels_share_one_bus);
+    RUN_TEST(test_contrast_and_invert_commands);
+    return UNITY_END();
+}
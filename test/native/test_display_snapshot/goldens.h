@@ -0,0 +1,1030 @@
+#pragma once
+// Generated by scripts/snapshot_goldens.py -- do not edit.
+
+#include <stdint.h>
+
+namespace Golden
+{
+    constexpr uint8_t PANEL_128X64_PNG[1156] = {
+        0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
+        0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xAD, 0x42,
+        0xD2, 0x00, 0x00, 0x04, 0x4B, 0x49, 0x44, 0x41, 0x54, 0x78, 0x01, 0x01, 0x40, 0x04, 0xBF, 0xFB,
+        0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0x00, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+        0x66, 0x66, 0x00, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4,
+        0xB4, 0xB4, 0xB4, 0x00, 0x6D, 0x92, 0x6D, 0x92, 0x6D, 0x92, 0x6D, 0x92, 0x6D, 0x92, 0x6D, 0x92,
+        0x6D, 0x92, 0x6D, 0x92, 0x00, 0x1C, 0x71, 0xE3, 0x8E, 0x1C, 0x71, 0xE3, 0x8E, 0x1C, 0x71, 0xE3,
+        0x8E, 0x1C, 0x71, 0xE3, 0x8E, 0x00, 0x56, 0xA5, 0x4A, 0xD4, 0xA9, 0x5A, 0xB5, 0x2B, 0x56, 0xA5,
+        0x4A, 0xD4, 0xA9, 0x5A, 0xB5, 0x2B, 0x00, 0x32, 0x6C, 0xD9, 0xB2, 0x64, 0xC9, 0x93, 0x66, 0xCD,
+        0x93, 0x26, 0x4D, 0x9B, 0x36, 0x6C, 0x99, 0x00, 0x0E, 0x1C, 0x38, 0x71, 0xE3, 0xC7, 0x8F, 0x1E,
+        0x3C, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x78, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+        0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+        0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x00, 0x36, 0xC9, 0x36, 0xC9,
+        0x36, 0xC9, 0x36, 0xC9, 0x36, 0xC9, 0x36, 0xC9, 0x36, 0xC9, 0x36, 0xC9, 0x00, 0xF1, 0xC7, 0x0E,
+        0x38, 0xF1, 0xC7, 0x0E, 0x38, 0xF1, 0xC7, 0x0E, 0x38, 0xF1, 0xC7, 0x0E, 0x38, 0x00, 0x5A, 0x95,
+        0xAB, 0x52, 0xA5, 0x6A, 0x54, 0xAD, 0x5A, 0x95, 0xAB, 0x52, 0xA5, 0x6A, 0x54, 0xAD, 0x00, 0x36,
+        0x4C, 0x99, 0x36, 0x6C, 0xD9, 0x32, 0x64, 0xC9, 0xB3, 0x66, 0xC9, 0x93, 0x26, 0xCD, 0x9B, 0x00,
+        0xF1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0xF1, 0xE3, 0xC7, 0x8F, 0x1E, 0x38, 0x70, 0xE1, 0xC3, 0x87,
+        0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0x00, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+        0x99, 0x99, 0x00, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+        0x2D, 0x2D, 0x2D, 0x00, 0x9B, 0x64, 0x9B, 0x64, 0x9B, 0x64, 0x9B, 0x64, 0x9B, 0x64, 0x9B, 0x64,
+        0x9B, 0x64, 0x9B, 0x64, 0x00, 0x87, 0x1C, 0x78, 0xE3, 0x87, 0x1C, 0x78, 0xE3, 0x87, 0x1C, 0x78,
+        0xE3, 0x87, 0x1C, 0x78, 0xE3, 0x00, 0x2A, 0x56, 0xAD, 0x4A, 0xD5, 0xA9, 0x52, 0xB5, 0x2A, 0x56,
+        0xAD, 0x4A, 0xD5, 0xA9, 0x52, 0xB5, 0x00, 0x66, 0xCD, 0x9B, 0x26, 0x4C, 0x9B, 0x36, 0x6C, 0x99,
+        0x32, 0x64, 0xD9, 0xB3, 0x64, 0xC9, 0x93, 0x00, 0x1E, 0x3C, 0x78, 0xE1, 0xC3, 0x87, 0x0E, 0x1C,
+        0x78, 0xF1, 0xE3, 0xC7, 0x8F, 0x1C, 0x38, 0x70, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
+        0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x00, 0x96, 0x96, 0x96, 0x96, 0x96,
+        0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x00, 0x4D, 0xB2, 0x4D, 0xB2,
+        0x4D, 0xB2, 0x4D, 0xB2, 0x4D, 0xB2, 0x4D, 0xB2, 0x4D, 0xB2, 0x4D, 0xB2, 0x00, 0x3C, 0x71, 0xC3,
+        0x8E, 0x3C, 0x71, 0xC3, 0x8E, 0x3C, 0x71, 0xC3, 0x8E, 0x3C, 0x71, 0xC3, 0x8E, 0x00, 0xA9, 0x5A,
+        0x95, 0x2B, 0x56, 0xA5, 0x6A, 0xD4, 0xA9, 0x5A, 0x95, 0x2B, 0x56, 0xA5, 0x6A, 0xD4, 0x00, 0x64,
+        0xC9, 0xB3, 0x66, 0xCD, 0x93, 0x26, 0x4D, 0x9B, 0x36, 0x4C, 0x99, 0x32, 0x6C, 0xD9, 0xB2, 0x00,
+        0xE3, 0xC7, 0x8F, 0x1E, 0x3C, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0x8E,
+        0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0x00, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+        0x66, 0x66, 0x00, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B,
+        0x4B, 0x4B, 0x4B, 0x00, 0x26, 0xD9, 0x26, 0xD9, 0x26, 0xD9, 0x26, 0xD9, 0x26, 0xD9, 0x26, 0xD9,
+        0x26, 0xD9, 0x26, 0xD9, 0x00, 0xE1, 0xC7, 0x1E, 0x38, 0xE1, 0xC7, 0x1E, 0x38, 0xE1, 0xC7, 0x1E,
+        0x38, 0xE1, 0xC7, 0x1E, 0x38, 0x00, 0xB5, 0x6A, 0x54, 0xAD, 0x4A, 0x95, 0xAB, 0x52, 0xB5, 0x6A,
+        0x54, 0xAD, 0x4A, 0x95, 0xAB, 0x52, 0x00, 0x6C, 0xD9, 0x32, 0x64, 0xD9, 0xB3, 0x66, 0xC9, 0x93,
+        0x26, 0xCD, 0x9B, 0x26, 0x4C, 0x99, 0x36, 0x00, 0x1C, 0x38, 0xF1, 0xE3, 0xC7, 0x8F, 0x1E, 0x38,
+        0x70, 0xE1, 0xC3, 0x87, 0x1E, 0x3C, 0x78, 0xF1, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+        0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+        0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x00, 0x93, 0x6C, 0x93, 0x6C,
+        0x93, 0x6C, 0x93, 0x6C, 0x93, 0x6C, 0x93, 0x6C, 0x93, 0x6C, 0x93, 0x6C, 0x00, 0x8F, 0x1C, 0x70,
+        0xE3, 0x8F, 0x1C, 0x70, 0xE3, 0x8F, 0x1C, 0x70, 0xE3, 0x8F, 0x1C, 0x70, 0xE3, 0x00, 0xD5, 0xA9,
+        0x5A, 0xB5, 0x2A, 0x56, 0xA5, 0x4A, 0xD5, 0xA9, 0x5A, 0xB5, 0x2A, 0x56, 0xA5, 0x4A, 0x00, 0x4C,
+        0x9B, 0x36, 0x6C, 0x99, 0x32, 0x6C, 0xD9, 0xB3, 0x64, 0xC9, 0x93, 0x66, 0xCD, 0x93, 0x26, 0x00,
+        0xC3, 0x87, 0x0E, 0x1C, 0x78, 0xF1, 0xE3, 0xC7, 0x8F, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x8F, 0x1E,
+        0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0x00, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+        0x99, 0x99, 0x00, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2,
+        0xD2, 0xD2, 0xD2, 0x00, 0x49, 0xB6, 0x49, 0xB6, 0x49, 0xB6, 0x49, 0xB6, 0x49, 0xB6, 0x49, 0xB6,
+        0x49, 0xB6, 0x49, 0xB6, 0x00, 0x38, 0x71, 0xC7, 0x8E, 0x38, 0x71, 0xC7, 0x8E, 0x38, 0x71, 0xC7,
+        0x8E, 0x38, 0x71, 0xC7, 0x8E, 0x00, 0x52, 0xA5, 0x6A, 0xD4, 0xAD, 0x5A, 0x95, 0x2B, 0x52, 0xA5,
+        0x6A, 0xD4, 0xAD, 0x5A, 0x95, 0x2B, 0x00, 0xC9, 0x93, 0x26, 0x4D, 0x9B, 0x36, 0x4C, 0x99, 0x36,
+        0x6C, 0xD9, 0xB2, 0x64, 0xC9, 0xB3, 0x66, 0x00, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x3C, 0x78,
+        0xF1, 0xE3, 0xC7, 0x8E, 0x1C, 0x38, 0x70, 0xE1, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
+        0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x00, 0x69, 0x69, 0x69, 0x69, 0x69,
+        0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x00, 0x24, 0xDB, 0x24, 0xDB,
+        0x24, 0xDB, 0x24, 0xDB, 0x24, 0xDB, 0x24, 0xDB, 0x24, 0xDB, 0x24, 0xDB, 0x00, 0xE3, 0xC7, 0x1C,
+        0x38, 0xE3, 0xC7, 0x1C, 0x38, 0xE3, 0xC7, 0x1C, 0x38, 0xE3, 0xC7, 0x1C, 0x38, 0x00, 0x4A, 0x95,
+        0xA9, 0x52, 0xB5, 0x6A, 0x56, 0xAD, 0x4A, 0x95, 0xA9, 0x52, 0xB5, 0x6A, 0x56, 0xAD, 0x00, 0xD9,
+        0xB3, 0x64, 0xC9, 0x93, 0x26, 0xCD, 0x9B, 0x26, 0x4C, 0x9B, 0x36, 0x6C, 0xD9, 0x32, 0x64, 0x00,
+        0xC7, 0x8F, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0x0E, 0x1C,
+        0x9E, 0x57, 0xFE, 0xED, 0x82, 0x41, 0x12, 0x04, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44,
+        0xAE, 0x42, 0x60, 0x82,
+    };
+    constexpr uint8_t PANEL_128X64_P1[8266] = {
+        0x50, 0x31, 0x0A, 0x31, 0x32, 0x38, 0x20, 0x36, 0x34, 0x0A, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x0A, 0x31, 0x30, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x0A, 0x30, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x0A, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x0A, 0x31, 0x31,
+        0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30,
+        0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31,
+        0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30,
+        0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31,
+        0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30,
+        0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31,
+        0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30,
+        0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x0A, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x0A,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31,
+        0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30,
+        0x0A, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31,
+        0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31,
+        0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30,
+        0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30,
+        0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31,
+        0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30,
+        0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30,
+        0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31,
+        0x31, 0x0A, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x0A, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x30, 0x0A, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x30, 0x31, 0x0A, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x0A, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30,
+        0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31,
+        0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30,
+        0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31,
+        0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30,
+        0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31,
+        0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30,
+        0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31,
+        0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x0A, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x0A, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31,
+        0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30,
+        0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x0A, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31,
+        0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30,
+        0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31,
+        0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31,
+        0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30,
+        0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30,
+        0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31,
+        0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30,
+        0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x0A, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x0A, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x0A, 0x31, 0x31, 0x30, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x0A, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x0A, 0x30, 0x31,
+        0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30,
+        0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31,
+        0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30,
+        0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31,
+        0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30,
+        0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31,
+        0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30,
+        0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x0A, 0x31,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x0A,
+        0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31,
+        0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31,
+        0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30,
+        0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x0A, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31,
+        0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31,
+        0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30,
+        0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31,
+        0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31,
+        0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30,
+        0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31,
+        0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31,
+        0x31, 0x0A, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x0A, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x0A, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x0A, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x31, 0x0A, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30,
+        0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31,
+        0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30,
+        0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31,
+        0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30,
+        0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31,
+        0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30,
+        0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31,
+        0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x0A, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x0A, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31,
+        0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30,
+        0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x0A, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30,
+        0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30,
+        0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31,
+        0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31,
+        0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30,
+        0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31,
+        0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31,
+        0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30,
+        0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x0A, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x0A, 0x31, 0x30, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x0A, 0x31, 0x30, 0x31, 0x31,
+        0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31,
+        0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31,
+        0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31,
+        0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31,
+        0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31,
+        0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31,
+        0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31,
+        0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x0A, 0x31, 0x31, 0x30,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x0A, 0x30, 0x30,
+        0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31,
+        0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30,
+        0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31,
+        0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30,
+        0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31,
+        0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30,
+        0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31,
+        0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x0A, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x0A,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30,
+        0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31,
+        0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31,
+        0x0A, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31,
+        0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30,
+        0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30,
+        0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31,
+        0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31,
+        0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30,
+        0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31,
+        0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31,
+        0x30, 0x0A, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x0A, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x30, 0x0A, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x30, 0x0A, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x31, 0x0A, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31,
+        0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30,
+        0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31,
+        0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30,
+        0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31,
+        0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30,
+        0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31,
+        0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30,
+        0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x0A, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x0A, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31,
+        0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x0A, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30,
+        0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30,
+        0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31,
+        0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30,
+        0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30,
+        0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31,
+        0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31,
+        0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30,
+        0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x0A, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x0A, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x0A, 0x30, 0x30, 0x31, 0x30,
+        0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30,
+        0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30,
+        0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30,
+        0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30,
+        0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30,
+        0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30,
+        0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30,
+        0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x0A, 0x31, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x0A, 0x31, 0x31,
+        0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30,
+        0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31,
+        0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30,
+        0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31,
+        0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30,
+        0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31,
+        0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30,
+        0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x0A, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x0A,
+        0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31,
+        0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30,
+        0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x0A, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31,
+        0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30,
+        0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30,
+        0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31,
+        0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30,
+        0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30,
+        0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31,
+        0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31,
+        0x30, 0x0A, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x0A, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x0A, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31,
+        0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31,
+        0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31,
+        0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31,
+        0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31,
+        0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31,
+        0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31,
+        0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31,
+        0x30, 0x31, 0x31, 0x30, 0x0A, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x30, 0x0A, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30,
+        0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31,
+        0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30,
+        0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31,
+        0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30,
+        0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31,
+        0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30,
+        0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31,
+        0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x0A, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x0A, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30,
+        0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31,
+        0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x0A, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30,
+        0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31,
+        0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31,
+        0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30,
+        0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30,
+        0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31,
+        0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30,
+        0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30,
+        0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x0A,
+    };
+    constexpr uint8_t PANEL_128X64_P4[1034] = {
+        0x50, 0x34, 0x0A, 0x31, 0x32, 0x38, 0x20, 0x36, 0x34, 0x0A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+        0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B,
+        0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x92, 0x6D, 0x92, 0x6D, 0x92, 0x6D,
+        0x92, 0x6D, 0x92, 0x6D, 0x92, 0x6D, 0x92, 0x6D, 0x92, 0x6D, 0xE3, 0x8E, 0x1C, 0x71, 0xE3, 0x8E,
+        0x1C, 0x71, 0xE3, 0x8E, 0x1C, 0x71, 0xE3, 0x8E, 0x1C, 0x71, 0xA9, 0x5A, 0xB5, 0x2B, 0x56, 0xA5,
+        0x4A, 0xD4, 0xA9, 0x5A, 0xB5, 0x2B, 0x56, 0xA5, 0x4A, 0xD4, 0xCD, 0x93, 0x26, 0x4D, 0x9B, 0x36,
+        0x6C, 0x99, 0x32, 0x6C, 0xD9, 0xB2, 0x64, 0xC9, 0x93, 0x66, 0xF1, 0xE3, 0xC7, 0x8E, 0x1C, 0x38,
+        0x70, 0xE1, 0xC3, 0x8F, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0x87, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
+        0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+        0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xC9, 0x36, 0xC9, 0x36, 0xC9, 0x36,
+        0xC9, 0x36, 0xC9, 0x36, 0xC9, 0x36, 0xC9, 0x36, 0xC9, 0x36, 0x0E, 0x38, 0xF1, 0xC7, 0x0E, 0x38,
+        0xF1, 0xC7, 0x0E, 0x38, 0xF1, 0xC7, 0x0E, 0x38, 0xF1, 0xC7, 0xA5, 0x6A, 0x54, 0xAD, 0x5A, 0x95,
+        0xAB, 0x52, 0xA5, 0x6A, 0x54, 0xAD, 0x5A, 0x95, 0xAB, 0x52, 0xC9, 0xB3, 0x66, 0xC9, 0x93, 0x26,
+        0xCD, 0x9B, 0x36, 0x4C, 0x99, 0x36, 0x6C, 0xD9, 0x32, 0x64, 0x0E, 0x3C, 0x78, 0xF1, 0xE3, 0xC7,
+        0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC7, 0x8F, 0x1E, 0x3C, 0x78, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+        0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2,
+        0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0x64, 0x9B, 0x64, 0x9B, 0x64, 0x9B,
+        0x64, 0x9B, 0x64, 0x9B, 0x64, 0x9B, 0x64, 0x9B, 0x64, 0x9B, 0x78, 0xE3, 0x87, 0x1C, 0x78, 0xE3,
+        0x87, 0x1C, 0x78, 0xE3, 0x87, 0x1C, 0x78, 0xE3, 0x87, 0x1C, 0xD5, 0xA9, 0x52, 0xB5, 0x2A, 0x56,
+        0xAD, 0x4A, 0xD5, 0xA9, 0x52, 0xB5, 0x2A, 0x56, 0xAD, 0x4A, 0x99, 0x32, 0x64, 0xD9, 0xB3, 0x64,
+        0xC9, 0x93, 0x66, 0xCD, 0x9B, 0x26, 0x4C, 0x9B, 0x36, 0x6C, 0xE1, 0xC3, 0x87, 0x1E, 0x3C, 0x78,
+        0xF1, 0xE3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE3, 0xC7, 0x8F, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+        0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
+        0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0xB2, 0x4D, 0xB2, 0x4D, 0xB2, 0x4D,
+        0xB2, 0x4D, 0xB2, 0x4D, 0xB2, 0x4D, 0xB2, 0x4D, 0xB2, 0x4D, 0xC3, 0x8E, 0x3C, 0x71, 0xC3, 0x8E,
+        0x3C, 0x71, 0xC3, 0x8E, 0x3C, 0x71, 0xC3, 0x8E, 0x3C, 0x71, 0x56, 0xA5, 0x6A, 0xD4, 0xA9, 0x5A,
+        0x95, 0x2B, 0x56, 0xA5, 0x6A, 0xD4, 0xA9, 0x5A, 0x95, 0x2B, 0x9B, 0x36, 0x4C, 0x99, 0x32, 0x6C,
+        0xD9, 0xB2, 0x64, 0xC9, 0xB3, 0x66, 0xCD, 0x93, 0x26, 0x4D, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x8F,
+        0x1E, 0x3C, 0x78, 0xF1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x71, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+        0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4,
+        0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xD9, 0x26, 0xD9, 0x26, 0xD9, 0x26,
+        0xD9, 0x26, 0xD9, 0x26, 0xD9, 0x26, 0xD9, 0x26, 0xD9, 0x26, 0x1E, 0x38, 0xE1, 0xC7, 0x1E, 0x38,
+        0xE1, 0xC7, 0x1E, 0x38, 0xE1, 0xC7, 0x1E, 0x38, 0xE1, 0xC7, 0x4A, 0x95, 0xAB, 0x52, 0xB5, 0x6A,
+        0x54, 0xAD, 0x4A, 0x95, 0xAB, 0x52, 0xB5, 0x6A, 0x54, 0xAD, 0x93, 0x26, 0xCD, 0x9B, 0x26, 0x4C,
+        0x99, 0x36, 0x6C, 0xD9, 0x32, 0x64, 0xD9, 0xB3, 0x66, 0xC9, 0xE3, 0xC7, 0x0E, 0x1C, 0x38, 0x70,
+        0xE1, 0xC7, 0x8F, 0x1E, 0x3C, 0x78, 0xE1, 0xC3, 0x87, 0x0E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
+        0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+        0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x6C, 0x93, 0x6C, 0x93, 0x6C, 0x93,
+        0x6C, 0x93, 0x6C, 0x93, 0x6C, 0x93, 0x6C, 0x93, 0x6C, 0x93, 0x70, 0xE3, 0x8F, 0x1C, 0x70, 0xE3,
+        0x8F, 0x1C, 0x70, 0xE3, 0x8F, 0x1C, 0x70, 0xE3, 0x8F, 0x1C, 0x2A, 0x56, 0xA5, 0x4A, 0xD5, 0xA9,
+        0x5A, 0xB5, 0x2A, 0x56, 0xA5, 0x4A, 0xD5, 0xA9, 0x5A, 0xB5, 0xB3, 0x64, 0xC9, 0x93, 0x66, 0xCD,
+        0x93, 0x26, 0x4C, 0x9B, 0x36, 0x6C, 0x99, 0x32, 0x6C, 0xD9, 0x3C, 0x78, 0xF1, 0xE3, 0x87, 0x0E,
+        0x1C, 0x38, 0x70, 0xE3, 0xC7, 0x8F, 0x1E, 0x3C, 0x70, 0xE1, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+        0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+        0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0xB6, 0x49, 0xB6, 0x49, 0xB6, 0x49,
+        0xB6, 0x49, 0xB6, 0x49, 0xB6, 0x49, 0xB6, 0x49, 0xB6, 0x49, 0xC7, 0x8E, 0x38, 0x71, 0xC7, 0x8E,
+        0x38, 0x71, 0xC7, 0x8E, 0x38, 0x71, 0xC7, 0x8E, 0x38, 0x71, 0xAD, 0x5A, 0x95, 0x2B, 0x52, 0xA5,
+        0x6A, 0xD4, 0xAD, 0x5A, 0x95, 0x2B, 0x52, 0xA5, 0x6A, 0xD4, 0x36, 0x6C, 0xD9, 0xB2, 0x64, 0xC9,
+        0xB3, 0x66, 0xC9, 0x93, 0x26, 0x4D, 0x9B, 0x36, 0x4C, 0x99, 0xC7, 0x8F, 0x1E, 0x3C, 0x78, 0xF1,
+        0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x71, 0xE3, 0xC7, 0x8F, 0x1E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+        0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+        0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0xDB, 0x24, 0xDB, 0x24, 0xDB, 0x24,
+        0xDB, 0x24, 0xDB, 0x24, 0xDB, 0x24, 0xDB, 0x24, 0xDB, 0x24, 0x1C, 0x38, 0xE3, 0xC7, 0x1C, 0x38,
+        0xE3, 0xC7, 0x1C, 0x38, 0xE3, 0xC7, 0x1C, 0x38, 0xE3, 0xC7, 0xB5, 0x6A, 0x56, 0xAD, 0x4A, 0x95,
+        0xA9, 0x52, 0xB5, 0x6A, 0x56, 0xAD, 0x4A, 0x95, 0xA9, 0x52, 0x26, 0x4C, 0x9B, 0x36, 0x6C, 0xD9,
+        0x32, 0x64, 0xD9, 0xB3, 0x64, 0xC9, 0x93, 0x26, 0xCD, 0x9B, 0x38, 0x70, 0xE3, 0xC7, 0x8F, 0x1E,
+        0x3C, 0x78, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0xF1, 0xE3,
+    };
+    constexpr uint8_t PANEL_128X32_PNG[612] = {
+        0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
+        0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF2, 0x59, 0x4D,
+        0x88, 0x00, 0x00, 0x02, 0x2B, 0x49, 0x44, 0x41, 0x54, 0x78, 0x01, 0x01, 0x20, 0x02, 0xDF, 0xFD,
+        0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0x00, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+        0x66, 0x66, 0x00, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4,
+        0xB4, 0xB4, 0xB4, 0x00, 0x6D, 0x92, 0x6D, 0x92, 0x6D, 0x92, 0x6D, 0x92, 0x6D, 0x92, 0x6D, 0x92,
+        0x6D, 0x92, 0x6D, 0x92, 0x00, 0x1C, 0x71, 0xE3, 0x8E, 0x1C, 0x71, 0xE3, 0x8E, 0x1C, 0x71, 0xE3,
+        0x8E, 0x1C, 0x71, 0xE3, 0x8E, 0x00, 0x56, 0xA5, 0x4A, 0xD4, 0xA9, 0x5A, 0xB5, 0x2B, 0x56, 0xA5,
+        0x4A, 0xD4, 0xA9, 0x5A, 0xB5, 0x2B, 0x00, 0x32, 0x6C, 0xD9, 0xB2, 0x64, 0xC9, 0x93, 0x66, 0xCD,
+        0x93, 0x26, 0x4D, 0x9B, 0x36, 0x6C, 0x99, 0x00, 0x0E, 0x1C, 0x38, 0x71, 0xE3, 0xC7, 0x8F, 0x1E,
+        0x3C, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x78, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+        0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+        0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x00, 0x36, 0xC9, 0x36, 0xC9,
+        0x36, 0xC9, 0x36, 0xC9, 0x36, 0xC9, 0x36, 0xC9, 0x36, 0xC9, 0x36, 0xC9, 0x00, 0xF1, 0xC7, 0x0E,
+        0x38, 0xF1, 0xC7, 0x0E, 0x38, 0xF1, 0xC7, 0x0E, 0x38, 0xF1, 0xC7, 0x0E, 0x38, 0x00, 0x5A, 0x95,
+        0xAB, 0x52, 0xA5, 0x6A, 0x54, 0xAD, 0x5A, 0x95, 0xAB, 0x52, 0xA5, 0x6A, 0x54, 0xAD, 0x00, 0x36,
+        0x4C, 0x99, 0x36, 0x6C, 0xD9, 0x32, 0x64, 0xC9, 0xB3, 0x66, 0xC9, 0x93, 0x26, 0xCD, 0x9B, 0x00,
+        0xF1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0xF1, 0xE3, 0xC7, 0x8F, 0x1E, 0x38, 0x70, 0xE1, 0xC3, 0x87,
+        0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0x00, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+        0x99, 0x99, 0x00, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+        0x2D, 0x2D, 0x2D, 0x00, 0x9B, 0x64, 0x9B, 0x64, 0x9B, 0x64, 0x9B, 0x64, 0x9B, 0x64, 0x9B, 0x64,
+        0x9B, 0x64, 0x9B, 0x64, 0x00, 0x87, 0x1C, 0x78, 0xE3, 0x87, 0x1C, 0x78, 0xE3, 0x87, 0x1C, 0x78,
+        0xE3, 0x87, 0x1C, 0x78, 0xE3, 0x00, 0x2A, 0x56, 0xAD, 0x4A, 0xD5, 0xA9, 0x52, 0xB5, 0x2A, 0x56,
+        0xAD, 0x4A, 0xD5, 0xA9, 0x52, 0xB5, 0x00, 0x66, 0xCD, 0x9B, 0x26, 0x4C, 0x9B, 0x36, 0x6C, 0x99,
+        0x32, 0x64, 0xD9, 0xB3, 0x64, 0xC9, 0x93, 0x00, 0x1E, 0x3C, 0x78, 0xE1, 0xC3, 0x87, 0x0E, 0x1C,
+        0x78, 0xF1, 0xE3, 0xC7, 0x8F, 0x1C, 0x38, 0x70, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
+        0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x00, 0x96, 0x96, 0x96, 0x96, 0x96,
+        0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x00, 0x4D, 0xB2, 0x4D, 0xB2,
+        0x4D, 0xB2, 0x4D, 0xB2, 0x4D, 0xB2, 0x4D, 0xB2, 0x4D, 0xB2, 0x4D, 0xB2, 0x00, 0x3C, 0x71, 0xC3,
+        0x8E, 0x3C, 0x71, 0xC3, 0x8E, 0x3C, 0x71, 0xC3, 0x8E, 0x3C, 0x71, 0xC3, 0x8E, 0x00, 0xA9, 0x5A,
+        0x95, 0x2B, 0x56, 0xA5, 0x6A, 0xD4, 0xA9, 0x5A, 0x95, 0x2B, 0x56, 0xA5, 0x6A, 0xD4, 0x00, 0x64,
+        0xC9, 0xB3, 0x66, 0xCD, 0x93, 0x26, 0x4D, 0x9B, 0x36, 0x4C, 0x99, 0x32, 0x6C, 0xD9, 0xB2, 0x00,
+        0xE3, 0xC7, 0x8F, 0x1E, 0x3C, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0x8E,
+        0x62, 0xAF, 0xFC, 0x52, 0x0E, 0x6B, 0xBA, 0x80, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44,
+        0xAE, 0x42, 0x60, 0x82,
+    };
+    constexpr uint8_t PANEL_128X32_P1[4138] = {
+        0x50, 0x31, 0x0A, 0x31, 0x32, 0x38, 0x20, 0x33, 0x32, 0x0A, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x0A, 0x31, 0x30, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x0A, 0x30, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x0A, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x0A, 0x31, 0x31,
+        0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30,
+        0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31,
+        0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30,
+        0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31,
+        0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30,
+        0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31,
+        0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30,
+        0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x0A, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x0A,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31,
+        0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30,
+        0x0A, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31,
+        0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31,
+        0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30,
+        0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30,
+        0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31,
+        0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30,
+        0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30,
+        0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31,
+        0x31, 0x0A, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x0A, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x30, 0x0A, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x30, 0x31, 0x0A, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x0A, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30,
+        0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31,
+        0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30,
+        0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31,
+        0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30,
+        0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31,
+        0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30,
+        0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31,
+        0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x0A, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x0A, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31,
+        0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30,
+        0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x0A, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31,
+        0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30,
+        0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31,
+        0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31,
+        0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30,
+        0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30,
+        0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31,
+        0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30,
+        0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x0A, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x0A, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x0A, 0x31, 0x31, 0x30, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x0A, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x0A, 0x30, 0x31,
+        0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30,
+        0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31,
+        0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30,
+        0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31,
+        0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30,
+        0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31,
+        0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30,
+        0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x0A, 0x31,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x0A,
+        0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31,
+        0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31,
+        0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30,
+        0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x0A, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31,
+        0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31,
+        0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30,
+        0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31,
+        0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31,
+        0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30,
+        0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31,
+        0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31,
+        0x31, 0x0A, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x0A, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x0A, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x0A, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x31, 0x0A, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30,
+        0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31,
+        0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30,
+        0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31,
+        0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30,
+        0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31,
+        0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30,
+        0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31,
+        0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x0A, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x0A, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31,
+        0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31,
+        0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30,
+        0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31,
+        0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31,
+        0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30,
+        0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x0A, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30,
+        0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30,
+        0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31,
+        0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31,
+        0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30,
+        0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31,
+        0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31,
+        0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30,
+        0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x0A,
+    };
+    constexpr uint8_t PANEL_128X32_P4[522] = {
+        0x50, 0x34, 0x0A, 0x31, 0x32, 0x38, 0x20, 0x33, 0x32, 0x0A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+        0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B,
+        0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x92, 0x6D, 0x92, 0x6D, 0x92, 0x6D,
+        0x92, 0x6D, 0x92, 0x6D, 0x92, 0x6D, 0x92, 0x6D, 0x92, 0x6D, 0xE3, 0x8E, 0x1C, 0x71, 0xE3, 0x8E,
+        0x1C, 0x71, 0xE3, 0x8E, 0x1C, 0x71, 0xE3, 0x8E, 0x1C, 0x71, 0xA9, 0x5A, 0xB5, 0x2B, 0x56, 0xA5,
+        0x4A, 0xD4, 0xA9, 0x5A, 0xB5, 0x2B, 0x56, 0xA5, 0x4A, 0xD4, 0xCD, 0x93, 0x26, 0x4D, 0x9B, 0x36,
+        0x6C, 0x99, 0x32, 0x6C, 0xD9, 0xB2, 0x64, 0xC9, 0x93, 0x66, 0xF1, 0xE3, 0xC7, 0x8E, 0x1C, 0x38,
+        0x70, 0xE1, 0xC3, 0x8F, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0x87, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
+        0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+        0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xC9, 0x36, 0xC9, 0x36, 0xC9, 0x36,
+        0xC9, 0x36, 0xC9, 0x36, 0xC9, 0x36, 0xC9, 0x36, 0xC9, 0x36, 0x0E, 0x38, 0xF1, 0xC7, 0x0E, 0x38,
+        0xF1, 0xC7, 0x0E, 0x38, 0xF1, 0xC7, 0x0E, 0x38, 0xF1, 0xC7, 0xA5, 0x6A, 0x54, 0xAD, 0x5A, 0x95,
+        0xAB, 0x52, 0xA5, 0x6A, 0x54, 0xAD, 0x5A, 0x95, 0xAB, 0x52, 0xC9, 0xB3, 0x66, 0xC9, 0x93, 0x26,
+        0xCD, 0x9B, 0x36, 0x4C, 0x99, 0x36, 0x6C, 0xD9, 0x32, 0x64, 0x0E, 0x3C, 0x78, 0xF1, 0xE3, 0xC7,
+        0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC7, 0x8F, 0x1E, 0x3C, 0x78, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+        0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2,
+        0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0x64, 0x9B, 0x64, 0x9B, 0x64, 0x9B,
+        0x64, 0x9B, 0x64, 0x9B, 0x64, 0x9B, 0x64, 0x9B, 0x64, 0x9B, 0x78, 0xE3, 0x87, 0x1C, 0x78, 0xE3,
+        0x87, 0x1C, 0x78, 0xE3, 0x87, 0x1C, 0x78, 0xE3, 0x87, 0x1C, 0xD5, 0xA9, 0x52, 0xB5, 0x2A, 0x56,
+        0xAD, 0x4A, 0xD5, 0xA9, 0x52, 0xB5, 0x2A, 0x56, 0xAD, 0x4A, 0x99, 0x32, 0x64, 0xD9, 0xB3, 0x64,
+        0xC9, 0x93, 0x66, 0xCD, 0x9B, 0x26, 0x4C, 0x9B, 0x36, 0x6C, 0xE1, 0xC3, 0x87, 0x1E, 0x3C, 0x78,
+        0xF1, 0xE3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE3, 0xC7, 0x8F, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+        0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
+        0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0xB2, 0x4D, 0xB2, 0x4D, 0xB2, 0x4D,
+        0xB2, 0x4D, 0xB2, 0x4D, 0xB2, 0x4D, 0xB2, 0x4D, 0xB2, 0x4D, 0xC3, 0x8E, 0x3C, 0x71, 0xC3, 0x8E,
+        0x3C, 0x71, 0xC3, 0x8E, 0x3C, 0x71, 0xC3, 0x8E, 0x3C, 0x71, 0x56, 0xA5, 0x6A, 0xD4, 0xA9, 0x5A,
+        0x95, 0x2B, 0x56, 0xA5, 0x6A, 0xD4, 0xA9, 0x5A, 0x95, 0x2B, 0x9B, 0x36, 0x4C, 0x99, 0x32, 0x6C,
+        0xD9, 0xB2, 0x64, 0xC9, 0xB3, 0x66, 0xCD, 0x93, 0x26, 0x4D, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x8F,
+        0x1E, 0x3C, 0x78, 0xF1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x71,
+    };
+    constexpr uint8_t ODD_13X8_PNG[92] = {
+        0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
+        0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x5D, 0x48,
+        0x62, 0x00, 0x00, 0x00, 0x23, 0x49, 0x44, 0x41, 0x54, 0x78, 0x01, 0x01, 0x18, 0x00, 0xE7, 0xFF,
+        0x00, 0xAA, 0xA8, 0x00, 0x66, 0x60, 0x00, 0xB4, 0xB0, 0x00, 0x6D, 0x90, 0x00, 0x1C, 0x70, 0x00,
+        0x56, 0xA0, 0x00, 0x32, 0x68, 0x00, 0x0E, 0x18, 0x60, 0x92, 0x06, 0xBC, 0xC7, 0xDB, 0x9B, 0x9C,
+        0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82,
+    };
+    constexpr uint8_t ODD_13X8_P1[120] = {
+        0x50, 0x31, 0x0A, 0x31, 0x33, 0x20, 0x38, 0x0A, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+        0x30, 0x31, 0x30, 0x31, 0x30, 0x0A, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30,
+        0x30, 0x31, 0x31, 0x0A, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30,
+        0x31, 0x0A, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x0A,
+        0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x0A, 0x31, 0x30,
+        0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x0A, 0x31, 0x31, 0x30, 0x30,
+        0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x30, 0x0A, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30,
+        0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x0A,
+    };
+    constexpr uint8_t ODD_13X8_P4[24] = {
+        0x50, 0x34, 0x0A, 0x31, 0x33, 0x20, 0x38, 0x0A, 0x55, 0x50, 0x99, 0x98, 0x4B, 0x48, 0x92, 0x68,
+        0xE3, 0x88, 0xA9, 0x58, 0xCD, 0x90, 0xF1, 0xE0,
+    };
+    constexpr uint32_t LARGE_1024X512_PNG_SIZE = 66121;
+    constexpr uint32_t LARGE_1024X512_PNG_CRC32 = 0x7C961563;
+}
@@ -0,0 +1,139 @@
+/**
+ * @file test_main.cpp
+ * @brief DisplaySnapshot PNG/PBM output against golden bytes from scripts/snapshot_goldens.py,
+ *        plus the size predictions and the refusal paths.
+ */
+
+#include <unity.h>
+#include "displaySnapshot.h"
+#include "goldens.h"
+
+#include <vector>
+
+namespace
+{
+    // Same pattern as framebuffer_byte() in scripts/snapshot_goldens.py
+    std::vector<uint8_t> framebuffer(uint16_t width, uint16_t height)
+    {
+        std::vector<uint8_t> fb((size_t)width * ((height + 7) / 8));
+        for (size_t i = 0; i < fb.size(); ++i)
+            fb[i] = (uint8_t)(i * 37 + (i >> 7) * 11 + 5);
+        return fb;
+    }
+
+    // Sink that keeps everything, or stops accepting after `limit` bytes
+    class CaptureSink : public Print
+    {
+    public:
+        explicit CaptureSink(size_t limit = SIZE_MAX) : limit_(limit) {}
+
+        size_t write(uint8_t b) override { return write(&b, 1); }
+        size_t write(const uint8_t *buf, size_t len) override
+        {
+            const size_t n = min(len, limit_ - bytes.size());
+            bytes.insert(bytes.end(), buf, buf + n);
+            writes++;
+            return n;
+        }
+        using Print::write;
+
+        std::vector<uint8_t> bytes;
+        size_t writes = 0;
+
+    private:
+        size_t limit_;
+    };
+
+    uint32_t crc32(const std::vector<uint8_t> &data)
+    {
+        uint32_t crc = 0xFFFFFFFF;
+        for (uint8_t b : data)
+        {
+            crc ^= b;
+            for (int k = 0; k < 8; ++k)
+                crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+        }
+        return crc ^ 0xFFFFFFFF;
+    }
+
+    template <size_t N>
+    void checkGolden(const uint8_t (&golden)[N], uint16_t width, uint16_t height, int format)
+    {
+        const std::vector<uint8_t> fb = framebuffer(width, height);
+        CaptureSink sink;
+        const bool ok = format == 0 ? DisplaySnapshot::writePng(sink, fb.data(), width, height)
+                                    : DisplaySnapshot::writePbm(sink, fb.data(), width, height, format == 1);
+        TEST_ASSERT_TRUE(ok);
+        TEST_ASSERT_EQUAL(N, sink.bytes.size());
+        TEST_ASSERT_EQUAL_MEMORY(golden, sink.bytes.data(), N);
+        const size_t predicted = format == 0 ? DisplaySnapshot::pngSize(width, height)
+                                             : DisplaySnapshot::pbmSize(width, height, format == 1);
+        TEST_ASSERT_EQUAL(N, predicted);
+    }
+
+    constexpr int PNG = 0, P1 = 1, P4 = 2;
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_png_goldens()
+{
+    checkGolden(Golden::PANEL_128X64_PNG, 128, 64, PNG);
+    checkGolden(Golden::PANEL_128X32_PNG, 128, 32, PNG);
+    checkGolden(Golden::ODD_13X8_PNG, 13, 8, PNG);
+}
+
+void test_pbm_goldens()
+{
+    checkGolden(Golden::PANEL_128X64_P1, 128, 64, P1);
+    checkGolden(Golden::PANEL_128X64_P4, 128, 64, P4);
+    checkGolden(Golden::PANEL_128X32_P1, 128, 32, P1);
+    checkGolden(Golden::PANEL_128X32_P4, 128, 32, P4);
+    checkGolden(Golden::ODD_13X8_P1, 13, 8, P1);
+    checkGolden(Golden::ODD_13X8_P4, 13, 8, P4);
+}
+
+void test_png_spanning_two_deflate_blocks()
+{
+    const std::vector<uint8_t> fb = framebuffer(1024, 512);
+    CaptureSink sink;
+    TEST_ASSERT_TRUE(DisplaySnapshot::writePng(sink, fb.data(), 1024, 512));
+    TEST_ASSERT_EQUAL(Golden::LARGE_1024X512_PNG_SIZE, sink.bytes.size());
+    TEST_ASSERT_EQUAL(DisplaySnapshot::pngSize(1024, 512), sink.bytes.size());
+    TEST_ASSERT_EQUAL_HEX32(Golden::LARGE_1024X512_PNG_CRC32, crc32(sink.bytes));
+    // Buffered: a 64 KiB image does not arrive byte by byte
+    TEST_ASSERT_LESS_THAN(sink.bytes.size() / 32, sink.writes);
+}
+
+void test_unsupported_input_writes_nothing()
+{
+    const std::vector<uint8_t> fb = framebuffer(1032, 8);
+    CaptureSink sink;
+    TEST_ASSERT_FALSE(DisplaySnapshot::writePng(sink, fb.data(), 1032, 8)); // wider than the row buffer
+    TEST_ASSERT_FALSE(DisplaySnapshot::writePbm(sink, fb.data(), 1032, 8, false));
+    TEST_ASSERT_FALSE(DisplaySnapshot::writePng(sink, nullptr, 128, 64));
+    TEST_ASSERT_FALSE(DisplaySnapshot::writePng(sink, fb.data(), 0, 8));
+    TEST_ASSERT_FALSE(DisplaySnapshot::writePbm(sink, fb.data(), 128, 0, true));
+    TEST_ASSERT_EQUAL(0, sink.bytes.size());
+}
+
+void test_short_write_is_reported()
+{
+    const std::vector<uint8_t> fb = framebuffer(128, 64);
+    CaptureSink png(100);
+    TEST_ASSERT_FALSE(DisplaySnapshot::writePng(png, fb.data(), 128, 64));
+    CaptureSink pbm(100);
+    TEST_ASSERT_FALSE(DisplaySnapshot::writePbm(pbm, fb.data(), 128, 64, true));
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_png_goldens);
+    RUN_TEST(test_pbm_goldens);
+    RUN_TEST(test_png_spanning_two_deflate_blocks);
+    RUN_TEST(test_unsupported_input_writes_nothing);
+    RUN_TEST(test_short_write_is_reported);
+    return UNITY_END();
+}
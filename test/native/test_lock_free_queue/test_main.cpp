@@ -0,0 +1,291 @@
+/**
+ * @file test_main.cpp
+ * @brief SpscQueue/MpscQueue stress tests with real threads, plus throughput benchmarks.
+ *
+ * The stress tests check that every item arrives exactly once, intact and in per-producer
+ * order while producers and the consumer race on full and empty queues. Run them under
+ * ThreadSanitizer with `pio test -e native_tsan`. The benchmarks print items per second
+ * next to a mutex + deque baseline; they do not assert on timings.
+ */
+
+#include <unity.h>
+#include "lockFreeQueue.h"
+
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    struct Item
+    {
+        uint32_t producer;
+        uint32_t seq;
+        uint32_t check; // derived from the other two: catches torn copies
+    };
+
+    uint32_t checksum(uint32_t producer, uint32_t seq) { return (producer * 0x9E3779B9u) ^ (seq * 0x85EBCA6Bu) ^ 0xA5A5A5A5u; }
+
+    Item makeItem(uint32_t producer, uint32_t seq) { return Item{producer, seq, checksum(producer, seq)}; }
+
+#if defined(__SANITIZE_THREAD__)
+    constexpr uint32_t ITEMS_PER_PRODUCER = 20000; // TSan runs ~10x slower
+#else
+    constexpr uint32_t ITEMS_PER_PRODUCER = 200000;
+#endif
+
+    using BenchClock = std::chrono::steady_clock;
+
+    double itemsPerSecond(BenchClock::time_point start, size_t items)
+    {
+        const double s = std::chrono::duration<double>(BenchClock::now() - start).count();
+        return s > 0 ? (double)items / s : 0.0;
+    }
+
+    // Baseline the queues replace: a mutex around a bounded deque
+    template <typename T, size_t N>
+    class LockedQueue
+    {
+    public:
+        bool push(const T &item)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (items_.size() >= N)
+                return false;
+            items_.push_back(item);
+            return true;
+        }
+        bool pop(T &out)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (items_.empty())
+                return false;
+            out = items_.front();
+            items_.pop_front();
+            return true;
+        }
+
+    private:
+        std::mutex mutex_;
+        std::deque<T> items_;
+    };
+
+    // Producers spin on a full queue, the consumer on an empty one. Returns items per second
+    // and counts anything out of order, corrupted or missing.
+    template <typename Queue>
+    double runProducersConsumer(Queue &q, unsigned producers, uint32_t perProducer, size_t &errors)
+    {
+        std::vector<std::thread> threads;
+        const auto start = BenchClock::now();
+        for (unsigned p = 0; p < producers; ++p)
+        {
+            threads.emplace_back([&q, p, perProducer] {
+                for (uint32_t i = 0; i < perProducer; ++i)
+                {
+                    const Item item = makeItem(p, i);
+                    while (!q.push(item))
+                        std::this_thread::yield();
+                }
+            });
+        }
+
+        std::vector<uint32_t> next(producers, 0);
+        const size_t total = (size_t)producers * perProducer;
+        errors = 0;
+        Item item;
+        for (size_t received = 0; received < total;)
+        {
+            if (!q.pop(item))
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            received++;
+            if (item.producer >= producers || item.check != checksum(item.producer, item.seq) ||
+                item.seq != next[item.producer])
+                errors++;
+            else
+                next[item.producer]++;
+        }
+        const double rate = itemsPerSecond(start, total);
+        for (auto &t : threads)
+            t.join();
+        for (unsigned p = 0; p < producers; ++p)
+            errors += next[p] != perProducer;
+        return rate;
+    }
+
+    void report(const char *what, double rate)
+    {
+        char msg[120];
+        snprintf(msg, sizeof(msg), "%s: %.1f M items/s", what, rate / 1e6);
+        TEST_MESSAGE(msg);
+    }
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_spsc_single_thread_semantics()
+{
+    SpscQueue<uint32_t, 4> q;
+    uint32_t v = 0;
+    TEST_ASSERT_TRUE(q.empty());
+    TEST_ASSERT_FALSE(q.pop(v));
+    for (uint32_t i = 0; i < 4; ++i)
+        TEST_ASSERT_TRUE(q.push(i));
+    TEST_ASSERT_FALSE(q.push(99));
+    TEST_ASSERT_EQUAL(4, q.size());
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+        TEST_ASSERT_TRUE(q.pop(v));
+        TEST_ASSERT_EQUAL_UINT32(i, v);
+    }
+    TEST_ASSERT_FALSE(q.pop(v));
+}
+
+void test_mpsc_single_thread_semantics()
+{
+    MpscQueue<uint32_t, 4> q;
+    uint32_t v = 0;
+    TEST_ASSERT_FALSE(q.pop(v));
+    // Several laps around the ring
+    for (uint32_t lap = 0; lap < 3; ++lap)
+    {
+        for (uint32_t i = 0; i < 4; ++i)
+            TEST_ASSERT_TRUE(q.push(lap * 10 + i));
+        TEST_ASSERT_FALSE(q.push(99));
+        for (uint32_t i = 0; i < 4; ++i)
+        {
+            TEST_ASSERT_TRUE(q.pop(v));
+            TEST_ASSERT_EQUAL_UINT32(lap * 10 + i, v);
+        }
+        TEST_ASSERT_TRUE(q.empty());
+    }
+}
+
+void test_message_envelope()
+{
+    Message<uint8_t, 8> m;
+    TEST_ASSERT_TRUE(m.putText(1, "short"));
+    TEST_ASSERT_EQUAL_STRING("short", m.text());
+    TEST_ASSERT_EQUAL(6, m.length);
+    TEST_ASSERT_FALSE(m.putText(2, "much too long"));
+    TEST_ASSERT_EQUAL_STRING("much to", m.text());
+
+    const Item in = makeItem(3, 4);
+    Message<uint8_t, sizeof(Item)> typed;
+    TEST_ASSERT_TRUE(typed.put(7, in));
+    Item out{};
+    TEST_ASSERT_TRUE(typed.get(out));
+    TEST_ASSERT_EQUAL_MEMORY(&in, &out, sizeof(Item));
+    uint16_t wrongSize;
+    TEST_ASSERT_FALSE(typed.get(wrongSize));
+}
+
+void test_spsc_stress()
+{
+    static SpscQueue<Item, 64> q; // small, so both sides hit full and empty often
+    size_t errors = 0;
+    runProducersConsumer(q, 1, ITEMS_PER_PRODUCER * 4, errors);
+    TEST_ASSERT_EQUAL(0, errors);
+    TEST_ASSERT_TRUE(q.empty());
+}
+
+void test_mpsc_stress()
+{
+    static MpscQueue<Item, 64> q;
+    for (unsigned producers : {2u, 4u, 8u})
+    {
+        size_t errors = 0;
+        runProducersConsumer(q, producers, ITEMS_PER_PRODUCER, errors);
+        TEST_ASSERT_EQUAL(0, errors);
+        TEST_ASSERT_TRUE(q.empty());
+    }
+}
+
+void test_mpsc_messages_stay_intact()
+{
+    // Logger's use: text lines from several tasks in a Message envelope
+    using Line = Message<uint8_t, 48>;
+    static MpscQueue<Line, 32> q;
+    constexpr unsigned PRODUCERS = 4;
+    const uint32_t perProducer = ITEMS_PER_PRODUCER / 10;
+
+    std::vector<std::thread> threads;
+    for (unsigned p = 0; p < PRODUCERS; ++p)
+    {
+        threads.emplace_back([p, perProducer] {
+            char text[48];
+            for (uint32_t i = 0; i < perProducer; ++i)
+            {
+                Line line;
+                snprintf(text, sizeof(text), "task %u line %u", p, (unsigned)i);
+                line.putText((uint8_t)p, text);
+                while (!q.push(line))
+                    std::this_thread::yield();
+            }
+        });
+    }
+
+    std::vector<uint32_t> next(PRODUCERS, 0);
+    size_t errors = 0;
+    char expected[48];
+    Line line;
+    for (size_t received = 0; received < PRODUCERS * perProducer;)
+    {
+        if (!q.pop(line))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        received++;
+        if (line.kind >= PRODUCERS)
+        {
+            errors++;
+            continue;
+        }
+        snprintf(expected, sizeof(expected), "task %u line %u", (unsigned)line.kind, (unsigned)next[line.kind]++);
+        errors += strcmp(expected, line.text()) != 0 || line.length != strlen(expected) + 1;
+    }
+    for (auto &t : threads)
+        t.join();
+    TEST_ASSERT_EQUAL(0, errors);
+}
+
+void test_benchmark_throughput()
+{
+    static SpscQueue<Item, 256> spsc;
+    static MpscQueue<Item, 256> mpsc;
+    static LockedQueue<Item, 256> locked;
+    size_t errors = 0;
+    const uint32_t n = ITEMS_PER_PRODUCER * 5;
+
+    report("SpscQueue<256>, 1 producer", runProducersConsumer(spsc, 1, n, errors));
+    TEST_ASSERT_EQUAL(0, errors);
+    report("mutex+deque<256>, 1 producer", runProducersConsumer(locked, 1, n, errors));
+    for (unsigned producers : {1u, 2u, 4u})
+    {
+        char what[48];
+        snprintf(what, sizeof(what), "MpscQueue<256>, %u producer%s", producers, producers > 1 ? "s" : "");
+        report(what, runProducersConsumer(mpsc, producers, n / producers, errors));
+        TEST_ASSERT_EQUAL(0, errors);
+        snprintf(what, sizeof(what), "mutex+deque<256>, %u producer%s", producers, producers > 1 ? "s" : "");
+        report(what, runProducersConsumer(locked, producers, n / producers, errors));
+    }
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_spsc_single_thread_semantics);
+    RUN_TEST(test_mpsc_single_thread_semantics);
+    RUN_TEST(test_message_envelope);
+    RUN_TEST(test_spsc_stress);
+    RUN_TEST(test_mpsc_stress);
+    RUN_TEST(test_mpsc_messages_stay_intact);
+    RUN_TEST(test_benchmark_throughput);
+    return UNITY_END();
+}
@@ -0,0 +1,235 @@
+/**
+ * @file test_main.cpp
+ * @brief Soak tests for PooledJsonAllocator and FixedBlockPool: many alloc/realloc/free cycles
+ *        must leave the pool, the module accounting and the (simulated) PSRAM exactly empty.
+ */
+
+#include <unity.h>
+#include "memoryPool.h"
+#include "bufferAllocator.h"
+
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace
+{
+#if defined(__SANITIZE_THREAD__)
+    constexpr uint32_t CYCLES = 20000;
+#else
+    constexpr uint32_t CYCLES = 200000;
+#endif
+
+    struct Live
+    {
+        uint8_t *p = nullptr;
+        size_t size = 0;
+        uint8_t tag = 0;
+    };
+
+    // Every byte of a live block carries its tag, so a lost copy or an overlap shows up
+    void fill(Live &b)
+    {
+        memset(b.p, b.tag, b.size);
+    }
+
+    bool intact(const Live &b, size_t upTo)
+    {
+        for (size_t i = 0; i < upTo; ++i)
+            if (b.p[i] != b.tag)
+                return false;
+        return true;
+    }
+
+    MemoryAccounting::ModuleStats statsOf(MemoryAccounting::ModuleId id)
+    {
+        MemoryAccounting::ModuleStats all[MemoryAccounting::MAX_MODULES];
+        const size_t n = MemoryAccounting::instance().stats(all, MemoryAccounting::MAX_MODULES);
+        TEST_ASSERT_TRUE(id < n);
+        return all[id];
+    }
+
+    void assertEverythingReturned(MemoryAccounting::ModuleId mod)
+    {
+        const MemoryAccounting::ModuleStats s = statsOf(mod);
+        TEST_ASSERT_EQUAL(0, s.bytes);
+        TEST_ASSERT_EQUAL(0, s.psramBytes);
+        TEST_ASSERT_EQUAL(0, PooledJsonAllocator::pool().inUse());
+        TEST_ASSERT_EQUAL(BufferAllocator::HOST_PSRAM_BYTES, BufferAllocator::instance().freeBytes(BufferAllocator::Region::Psram));
+    }
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_fixed_block_pool_basics()
+{
+    FixedBlockPool pool("test", 20, 3);
+    TEST_ASSERT_TRUE(pool.valid());
+    TEST_ASSERT_EQUAL(24, pool.blockSize()); // rounded up to 8-byte alignment
+
+    void *a = pool.allocate();
+    void *b = pool.allocate();
+    void *c = pool.allocate();
+    TEST_ASSERT_NOT_NULL(c);
+    TEST_ASSERT_NULL(pool.allocate());
+    TEST_ASSERT_EQUAL(1, pool.failures());
+    TEST_ASSERT_TRUE(pool.owns(b));
+    int outside;
+    TEST_ASSERT_FALSE(pool.owns(&outside));
+
+    pool.release(b);
+    TEST_ASSERT_EQUAL_PTR(b, pool.allocate()); // LIFO reuse
+    pool.release(a);
+    pool.release(b);
+    pool.release(c);
+    TEST_ASSERT_EQUAL(0, pool.inUse());
+    TEST_ASSERT_EQUAL(3, pool.peakInUse());
+
+    const FixedBlockPool *pools[8];
+    const size_t n = FixedBlockPool::list(pools, 8);
+    bool listed = false;
+    for (size_t i = 0; i < n; ++i)
+        listed = listed || pools[i] == &pool;
+    TEST_ASSERT_TRUE(listed);
+}
+
+void test_json_allocator_soak()
+{
+    const MemoryAccounting::ModuleId mod = MemoryAccounting::instance().registerModule("soak");
+    PooledJsonAllocator alloc(mod);
+    FixedBlockPool &pool = PooledJsonAllocator::pool();
+    const uint32_t poolFailuresBefore = pool.failures();
+
+    std::mt19937 rng(2024);
+    // Mostly pool-sized documents, some larger than a block (heap/PSRAM fallback)
+    std::uniform_int_distribution<size_t> size(16, PooledJsonAllocator::JSON_BLOCK_SIZE * 3);
+    std::uniform_int_distribution<int> action(0, 9);
+    constexpr size_t SLOTS = 6; // more live documents than pool blocks
+    Live live[SLOTS];
+    size_t corrupt = 0, failed = 0, inPool = 0, reallocs = 0;
+
+    for (uint32_t i = 0; i < CYCLES; ++i)
+    {
+        Live &b = live[rng() % SLOTS];
+        const int a = action(rng);
+        if (!b.p)
+        {
+            b.size = size(rng);
+            b.tag = (uint8_t)(i | 1);
+            b.p = static_cast<uint8_t *>(alloc.allocate(b.size));
+            if (!b.p)
+            {
+                failed++;
+                continue;
+            }
+            inPool += pool.owns(b.p);
+            fill(b);
+        }
+        else if (a < 3)
+        {
+            // shrinkToFit() and the occasional grow
+            const size_t newSize = a == 0 ? size(rng) : 1 + rng() % b.size;
+            uint8_t *q = static_cast<uint8_t *>(alloc.reallocate(b.p, newSize));
+            if (!q)
+            {
+                failed++;
+                continue;
+            }
+            b.p = q;
+            corrupt += !intact(b, min(b.size, newSize));
+            b.size = newSize;
+            fill(b);
+            reallocs++;
+        }
+        else
+        {
+            corrupt += !intact(b, b.size);
+            alloc.deallocate(b.p);
+            b = Live();
+        }
+    }
+    for (Live &b : live)
+    {
+        if (b.p)
+        {
+            corrupt += !intact(b, b.size);
+            alloc.deallocate(b.p);
+        }
+    }
+
+    TEST_ASSERT_EQUAL(0, corrupt);
+    TEST_ASSERT_EQUAL(0, failed);
+    TEST_ASSERT_EQUAL(PooledJsonAllocator::JSON_BLOCKS, pool.peakInUse());
+    TEST_ASSERT_GREATER_THAN(poolFailuresBefore, pool.failures()); // fallbacks happened
+    assertEverythingReturned(mod);
+
+    char msg[160];
+    snprintf(msg, sizeof(msg), "%u cycles: %u from the pool, %u reallocs, %u pool misses, module peak %u B internal / %u B PSRAM",
+             (unsigned)CYCLES, (unsigned)inPool, (unsigned)reallocs, (unsigned)(pool.failures() - poolFailuresBefore),
+             (unsigned)statsOf(mod).peakBytes, (unsigned)statsOf(mod).psramPeakBytes);
+    TEST_MESSAGE(msg);
+}
+
+void test_pooled_documents_soak()
+{
+    const MemoryAccounting::ModuleId mod = MemoryAccounting::instance().registerModule("soak-doc");
+    for (uint32_t i = 0; i < CYCLES / 10; ++i)
+    {
+        const size_t capacity = (i % 4 == 3) ? 3 * PooledJsonAllocator::JSON_BLOCK_SIZE : 512 + (i % 7) * 256;
+        PooledJsonDocument doc(capacity, PooledJsonAllocator(mod));
+        TEST_ASSERT_EQUAL(capacity, doc.capacity());
+        doc["seq"] = i;
+        doc["name"] = "soak";
+        if (i % 3 == 0)
+            doc.shrinkToFit();
+        PooledJsonDocument copy(doc);
+        TEST_ASSERT_EQUAL_UINT32(i, copy["seq"].as<uint32_t>());
+    }
+    assertEverythingReturned(mod);
+}
+
+void test_concurrent_pool_cycles()
+{
+    const MemoryAccounting::ModuleId mod = MemoryAccounting::instance().registerModule("soak-mt");
+    constexpr unsigned THREADS = 4;
+    std::vector<std::thread> threads;
+    std::atomic<size_t> corrupt{0};
+    for (unsigned t = 0; t < THREADS; ++t)
+    {
+        threads.emplace_back([t, mod, &corrupt] {
+            PooledJsonAllocator alloc(mod);
+            std::mt19937 rng(t);
+            for (uint32_t i = 0; i < CYCLES / THREADS; ++i)
+            {
+                Live b;
+                b.size = 64 + rng() % (2 * PooledJsonAllocator::JSON_BLOCK_SIZE);
+                b.tag = (uint8_t)(0x10 + t);
+                b.p = static_cast<uint8_t *>(alloc.allocate(b.size));
+                if (!b.p)
+                {
+                    corrupt++;
+                    continue;
+                }
+                fill(b);
+                std::this_thread::yield();
+                corrupt += !intact(b, b.size);
+                alloc.deallocate(b.p);
+            }
+        });
+    }
+    for (auto &th : threads)
+        th.join();
+    TEST_ASSERT_EQUAL(0, corrupt.load());
+    assertEverythingReturned(mod);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_fixed_block_pool_basics);
+    RUN_TEST(test_json_allocator_soak);
+    RUN_TEST(test_pooled_documents_soak);
+    RUN_TEST(test_concurrent_pool_cycles);
+    return UNITY_END();
+}
@@ -0,0 +1,89 @@
+/**
+ * @file test_main.cpp
+ * @brief PortalAccess: the provisioning portal's POST /save is only served through the
+ * SoftAP while a portal is open, and refused once the temporary AP has expired.
+ *
+ * The expiry runs on a TimerWheel the way Provisioning::startTemporaryAp() schedules it;
+ * /save is modelled by the same check Provisioning::portalRoute() puts in front of it.
+ */
+
+#include <unity.h>
+#include "portalAccess.h"
+#include "timerWheel.h"
+
+namespace
+{
+    const IPAddress SOFT_AP_IP(192, 168, 4, 1);
+    const IPAddress STATION_IP(192, 168, 1, 57);
+
+    // What Provisioning's /save route answers (202 = credentials taken)
+    int postSave(const PortalAccess &access, const IPAddress &localIp, const IPAddress &softApIp = SOFT_AP_IP)
+    {
+        return access.allows(localIp, softApIp) ? 202 : 403;
+    }
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_closed_portal_refuses_everything()
+{
+    PortalAccess access;
+    TEST_ASSERT_FALSE(access.isOpen());
+    TEST_ASSERT_EQUAL(403, postSave(access, SOFT_AP_IP));
+    TEST_ASSERT_EQUAL(403, postSave(access, STATION_IP));
+}
+
+void test_temporary_ap_serves_only_the_softap()
+{
+    PortalAccess access;
+    access.open(PortalAccess::Mode::Temporary);
+    TEST_ASSERT_EQUAL(202, postSave(access, SOFT_AP_IP));
+    // Same server, reached over the home network: refused
+    TEST_ASSERT_EQUAL(403, postSave(access, STATION_IP));
+}
+
+void test_save_refused_after_temporary_ap_expires()
+{
+    TimerWheel timers(4);
+    PortalAccess access;
+    access.open(PortalAccess::Mode::Temporary);
+    timers.schedule(10 * 60 * 1000, [&access] { access.close(); });
+
+    timers.advance(10 * 60 * 1000 - 1);
+    TEST_ASSERT_EQUAL(202, postSave(access, SOFT_AP_IP));
+
+    timers.advance(10 * 60 * 1000);
+    TEST_ASSERT_FALSE(access.isOpen());
+    TEST_ASSERT_EQUAL(403, postSave(access, SOFT_AP_IP));
+    TEST_ASSERT_EQUAL(403, postSave(access, STATION_IP));
+}
+
+void test_first_boot_portal_is_softap_only()
+{
+    PortalAccess access;
+    access.open(PortalAccess::Mode::FirstBoot);
+    TEST_ASSERT_EQUAL(202, postSave(access, SOFT_AP_IP));
+    TEST_ASSERT_EQUAL(403, postSave(access, STATION_IP));
+    access.close();
+    TEST_ASSERT_EQUAL(403, postSave(access, SOFT_AP_IP));
+}
+
+void test_no_softap_address_refuses()
+{
+    // WiFi.softAPIP() is 0.0.0.0 while the AP is down; a client address of 0 must not match it
+    PortalAccess access;
+    access.open(PortalAccess::Mode::Temporary);
+    TEST_ASSERT_EQUAL(403, postSave(access, IPAddress(), IPAddress()));
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_closed_portal_refuses_everything);
+    RUN_TEST(test_temporary_ap_serves_only_the_softap);
+    RUN_TEST(test_save_refused_after_temporary_ap_expires);
+    RUN_TEST(test_first_boot_portal_is_softap_only);
+    RUN_TEST(test_no_softap_address_refuses);
+    return UNITY_END();
+}
@@ -0,0 +1,392 @@
+/**
+ * @file test_main.cpp
+ * @brief ProvisioningProtocol against an independent client: X25519 handshake, HKDF/AES-GCM
+ *        round trips, tampered and replayed frames, and PoP mismatch up to the lockout.
+ *
+ * The client derives its key with mbedtls_hkdf() rather than the device's two HMACs, and
+ * the reference-vector test pins the bytes scripts/ble_provision.py would exchange with
+ * the RFC 7748 key pairs, so both ends of the protocol are checked against each other.
+ */
+
+#include <unity.h>
+#include "provisioningProtocol.h"
+
+#include "mbedtls/ecdh.h"
+#include "mbedtls/gcm.h"
+#include "mbedtls/hkdf.h"
+#include "mbedtls/md.h"
+
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using P = ProvisioningProtocol;
+    using Bytes = std::vector<uint8_t>;
+
+    constexpr char POP[] = "K7QX3M9A";
+
+    // RFC 7748 section 6.1: Alice is the client, Bob the device
+    const uint8_t ALICE_PUBLIC[32] = {0x85, 0x20, 0xf0, 0x09, 0x89, 0x30, 0xa7, 0x54, 0x74, 0x8b, 0x7d, 0xdc, 0xb4, 0x3e, 0xf7, 0x5a,
+                                      0x0d, 0xbf, 0x3a, 0x0d, 0x26, 0x38, 0x1a, 0xf4, 0xeb, 0xa4, 0xa9, 0x8e, 0xaa, 0x9b, 0x4e, 0x6a};
+    const uint8_t BOB_PUBLIC[32] = {0xde, 0x9e, 0xdb, 0x7d, 0x7b, 0x7d, 0xc1, 0xb4, 0xd3, 0x5b, 0x61, 0xc2, 0xec, 0xe4, 0x35, 0x37,
+                                    0x3f, 0x83, 0x43, 0xc8, 0x5b, 0x78, 0x67, 0x4d, 0xad, 0xfc, 0x7e, 0x14, 0x6f, 0x88, 0x2b, 0x4f};
+    // RNG bytes that make mbedtls pick Bob's scalar: it reads them big-endian, then shifts
+    // right one bit to bring the top bit down to bit 254
+    const uint8_t BOB_RANDOM[32] = {0xd7, 0xc1, 0x11, 0xfe, 0x4f, 0x16, 0x5e, 0x39, 0xfb, 0x6c, 0x30, 0x4c, 0x53, 0x62, 0x76, 0xdf,
+                                    0xcc, 0x1d, 0x01, 0x07, 0x16, 0xff, 0xc2, 0xf2, 0x97, 0x14, 0x94, 0xc4, 0xfc, 0x11, 0x56, 0xb0};
+    // GET_STATUS sealed by the client with counter 1, and the device's reply for
+    // {phase 2, reason 0, 192.168.1.77}; computed with Python's cryptography package
+    const uint8_t REFERENCE_REQUEST[] = {0x02, 0x00, 0x00, 0x00, 0x01, 0x56, 0xb2, 0x81, 0xc9, 0x29, 0xc1,
+                                         0xfb, 0xe8, 0xb1, 0xf6, 0x3d, 0xa1, 0xad, 0xc3, 0xc9, 0x4b, 0x48};
+    const uint8_t REFERENCE_REPLY[] = {0x02, 0x00, 0x00, 0x00, 0x01, 0x9e, 0x99, 0x5b, 0x84, 0xfd, 0xbb, 0x49, 0x03, 0x39,
+                                       0x3c, 0xfd, 0x18, 0x93, 0x06, 0x15, 0x9d, 0x1c, 0xdb, 0x23, 0xea, 0x3a, 0xb8, 0x2f};
+
+    std::mt19937 rng(1234);
+
+    void randomBytes(uint8_t *buf, size_t len)
+    {
+        for (size_t i = 0; i < len; ++i)
+            buf[i] = (uint8_t)rng();
+    }
+
+    int mbedtlsRandom(void *, unsigned char *buf, size_t len)
+    {
+        randomBytes(buf, len);
+        return 0;
+    }
+
+    // What the device reports and what it was handed
+    struct DeviceSide
+    {
+        P::Credentials last{};
+        int calls = 0;
+        P::Result result = P::Result::Accepted;
+        P::Status status{2, 0, {192, 168, 1, 77}};
+    };
+
+    P makeDevice(DeviceSide &side, P::RandomFn random = randomBytes)
+    {
+        return P(random,
+                 [&side](const P::Credentials &c) {
+                     side.last = c;
+                     side.calls++;
+                     return side.result;
+                 },
+                 [&side] { return side.status; });
+    }
+
+    // Client end of the protocol, written against mbedtls directly
+    class Client
+    {
+    public:
+        explicit Client(const std::string &pop) : pop_(pop) { mbedtls_ecdh_init(&ecdh_); }
+        ~Client() { mbedtls_ecdh_free(&ecdh_); }
+
+        Bytes hello()
+        {
+            mbedtls_ecdh_free(&ecdh_);
+            mbedtls_ecdh_init(&ecdh_);
+            uint8_t point[33];
+            size_t olen = 0;
+            TEST_ASSERT_EQUAL(0, mbedtls_ecdh_setup(&ecdh_, MBEDTLS_ECP_DP_CURVE25519));
+            TEST_ASSERT_EQUAL(0, mbedtls_ecdh_make_public(&ecdh_, &olen, point, sizeof(point), mbedtlsRandom, nullptr));
+            TEST_ASSERT_EQUAL(33, olen);
+            public_.assign(point + 1, point + 33);
+            Bytes frame{P::FRAME_HELLO};
+            frame.insert(frame.end(), public_.begin(), public_.end());
+            return frame;
+        }
+
+        void onHelloAck(const Bytes &frame)
+        {
+            TEST_ASSERT_EQUAL(33, frame.size());
+            TEST_ASSERT_EQUAL_HEX8(P::FRAME_HELLO_ACK, frame[0]);
+            uint8_t point[33] = {32};
+            memcpy(point + 1, frame.data() + 1, 32);
+            uint8_t shared[32];
+            size_t olen = 0;
+            TEST_ASSERT_EQUAL(0, mbedtls_ecdh_read_public(&ecdh_, point, sizeof(point)));
+            TEST_ASSERT_EQUAL(0, mbedtls_ecdh_calc_secret(&ecdh_, &olen, shared, sizeof(shared), mbedtlsRandom, nullptr));
+            deriveKey(shared, frame.data() + 1);
+        }
+
+        void deriveKey(const uint8_t *shared, const uint8_t *devicePublic)
+        {
+            const mbedtls_md_info_t *sha256 = mbedtls_md_info_from_type(MBEDTLS_MD_SHA256);
+            uint8_t salt[32];
+            TEST_ASSERT_EQUAL(0, mbedtls_md(sha256, reinterpret_cast<const uint8_t *>(pop_.data()), pop_.size(), salt));
+            Bytes info{'d', 'h', 'c', '-', 'p', 'r', 'o', 'v', ' ', 'v', '1'};
+            info.insert(info.end(), public_.begin(), public_.end());
+            info.insert(info.end(), devicePublic, devicePublic + 32);
+            TEST_ASSERT_EQUAL(0, mbedtls_hkdf(sha256, salt, sizeof(salt), shared, 32, info.data(), info.size(), key_, sizeof(key_)));
+        }
+
+        Bytes seal(const Bytes &plain, uint32_t counter = 0)
+        {
+            counter = counter ? counter : ++tx_;
+            Bytes frame{P::FRAME_SECURE, (uint8_t)(counter >> 24), (uint8_t)(counter >> 16), (uint8_t)(counter >> 8), (uint8_t)counter};
+            frame.resize(P::HEADER_LEN + plain.size() + P::TAG_LEN);
+            const Bytes iv = ivFor('C', frame.data() + 1);
+            mbedtls_gcm_context gcm;
+            mbedtls_gcm_init(&gcm);
+            TEST_ASSERT_EQUAL(0, mbedtls_gcm_setkey(&gcm, MBEDTLS_CIPHER_ID_AES, key_, 256));
+            TEST_ASSERT_EQUAL(0, mbedtls_gcm_crypt_and_tag(&gcm, MBEDTLS_GCM_ENCRYPT, plain.size(), iv.data(), iv.size(), frame.data(),
+                                                           P::HEADER_LEN, plain.data(), frame.data() + P::HEADER_LEN, P::TAG_LEN,
+                                                           frame.data() + P::HEADER_LEN + plain.size()));
+            mbedtls_gcm_free(&gcm);
+            return frame;
+        }
+
+        // Decrypt a device frame; empty if it does not authenticate
+        Bytes open(const Bytes &frame)
+        {
+            if (frame.size() < P::HEADER_LEN + P::TAG_LEN || frame[0] != P::FRAME_SECURE)
+                return Bytes();
+            const size_t len = frame.size() - P::HEADER_LEN - P::TAG_LEN;
+            Bytes plain(len);
+            const Bytes iv = ivFor('D', frame.data() + 1);
+            mbedtls_gcm_context gcm;
+            mbedtls_gcm_init(&gcm);
+            const bool ok = mbedtls_gcm_setkey(&gcm, MBEDTLS_CIPHER_ID_AES, key_, 256) == 0 &&
+                            mbedtls_gcm_auth_decrypt(&gcm, len, iv.data(), iv.size(), frame.data(), P::HEADER_LEN,
+                                                     frame.data() + frame.size() - P::TAG_LEN, P::TAG_LEN,
+                                                     frame.data() + P::HEADER_LEN, plain.data()) == 0;
+            mbedtls_gcm_free(&gcm);
+            return ok ? plain : Bytes();
+        }
+
+        const Bytes &publicKey() const { return public_; }
+
+    private:
+        static Bytes ivFor(uint8_t direction, const uint8_t *counterBe)
+        {
+            Bytes iv(P::IV_LEN, 0);
+            iv[0] = direction;
+            memcpy(iv.data() + 8, counterBe, 4);
+            return iv;
+        }
+
+        std::string pop_;
+        mbedtls_ecdh_context ecdh_;
+        Bytes public_;
+        uint8_t key_[32] = {};
+        uint32_t tx_ = 0;
+    };
+
+    Bytes send(P &device, const Bytes &frame, uint32_t nowMs = 1000)
+    {
+        Bytes out(P::MAX_FRAME);
+        out.resize(device.handle(frame.data(), frame.size(), out.data(), out.size(), nowMs));
+        return out;
+    }
+
+    Bytes errorFrame(P::Error e) { return Bytes{P::FRAME_ERROR, (uint8_t)e}; }
+
+    void connect(P &device, Client &client, uint32_t nowMs = 1000)
+    {
+        client.onHelloAck(send(device, client.hello(), nowMs));
+        TEST_ASSERT_TRUE(device.sessionOpen());
+    }
+
+    void appendTlv(Bytes &b, uint8_t tag, const std::string &value)
+    {
+        b.push_back(tag);
+        b.push_back((uint8_t)value.size());
+        b.insert(b.end(), value.begin(), value.end());
+    }
+
+    void assertFrame(const Bytes &expected, const Bytes &actual)
+    {
+        TEST_ASSERT_EQUAL(expected.size(), actual.size());
+        TEST_ASSERT_EQUAL_MEMORY(expected.data(), actual.data(), expected.size());
+    }
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_reference_vectors()
+{
+    // Device key from the RNG: Bob's scalar first, anything after (ECDH blinding)
+    size_t drawn = 0;
+    DeviceSide side;
+    P device = makeDevice(side, [&drawn](uint8_t *buf, size_t len) {
+        for (size_t i = 0; i < len; ++i, ++drawn)
+            buf[i] = drawn < sizeof(BOB_RANDOM) ? BOB_RANDOM[drawn] : (uint8_t)rng();
+    });
+    device.setPop(POP, strlen(POP));
+
+    Bytes hello{P::FRAME_HELLO};
+    hello.insert(hello.end(), ALICE_PUBLIC, ALICE_PUBLIC + 32);
+    Bytes ack{P::FRAME_HELLO_ACK};
+    ack.insert(ack.end(), BOB_PUBLIC, BOB_PUBLIC + 32);
+    assertFrame(ack, send(device, hello));
+
+    const Bytes reply = send(device, Bytes(REFERENCE_REQUEST, REFERENCE_REQUEST + sizeof(REFERENCE_REQUEST)));
+    assertFrame(Bytes(REFERENCE_REPLY, REFERENCE_REPLY + sizeof(REFERENCE_REPLY)), reply);
+}
+
+void test_set_credentials_and_status_round_trip()
+{
+    DeviceSide side;
+    P device = makeDevice(side);
+    device.setPop(POP, strlen(POP));
+    Client client(POP);
+    connect(device, client);
+
+    Bytes cmd{P::CMD_SET_CREDENTIALS};
+    appendTlv(cmd, P::TAG_SSID, "HomeNet");
+    appendTlv(cmd, 0x7E, "ignored"); // unknown tags are skipped
+    appendTlv(cmd, P::TAG_PASSWORD, std::string(P::MAX_PASSWORD, 'p'));
+    appendTlv(cmd, P::TAG_DEVICE_NAME, "heater-2");
+    const Bytes reply = client.open(send(device, client.seal(cmd)));
+    assertFrame(Bytes{P::CMD_SET_CREDENTIALS | P::CMD_REPLY, (uint8_t)P::Result::Accepted}, reply);
+    TEST_ASSERT_EQUAL(1, side.calls);
+    TEST_ASSERT_EQUAL_STRING("HomeNet", side.last.ssid);
+    TEST_ASSERT_EQUAL_STRING(std::string(P::MAX_PASSWORD, 'p').c_str(), side.last.password);
+    TEST_ASSERT_EQUAL_STRING("heater-2", side.last.deviceName);
+
+    side.result = P::Result::Busy;
+    assertFrame(Bytes{0x90, (uint8_t)P::Result::Busy}, client.open(send(device, client.seal(cmd))));
+
+    side.status = P::Status{3, 201, {0, 0, 0, 0}};
+    assertFrame(Bytes{0x91, 3, 201, 0, 0, 0, 0}, client.open(send(device, client.seal(Bytes{P::CMD_GET_STATUS}))));
+    assertFrame(Bytes{0xA5, (uint8_t)P::Result::Invalid}, client.open(send(device, client.seal(Bytes{0x25}))));
+}
+
+void test_invalid_credentials_are_not_passed_on()
+{
+    DeviceSide side;
+    P device = makeDevice(side);
+    device.setPop(POP, strlen(POP));
+    Client client(POP);
+    connect(device, client);
+
+    std::vector<Bytes> bad;
+    Bytes noSsid{P::CMD_SET_CREDENTIALS};
+    appendTlv(noSsid, P::TAG_PASSWORD, "secret");
+    bad.push_back(noSsid);
+    Bytes longSsid{P::CMD_SET_CREDENTIALS};
+    appendTlv(longSsid, P::TAG_SSID, std::string(P::MAX_SSID + 1, 's'));
+    bad.push_back(longSsid);
+    Bytes nul{P::CMD_SET_CREDENTIALS};
+    appendTlv(nul, P::TAG_SSID, std::string("Home\0Net", 8));
+    bad.push_back(nul);
+    Bytes truncated{P::CMD_SET_CREDENTIALS, P::TAG_SSID, 10, 'a', 'b'};
+    bad.push_back(truncated);
+
+    for (const Bytes &cmd : bad)
+        assertFrame(Bytes{0x90, (uint8_t)P::Result::Invalid}, client.open(send(device, client.seal(cmd))));
+    TEST_ASSERT_EQUAL(0, side.calls);
+}
+
+void test_tampered_frames_fail_authentication()
+{
+    DeviceSide side;
+    P device = makeDevice(side);
+    device.setPop(POP, strlen(POP));
+    Client client(POP);
+    connect(device, client);
+
+    // Flip a ciphertext bit, then a tag bit: both rejected, the session survives
+    const Bytes good = client.seal(Bytes{P::CMD_GET_STATUS});
+    for (size_t at : {P::HEADER_LEN, good.size() - 1})
+    {
+        Bytes bad = good;
+        bad[at] ^= 0x01;
+        assertFrame(errorFrame(P::Error::AuthFailed), send(device, bad));
+    }
+    TEST_ASSERT_EQUAL(P::MAX_AUTH_FAILURES - 1, device.authFailures());
+    TEST_ASSERT_TRUE(device.sessionOpen());
+
+    // The untouched frame still goes through and clears the failure count
+    TEST_ASSERT_EQUAL(7, client.open(send(device, good)).size());
+    TEST_ASSERT_EQUAL(0, device.authFailures());
+
+    // The header is authenticated too: a bumped counter passes the replay check, not the tag
+    Bytes bumped = client.seal(Bytes{P::CMD_GET_STATUS});
+    bumped[4]++;
+    assertFrame(errorFrame(P::Error::AuthFailed), send(device, bumped));
+    TEST_ASSERT_EQUAL(1, device.authFailures());
+
+    // A device frame altered on the way is caught by the client
+    Bytes reply = send(device, client.seal(Bytes{P::CMD_GET_STATUS}));
+    reply[P::HEADER_LEN + 2] ^= 0x80;
+    TEST_ASSERT_EQUAL(0, client.open(reply).size());
+}
+
+void test_pop_mismatch_locks_out()
+{
+    DeviceSide side;
+    P device = makeDevice(side);
+    device.setPop(POP, strlen(POP));
+    const uint32_t t0 = UINT32_MAX - 5000; // lockout timing across the millis() wrap
+
+    Client guess("K7QX3M9B");
+    connect(device, guess, t0);
+    Bytes cmd{P::CMD_SET_CREDENTIALS};
+    appendTlv(cmd, P::TAG_SSID, "HomeNet");
+    for (uint8_t i = 1; i < P::MAX_AUTH_FAILURES; ++i)
+        assertFrame(errorFrame(P::Error::AuthFailed), send(device, guess.seal(cmd), t0));
+    assertFrame(errorFrame(P::Error::LockedOut), send(device, guess.seal(cmd), t0));
+    TEST_ASSERT_FALSE(device.sessionOpen());
+    TEST_ASSERT_EQUAL(0, side.calls);
+
+    // No new session, not even with the right PoP, until the lockout has passed
+    Client owner(POP);
+    assertFrame(errorFrame(P::Error::LockedOut), send(device, owner.hello(), t0 + P::LOCKOUT_MS - 1));
+    connect(device, owner, t0 + P::LOCKOUT_MS);
+    assertFrame(Bytes{0x90, (uint8_t)P::Result::Accepted}, owner.open(send(device, owner.seal(cmd), t0 + P::LOCKOUT_MS)));
+    TEST_ASSERT_EQUAL(1, side.calls);
+}
+
+void test_replays_and_session_state()
+{
+    DeviceSide side;
+    P device = makeDevice(side);
+    Client early(POP);
+    assertFrame(errorFrame(P::Error::NoSession), send(device, early.hello())); // no PoP set yet
+
+    device.setPop(POP, strlen(POP));
+    Client client(POP);
+    assertFrame(errorFrame(P::Error::NoSession), send(device, Bytes(21, P::FRAME_SECURE)));
+    connect(device, client);
+
+    const Bytes first = client.seal(Bytes{P::CMD_GET_STATUS}, 5);
+    TEST_ASSERT_EQUAL(7, client.open(send(device, first)).size());
+    assertFrame(errorFrame(P::Error::Replay), send(device, first));
+    assertFrame(errorFrame(P::Error::Replay), send(device, client.seal(Bytes{P::CMD_GET_STATUS}, 4)));
+    TEST_ASSERT_EQUAL(7, client.open(send(device, client.seal(Bytes{P::CMD_GET_STATUS}, 6))).size());
+    TEST_ASSERT_EQUAL(0, device.authFailures());
+
+    // Malformed input
+    assertFrame(errorFrame(P::Error::Malformed), send(device, Bytes{0x42}));
+    assertFrame(errorFrame(P::Error::Malformed), send(device, Bytes(20, P::FRAME_SECURE)));
+    assertFrame(errorFrame(P::Error::Malformed), send(device, Bytes(P::MAX_FRAME + 1, P::FRAME_SECURE)));
+    assertFrame(errorFrame(P::Error::Malformed), send(device, Bytes(32, P::FRAME_HELLO)));
+    TEST_ASSERT_TRUE(device.sessionOpen());
+
+    // A client that goes away takes the session with it
+    device.reset();
+    assertFrame(errorFrame(P::Error::NoSession), send(device, client.seal(Bytes{P::CMD_GET_STATUS}, 7)));
+
+    // A new HELLO replaces the key: frames of the old session no longer authenticate
+    Client next(POP);
+    connect(device, next);
+    assertFrame(errorFrame(P::Error::AuthFailed), send(device, client.seal(Bytes{P::CMD_GET_STATUS}, 8)));
+    TEST_ASSERT_EQUAL(7, next.open(send(device, next.seal(Bytes{P::CMD_GET_STATUS}))).size());
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_reference_vectors);
+    RUN_TEST(test_set_credentials_and_status_round_trip);
+    RUN_TEST(test_invalid_credentials_are_not_passed_on);
+    RUN_TEST(test_tampered_frames_fail_authentication);
+    RUN_TEST(test_pop_mismatch_locks_out);
+    RUN_TEST(test_replays_and_session_state);
+    return UNITY_END();
+}
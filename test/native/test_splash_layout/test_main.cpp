@@ -0,0 +1,203 @@
+/**
+ * @file test_main.cpp
+ * @brief Splash layout: measureText() against Adafruit_GFX::getTextBounds() for the bundled
+ *        FreeSans fonts and the built-in font, layouts staying on the panel, the layout
+ *        cache, and a benchmark of layout time per call, cold and cached.
+ *
+ * The benchmark prints us per call so runs can be compared; it does not assert on
+ * timings, which depend on the host.
+ */
+
+#include <unity.h>
+#include "splashLayout.h"
+
+#include <Fonts/FreeSans18pt7b.h>
+#include <Fonts/FreeSans12pt7b.h>
+#include <Fonts/FreeSans9pt7b.h>
+
+#include <chrono>
+
+namespace
+{
+    using BenchClock = std::chrono::steady_clock;
+
+    // Panel that only measures; getTextBounds() is the library's algorithm
+    class MeasuringPanel : public Adafruit_GFX
+    {
+    public:
+        MeasuringPanel(int16_t w, int16_t h) : Adafruit_GFX(w, h) {}
+        void drawPixel(int16_t, int16_t, uint16_t) override {}
+    };
+
+    const GFXfont *const FONTS[] = {&FreeSans9pt7b, &FreeSans12pt7b, &FreeSans18pt7b, nullptr};
+
+    const char *const TEXTS[] = {
+        "",
+        "Diesel",
+        "Heater Controller",
+        "Two\nlines",
+        "A title long enough to wrap on any of the supported panels",
+        "\r\nCR LF\r\n",
+        "gjpqy |{}~",
+        "out of range \x7f\x80\xff",
+    };
+
+    const int16_t WIDTHS[] = {128, 64};
+
+    double usPer(BenchClock::time_point start, size_t ops)
+    {
+        const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(BenchClock::now() - start).count();
+        return ops ? (double)ns / 1000.0 / (double)ops : 0.0;
+    }
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_measure_text_matches_get_text_bounds()
+{
+    for (int16_t width : WIDTHS)
+    {
+        MeasuringPanel panel(width, 64);
+        panel.setTextSize(1);
+        panel.setTextWrap(true);
+        for (const GFXfont *font : FONTS)
+        {
+            panel.setFont(font);
+            for (const char *text : TEXTS)
+            {
+                int16_t x1, y1;
+                uint16_t w, h;
+                panel.getTextBounds(String(text), 0, 0, &x1, &y1, &w, &h);
+                const TextBounds b = measureText(font, String(text), width);
+
+                char msg[120];
+                snprintf(msg, sizeof(msg), "font %d, width %d, \"%s\"",
+                         font == &FreeSans9pt7b ? 9 : font == &FreeSans12pt7b ? 12 : font ? 18 : 0, width, text);
+                TEST_ASSERT_EQUAL_MESSAGE(x1, b.x, msg);
+                TEST_ASSERT_EQUAL_MESSAGE(y1, b.y, msg);
+                TEST_ASSERT_EQUAL_MESSAGE(w, b.w, msg);
+                TEST_ASSERT_EQUAL_MESSAGE(h, b.h, msg);
+            }
+        }
+    }
+}
+
+void test_font_layouts_stay_on_the_panel()
+{
+    const int16_t heights[] = {64, 32};
+    for (int16_t height : heights)
+    {
+        MeasuringPanel panel(128, height);
+        for (const char *title : {"Diesel", "Heater", "Ready"})
+        {
+            SplashLayout l;
+            computeSplashLayout(title, "v1.2.3", 0, 0, 128, height, l);
+            if (!l.titleFont && !l.subFont)
+                continue; // built-in fallback: positioned by cell size, not by bounds
+
+            int16_t x1, y1;
+            uint16_t w, h;
+            panel.setFont(l.titleFont);
+            panel.getTextBounds(String(title), l.titleX, l.titleY, &x1, &y1, &w, &h);
+            TEST_ASSERT_TRUE(y1 >= 0);
+            TEST_ASSERT_TRUE(y1 + h <= height);
+            const int16_t titleBottom = y1 + h;
+
+            panel.setFont(l.subFont);
+            panel.getTextBounds(String("v1.2.3"), l.subX, l.subY, &x1, &y1, &w, &h);
+            TEST_ASSERT_TRUE(y1 >= titleBottom);
+            TEST_ASSERT_TRUE(y1 + h <= height);
+        }
+    }
+}
+
+void test_preferred_sizes_rule_out_gfx_fonts()
+{
+    SplashLayout l;
+    computeSplashLayout("Diesel", "Heater", 3, 1, 128, 64, l);
+    TEST_ASSERT_NULL(l.titleFont);
+    TEST_ASSERT_NULL(l.subFont);
+
+    SplashLayout automatic;
+    computeSplashLayout("Diesel", "Heater", 0, 0, 128, 64, automatic);
+    TEST_ASSERT_NOT_NULL(automatic.titleFont);
+}
+
+void test_cache_hits_and_evicts_round_robin()
+{
+    SplashLayoutCache cache;
+    bool cached = true;
+    const SplashLayout &first = cache.get("Diesel", "Heater", 0, 0, 128, 64, cached);
+    TEST_ASSERT_FALSE(cached);
+    SplashLayout expected;
+    computeSplashLayout("Diesel", "Heater", 0, 0, 128, 64, expected);
+    TEST_ASSERT_EQUAL_PTR(expected.titleFont, first.titleFont);
+    TEST_ASSERT_EQUAL(expected.titleX, first.titleX);
+    TEST_ASSERT_EQUAL(expected.subY, first.subY);
+
+    cache.get("Diesel", "Heater", 0, 0, 128, 64, cached);
+    TEST_ASSERT_TRUE(cached);
+
+    // Any input that differs is a different layout
+    cache.get("Diesel", "Heater", 0, 0, 128, 32, cached);
+    TEST_ASSERT_FALSE(cached);
+    cache.get("Diesel", "Heater", 2, 0, 128, 64, cached);
+    TEST_ASSERT_FALSE(cached);
+    cache.get("Diesel", "Heater!", 0, 0, 128, 64, cached);
+    TEST_ASSERT_FALSE(cached);
+    cache.get("Diesel!", "Heater", 0, 0, 128, 64, cached);
+    TEST_ASSERT_FALSE(cached);
+
+    // SIZE misses since the first: its slot has been reused
+    TEST_ASSERT_EQUAL(4, SplashLayoutCache::SIZE);
+    cache.get("Diesel", "Heater", 0, 0, 128, 64, cached);
+    TEST_ASSERT_FALSE(cached);
+}
+
+void test_benchmark_layout_cold_and_cached()
+{
+    constexpr size_t CALLS = 20000;
+    const char *const titles[] = {"Diesel", "Heater Controller", "Connecting", "Provisioning", "Update"};
+    constexpr size_t TITLES = sizeof(titles) / sizeof(titles[0]);
+    static_assert(TITLES > SplashLayoutCache::SIZE, "cold calls must not hit the cache");
+
+    SplashLayoutCache cache;
+    bool cached = false;
+    size_t hits = 0;
+
+    // Cycling through more texts than the cache holds misses on every call
+    auto start = BenchClock::now();
+    for (size_t i = 0; i < CALLS; ++i)
+    {
+        cache.get(titles[i % TITLES], "v1.2.3", 0, 0, 128, 64, cached);
+        hits += cached;
+    }
+    const double coldUs = usPer(start, CALLS);
+    TEST_ASSERT_EQUAL(0, hits);
+
+    start = BenchClock::now();
+    for (size_t i = 0; i < CALLS; ++i)
+    {
+        cache.get(titles[TITLES - 1], "v1.2.3", 0, 0, 128, 64, cached);
+        hits += cached;
+    }
+    const double cachedUs = usPer(start, CALLS);
+    TEST_ASSERT_EQUAL(CALLS, hits);
+
+    char msg[160];
+    snprintf(msg, sizeof(msg), "splash layout on 128x64, %u calls: cold %.2f us, cached %.2f us per call",
+             (unsigned)CALLS, coldUs, cachedUs);
+    TEST_MESSAGE(msg);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_measure_text_matches_get_text_bounds);
+    RUN_TEST(test_font_layouts_stay_on_the_panel);
+    RUN_TEST(test_preferred_sizes_rule_out_gfx_fonts);
+    RUN_TEST(test_cache_hits_and_evicts_round_robin);
+    RUN_TEST(test_benchmark_layout_cold_and_cached);
+    return UNITY_END();
+}
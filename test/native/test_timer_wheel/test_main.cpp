@@ -0,0 +1,214 @@
+/**
+ * @file test_main.cpp
+ * @brief TimerWheel ordering, cancellation and pool limits, plus a benchmark with thousands of timers.
+ *
+ * The benchmark prints ns per schedule/cancel/fire so runs can be compared; it does not
+ * assert on timings, which depend on the host.
+ */
+
+#include <unity.h>
+#include "timerWheel.h"
+
+#include <chrono>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using BenchClock = std::chrono::steady_clock;
+
+    double nsPer(BenchClock::time_point start, size_t ops)
+    {
+        const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(BenchClock::now() - start).count();
+        return ops ? (double)ns / (double)ops : 0.0;
+    }
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_random_delays_fire_on_time_in_order()
+{
+    constexpr size_t COUNT = 4000;
+    TimerWheel wheel(COUNT, nullptr, 1000);
+    std::mt19937 rng(42);
+    // Spread over all four levels and past the 4.6 h span (parked and re-cascaded)
+    std::uniform_int_distribution<uint32_t> delay(0, 6 * 3600 * 1000);
+
+    size_t onTime = 0, fired = 0;
+    uint64_t last = 0;
+    bool ordered = true;
+    for (size_t i = 0; i < COUNT; ++i)
+    {
+        const uint32_t d = delay(rng);
+        const uint64_t due = 1000 + (d == 0 ? 1 : d);
+        TEST_ASSERT_NOT_EQUAL(0, wheel.schedule(d, [&, due] {
+            fired++;
+            onTime += wheel.now() == due;
+            ordered = ordered && due >= last;
+            last = due;
+        }));
+    }
+    TEST_ASSERT_EQUAL(COUNT, wheel.size());
+
+    // Irregular steps, like a service loop that sometimes sleeps long
+    std::uniform_int_distribution<uint32_t> step(1, 90000);
+    uint64_t now = 1000;
+    while (wheel.size() > 0)
+    {
+        now += step(rng);
+        wheel.advance(now);
+    }
+    TEST_ASSERT_EQUAL(COUNT, fired);
+    TEST_ASSERT_EQUAL(COUNT, onTime);
+    TEST_ASSERT_TRUE(ordered);
+}
+
+void test_cancel_and_stale_ids()
+{
+    TimerWheel wheel(4, nullptr, 0);
+    int fired = 0;
+    const TimerWheel::TimerId a = wheel.schedule(10, [&] { fired++; });
+    const TimerWheel::TimerId b = wheel.schedule(20, [&] { fired++; });
+    TEST_ASSERT_TRUE(wheel.cancel(a));
+    TEST_ASSERT_FALSE(wheel.cancel(a));
+    TEST_ASSERT_FALSE(wheel.isPending(a));
+
+    wheel.advance(20);
+    TEST_ASSERT_EQUAL(1, fired);
+    TEST_ASSERT_FALSE(wheel.cancel(b));
+
+    // a's slot is reused; the old id must not reach the new timer
+    const TimerWheel::TimerId c = wheel.schedule(5, [&] { fired++; });
+    TEST_ASSERT_NOT_EQUAL(a, c);
+    TEST_ASSERT_FALSE(wheel.cancel(a));
+    TEST_ASSERT_TRUE(wheel.isPending(c));
+}
+
+void test_full_pool_rejects()
+{
+    TimerWheel wheel(3, nullptr, 0);
+    for (int i = 0; i < 3; ++i)
+        TEST_ASSERT_NOT_EQUAL(0, wheel.schedule(100, [] {}));
+    TEST_ASSERT_EQUAL(0, wheel.schedule(100, [] {}));
+    wheel.advance(100);
+    TEST_ASSERT_NOT_EQUAL(0, wheel.schedule(100, [] {}));
+}
+
+void test_callbacks_reschedule_and_cancel_themselves()
+{
+    TimerWheel wheel(8, nullptr, 0);
+    int chain = 0;
+    std::function<void()> next = [&] {
+        if (++chain < 5)
+            wheel.schedule(7, next);
+    };
+    wheel.schedule(7, next);
+
+    int periodic = 0;
+    TimerWheel::TimerId id = 0;
+    id = wheel.schedulePeriodic(10, [&] {
+        if (++periodic == 3)
+            wheel.cancel(id);
+    });
+
+    for (uint64_t now = 1; now <= 1000; ++now)
+        wheel.advance(now);
+    TEST_ASSERT_EQUAL(5, chain);
+    TEST_ASSERT_EQUAL(3, periodic);
+    TEST_ASSERT_EQUAL(0, wheel.size());
+}
+
+void test_late_advance_skips_missed_periods()
+{
+    TimerWheel wheel(2, nullptr, 0);
+    int fired = 0;
+    wheel.schedulePeriodic(100, [&] { fired++; });
+
+    // The loop stalled for 10 s: one call, not a burst of 100
+    TEST_ASSERT_EQUAL(1, wheel.advance(10050));
+    TEST_ASSERT_EQUAL(1, fired);
+    // Phase is kept: next at 10100
+    TEST_ASSERT_EQUAL_UINT32(50, wheel.msUntilNextExpiry(10050));
+    TEST_ASSERT_EQUAL(1, wheel.advance(10100));
+    // On time from here on: every 100 ms
+    for (uint64_t now = 10110; now <= 10500; now += 10)
+        wheel.advance(now);
+    TEST_ASSERT_EQUAL(6, fired);
+}
+
+void test_next_expiry_bounds_sleep()
+{
+    TimerWheel wheel(4, nullptr, 0);
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, wheel.msUntilNextExpiry(0));
+    wheel.schedule(30, [] {});
+    TEST_ASSERT_EQUAL_UINT32(30, wheel.msUntilNextExpiry(0));
+    wheel.schedule(90000, [] {});
+    wheel.advance(30);
+    // Only a cascade point is known for the far timer; it must not lie past the expiry
+    const uint32_t wait = wheel.msUntilNextExpiry(30);
+    TEST_ASSERT_TRUE(wait > 0 && wait <= 90000 - 30);
+}
+
+void test_benchmark_thousands_of_timers()
+{
+    constexpr size_t COUNT = 20000;
+    constexpr int ROUNDS = 5;
+    constexpr uint64_t TICKS = 10 * 60 * 1000;
+    TimerWheel wheel(COUNT, nullptr, 0);
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<uint32_t> delay(1, TICKS);
+    std::vector<uint32_t> delays(COUNT);
+    std::vector<TimerWheel::TimerId> ids(COUNT);
+    size_t fired = 0;
+
+    double scheduleNs = 0, cancelNs = 0, tickNs = 0;
+    size_t firedOps = 0;
+    for (int round = 0; round < ROUNDS; ++round)
+    {
+        for (auto &d : delays)
+            d = delay(rng);
+
+        auto t0 = BenchClock::now();
+        for (size_t i = 0; i < COUNT; ++i)
+            ids[i] = wheel.schedule(delays[i], [&fired] { fired++; });
+        scheduleNs += nsPer(t0, COUNT);
+        TEST_ASSERT_EQUAL(COUNT, wheel.size());
+
+        // Cancel every other one (e.g. timeouts of requests that completed)
+        t0 = BenchClock::now();
+        for (size_t i = 0; i < COUNT; i += 2)
+            wheel.cancel(ids[i]);
+        cancelNs += nsPer(t0, COUNT / 2);
+
+        // Fire the rest from a 1 ms service loop
+        const size_t before = fired;
+        const uint64_t end = wheel.now() + TICKS;
+        t0 = BenchClock::now();
+        for (uint64_t now = wheel.now() + 1; now <= end; ++now)
+            wheel.advance(now);
+        tickNs += nsPer(t0, TICKS);
+        firedOps += fired - before;
+        TEST_ASSERT_EQUAL(0, wheel.size());
+    }
+    TEST_ASSERT_EQUAL(COUNT / 2 * ROUNDS, firedOps);
+
+    char msg[200];
+    snprintf(msg, sizeof(msg), "%u timers over 10 min, %d rounds: schedule %.0f ns, cancel %.0f ns, advance %.0f ns per 1 ms tick (%.3f fired per tick)",
+             (unsigned)COUNT, ROUNDS, scheduleNs / ROUNDS, cancelNs / ROUNDS, tickNs / ROUNDS,
+             (double)firedOps / ((double)ROUNDS * TICKS));
+    TEST_MESSAGE(msg);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_random_delays_fire_on_time_in_order);
+    RUN_TEST(test_cancel_and_stale_ids);
+    RUN_TEST(test_full_pool_rejects);
+    RUN_TEST(test_callbacks_reschedule_and_cancel_themselves);
+    RUN_TEST(test_late_advance_skips_missed_periods);
+    RUN_TEST(test_next_expiry_bounds_sleep);
+    RUN_TEST(test_benchmark_thousands_of_timers);
+    return UNITY_END();
+}
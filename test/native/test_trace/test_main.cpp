@@ -0,0 +1,141 @@
+/**
+ * @file test_main.cpp
+ * @brief Trace: TRACE_SCOPE spans in the per-core rings, pausing, the name table, the
+ *        Chrome JSON export, and a benchmark of the cost of one empty TRACE_SCOPE.
+ *
+ * [env:native] builds with DHC_TRACE_ENABLED=1. The benchmark prints ns per scope so
+ * runs can be compared; it does not assert on timings, which depend on the host (here
+ * each scope's two esp_timer_get_time() calls are steady_clock reads).
+ */
+
+#include <unity.h>
+#include "trace.h"
+
+#include <chrono>
+#include <string>
+
+namespace
+{
+    using BenchClock = std::chrono::steady_clock;
+
+    class StringPrint : public Print
+    {
+    public:
+        size_t write(uint8_t b) override
+        {
+            text += (char)b;
+            return 1;
+        }
+        using Print::write;
+        std::string text;
+    };
+
+    void emptyScope()
+    {
+        TRACE_SCOPE("empty");
+    }
+}
+
+void setUp()
+{
+    Trace::instance().clear();
+    Trace::instance().setRecording(true);
+}
+
+void tearDown() {}
+
+void test_begin_allocates_and_records()
+{
+    TEST_ASSERT_TRUE(Trace::compiledIn());
+    TEST_ASSERT_TRUE(Trace::instance().begin());
+    TEST_ASSERT_TRUE(Trace::instance().recording());
+
+    emptyScope();
+    emptyScope();
+    TEST_ASSERT_EQUAL(2, Trace::instance().eventCount());
+}
+
+void test_paused_records_nothing()
+{
+    Trace::instance().setRecording(false);
+    emptyScope();
+    TEST_ASSERT_EQUAL(0, Trace::instance().eventCount());
+}
+
+void test_ring_keeps_the_newest_spans()
+{
+    for (size_t i = 0; i < Trace::EVENTS_PER_CORE + 100; ++i)
+        emptyScope();
+    // The test thread stays on one host "core"
+    TEST_ASSERT_EQUAL(Trace::EVENTS_PER_CORE, Trace::instance().eventCount());
+}
+
+void test_names_are_shared_and_overflow_to_other()
+{
+    Trace &tr = Trace::instance();
+    const Trace::NameId a = tr.nameId("name test");
+    char copy[] = "name test";
+    TEST_ASSERT_EQUAL(a, tr.nameId(copy));
+    TEST_ASSERT_NOT_EQUAL(0, a);
+
+    // Fill the table; later names share id 0 ("(other)")
+    static char names[Trace::MAX_NAMES][12];
+    Trace::NameId last = a;
+    for (uint16_t i = 0; i < Trace::MAX_NAMES; ++i)
+    {
+        snprintf(names[i], sizeof(names[i]), "n%u", (unsigned)i);
+        last = tr.nameId(names[i]);
+    }
+    TEST_ASSERT_EQUAL(0, last);
+}
+
+void test_chrome_json_holds_the_spans()
+{
+    {
+        TRACE_SCOPE("json span");
+    }
+    StringPrint out;
+    const size_t n = Trace::instance().writeChromeJson(out);
+    TEST_ASSERT_EQUAL(out.text.size(), n);
+    TEST_ASSERT_EQUAL(0, out.text.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["));
+    TEST_ASSERT_NOT_EQUAL(std::string::npos, out.text.find("\"name\":\"json span\",\"ph\":\"X\""));
+    TEST_ASSERT_EQUAL(out.text.size() - 2, out.text.rfind("]}"));
+    // Export resumes recording
+    TEST_ASSERT_TRUE(Trace::instance().recording());
+}
+
+void test_benchmark_empty_scope()
+{
+    constexpr size_t SCOPES = 1000000;
+
+    auto start = BenchClock::now();
+    for (size_t i = 0; i < SCOPES; ++i)
+        emptyScope();
+    const double recordingNs =
+        (double)std::chrono::duration_cast<std::chrono::nanoseconds>(BenchClock::now() - start).count() / SCOPES;
+
+    // Paused: only the two clock reads and the recording check remain
+    Trace::instance().setRecording(false);
+    start = BenchClock::now();
+    for (size_t i = 0; i < SCOPES; ++i)
+        emptyScope();
+    const double pausedNs =
+        (double)std::chrono::duration_cast<std::chrono::nanoseconds>(BenchClock::now() - start).count() / SCOPES;
+
+    char msg[160];
+    snprintf(msg, sizeof(msg), "%u empty TRACE_SCOPEs: %.1f ns each recording, %.1f ns paused",
+             (unsigned)SCOPES, recordingNs, pausedNs);
+    TEST_MESSAGE(msg);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_begin_allocates_and_records);
+    RUN_TEST(test_paused_records_nothing);
+    RUN_TEST(test_ring_keeps_the_newest_spans);
+    RUN_TEST(test_chrome_json_holds_the_spans);
+    RUN_TEST(test_benchmark_empty_scope);
+    RUN_TEST(test_names_are_shared_and_overflow_to_other); // last: fills the name table
+    return UNITY_END();
+}
@@ -0,0 +1,195 @@
+// Provisioning page. Built into the firmware by scripts/build_web.py (minified, inlined
+// into index.html, gzipped); edit the sources here and rebuild.
+
+const $ = (id) => document.getElementById(id);
+
+// ---- Network picker ------------------------------------------------------------
+
+// Offer nearby networks. The device scans in the background and caches results, so
+// poll until the scan it started (if any) has finished.
+const SCAN_POLL_MS = 1500;
+const SCAN_MAX_POLLS = 10;
+let scanTimer = 0;
+
+function bars(rssi){
+  const n = rssi >= -55 ? 4 : rssi >= -67 ? 3 : rssi >= -78 ? 2 : 1;
+  return '▂▄▆█'.slice(0, n).padEnd(4, '·');
+}
+
+function pick(net, li){
+  $('ssid').value = net.ssid;
+  // Open networks need no password
+  $('pwdRow').hidden = !net.secure;
+  if (!net.secure) $('password').value = '';
+  for (const el of $('nets').children) el.classList.toggle('sel', el === li);
+  (net.secure ? $('password') : $('deviceName')).focus();
+}
+
+function showNetworks(list){
+  const ul = $('nets');
+  const selected = $('ssid').value;
+  ul.textContent = '';
+  for (const net of list) {
+    const li = document.createElement('li');
+    const name = document.createElement('span');
+    name.textContent = net.ssid;
+    const sig = document.createElement('span');
+    sig.className = 'sig';
+    sig.textContent = (net.secure ? '\u{1F512} ' : '') + bars(net.rssi);
+    sig.title = net.rssi + ' dBm, channel ' + net.channel;
+    li.append(name, sig);
+    li.addEventListener('click', () => pick(net, li));
+    if (net.ssid === selected) li.className = 'sel';
+    ul.appendChild(li);
+  }
+}
+
+async function loadNetworks(refresh, attempt){
+  clearTimeout(scanTimer);
+  const state = $('scanState');
+  try{
+    const res = await fetch('/api/scan' + (refresh ? '?refresh=1' : ''), { cache: 'no-store' });
+    if (!res.ok) throw new Error('HTTP ' + res.status);
+    const data = await res.json();
+    const list = (data.networks || []).filter((n) => n.ssid).sort((a, b) => b.rssi - a.rssi);
+    showNetworks(list);
+    if (data.scanning && attempt < SCAN_MAX_POLLS) {
+      state.textContent = 'Scanning...';
+      scanTimer = setTimeout(() => loadNetworks(false, attempt + 1), SCAN_POLL_MS);
+      return;
+    }
+    state.textContent = list.length ? 'Tap a network, or type its name below.' : 'No networks found; type the name below.';
+  }catch(err){
+    state.textContent = 'Network list unavailable; type the name below.';
+  }
+}
+
+$('rescan').addEventListener('click', () => loadNetworks(true, 0));
+$('ssid').addEventListener('input', () => { $('pwdRow').hidden = false; });
+
+// ---- Save and progress -----------------------------------------------------------
+
+// Poll /api/provision/status while the device tests the credentials. Joining the
+// network can move the device's AP to another channel, so the phone may drop off the
+// AP for a few seconds: failed polls are retried until GIVE_UP_MS.
+const POLL_MS = 1000;
+const GIVE_UP_MS = 60000;
+
+// wifi_err_reason_t values worth explaining, and the firmware's own (254, 255)
+const REASONS = {
+  2: 'wrong password?', 15: 'wrong password?', 204: 'wrong password?',
+  201: 'network not found', 202: 'authentication failed', 203: 'association failed',
+  254: 'no address in time', 255: 'address lost'
+};
+
+function setStep(step, cls){
+  for (const li of $('steps').children) {
+    const order = ['send', 'join', 'done'];
+    const at = order.indexOf(li.dataset.step), now = order.indexOf(step);
+    li.className = at < now ? 'ok' : at === now ? cls : '';
+  }
+}
+
+function setBar(fraction){
+  $('barFill').style.width = Math.round(Math.min(1, fraction) * 100) + '%';
+}
+
+function showForm(){
+  $('progress').hidden = true;
+  $('setup').hidden = false;
+}
+
+function followProgress(st){
+  const status = $('status');
+  const started = Date.now();
+  const show = (s) => {
+    if (s.phase === 'testing') {
+      const secs = Math.round((s.elapsedMs || 0) / 1000);
+      setStep('join', 'on');
+      // A trial gives up after CONNECT_TIMEOUT_MS (10 s); keep the bar honest but moving
+      setBar(0.2 + 0.6 * Math.min(1, secs / 10));
+      status.textContent = 'Connecting to ' + s.ssid + '... (' + secs + ' s)';
+      return false;
+    }
+    if (s.phase === 'connected') {
+      setStep('done', 'ok');
+      setBar(1);
+      status.textContent = 'Connected to ' + s.ssid + '. The device is now at http://' + s.ip +
+        '/ on that network. This setup network closes in ' + Math.round(s.handoffMs / 1000) + ' s.';
+      return true;
+    }
+    if (s.phase === 'failed') {
+      setStep('join', 'bad');
+      status.textContent = 'Could not connect to ' + s.ssid + ' (reason ' + s.reason +
+        (REASONS[s.reason] ? ', ' + REASONS[s.reason] : '') + '). Check the password and try again.';
+      $('retry').hidden = false;
+      return true;
+    }
+    return false;
+  };
+  if (show(st)) return;
+
+  const poll = async () => {
+    try{
+      const res = await fetch('/api/provision/status', { cache: 'no-store' });
+      if (res.ok && show(await res.json())) return;
+    }catch(err){
+      status.textContent = 'Waiting for the device (it may be switching channels)...';
+    }
+    if (Date.now() - started < GIVE_UP_MS) {
+      setTimeout(poll, POLL_MS);
+    } else {
+      status.textContent = 'No answer from the device. If it joined your network, find it there; otherwise reconnect to its setup network and try again.';
+      $('retry').hidden = false;
+    }
+  };
+  setTimeout(poll, POLL_MS);
+}
+
+async function save(e){
+  e.preventDefault();
+  const form = e.target;
+  const data = new URLSearchParams(new FormData(form));
+  clearTimeout(scanTimer);
+  $('setup').hidden = true;
+  $('progress').hidden = false;
+  $('retry').hidden = true;
+  setStep('send', 'on');
+  setBar(0.1);
+  $('status').textContent = 'Saving...';
+
+  try{
+    // Some captive-portal browsers block fetch/post due to DNS/HTTPS redirection
+    // quirks. Send an explicit content-type header and time out.
+    const controller = new AbortController();
+    const timeout = setTimeout(() => controller.abort(), 8000);
+    const res = await fetch('/save', {
+      method: 'POST',
+      headers: { 'Content-Type': 'application/x-www-form-urlencoded' },
+      body: data.toString(),
+      signal: controller.signal
+    });
+    clearTimeout(timeout);
+
+    if (!res.ok) {
+      setStep('send', 'bad');
+      $('status').textContent = (res.status === 409) ? 'A connection test is already running.' : 'Server error: ' + res.status;
+      $('retry').hidden = false;
+      return;
+    }
+    // 202: the device is now trying the network; follow it until it settles
+    followProgress(await res.json());
+  }catch(err){
+    // Fallback: a plain form submit is more likely to get through the browser's
+    // captive-portal handling
+    console.warn('Fetch failed, falling back to native submit', err);
+    $('status').textContent = 'Fetch failed, falling back to form submit...';
+    form.removeEventListener('submit', save);
+    form.submit();
+  }
+}
+
+$('prov').addEventListener('submit', save);
+$('retry').addEventListener('click', () => { showForm(); loadNetworks(false, 0); });
+
+loadNetworks(false, 0);